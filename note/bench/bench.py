@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+#########################################################################
+# File Name: bench.py
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+# Benchmark the netlist extraction with netlists generated by gen_netlist.py.
+# Every design is run by verilator with --netlist-profile, and the time and
+# peak memory of every stage are collected into bench_results.json and
+# bench_results.csv, e.g.
+#   ./bench.py --designs small,deep -- --netlist-threads 4
+import argparse
+import csv
+import json
+import os
+import subprocess
+import sys
+import time
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(os.path.dirname(BENCH_DIR))
+LIB = os.path.join(REPO_DIR, "note", "misc", "LibBlackbox.v")
+
+# Arguments of gen_netlist.py, flat instances are about children^depth*cells.
+DESIGNS = {
+    # 6.4K instances, a quick check of the benchmark itself
+    "small": ["--depth", "3", "--children", "4", "--cells", "100"],
+    # 1M instances in 4 levels
+    "large": ["--depth", "4", "--children", "10", "--cells", "100",
+              "--bus-width", "64", "--variants", "4"],
+    # 4M instances, a big design for memory
+    "huge": ["--depth", "5", "--children", "10", "--cells", "40",
+             "--bus-width", "32", "--variants", "3"],
+    # 1M instances in 16 levels of 2 sub modules
+    "deep": ["--depth", "16", "--children", "2", "--cells", "16",
+             "--bus-width", "8"],
+    # 1M instances in 2000 sub modules of the top
+    "wide": ["--depth", "1", "--children", "2000", "--cells", "500",
+             "--bus-width", "32", "--variants", "50"],
+    # 1M instances with 512 bits buses
+    "bus": ["--depth", "3", "--children", "16", "--cells", "256",
+            "--bus-width", "512", "--variants", "2"],
+    # 1M instances of which a half of the inputs are tied off
+    "tieoff": ["--depth", "3", "--children", "10", "--cells", "1000",
+               "--bus-width", "32", "--tie-off-ratio", "0.5"],
+}
+
+
+def run_design(args, design, verilator_args):
+    work_dir = os.path.join(os.path.abspath(args.work_dir), design)
+    os.makedirs(work_dir, exist_ok=True)
+    netlist = os.path.join(work_dir, design + ".v")
+    if not os.path.exists(netlist):
+        subprocess.check_call([sys.executable,
+                               os.path.join(BENCH_DIR, "gen_netlist.py"),
+                               "-o", netlist] + DESIGNS[design])
+    profile = os.path.join(work_dir, "profile.json")
+    if os.path.exists(profile):
+        os.remove(profile)
+    command = [args.verilator, netlist, LIB, "--xml-only", "--top-module",
+               "top", "--netlist-profile", profile] + verilator_args
+    begin = time.time()
+    with open(os.path.join(work_dir, "verilator.log"), "w") as log:
+        returncode = subprocess.call(command, cwd=work_dir, stdout=log,
+                                     stderr=subprocess.STDOUT)
+    result = {
+        "design": design,
+        "generator": DESIGNS[design],
+        "verilatorArgs": verilator_args,
+        "netlistBytes": os.path.getsize(netlist),
+        "returncode": returncode,
+        "wallSecs": time.time() - begin,
+    }
+    if returncode == 0 and os.path.exists(profile):
+        with open(profile) as ifs:
+            result.update(json.load(ifs))
+        result["wallSecs"] = time.time() - begin
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        usage="%(prog)s [options] [-- verilator arguments]")
+    parser.add_argument("--designs", default="small",
+                        help="comma separated designs of " +
+                        ",".join(DESIGNS) + ", or all")
+    parser.add_argument("--verilator",
+                        default=os.path.join(REPO_DIR, "bin", "verilator"))
+    parser.add_argument("--work-dir", default="bench_work",
+                        help="directory of generated netlists and outputs")
+    parser.add_argument("--output", default="bench_results",
+                        help="prefix of the .json and .csv result files")
+    args, verilator_args = parser.parse_known_args()
+    if verilator_args and verilator_args[0] == "--":
+        verilator_args = verilator_args[1:]
+    designs = list(DESIGNS) if args.designs == "all" else \
+        args.designs.split(",")
+    for design in designs:
+        if design not in DESIGNS:
+            parser.error("unknown design " + design)
+    os.environ.setdefault("VERILATOR_ROOT", REPO_DIR)
+
+    results = []
+    for design in designs:
+        result = run_design(args, design, verilator_args)
+        print("%s: %s, %.3f s, peak RSS %.1f MB" % (
+            design, "failed" if result["returncode"] else "passed",
+            result["wallSecs"], result.get("peakRssBytes", 0) / 1048576.0))
+        results.append(result)
+
+    with open(args.output + ".json", "w") as ofs:
+        json.dump({"results": results}, ofs, indent=2)
+    with open(args.output + ".csv", "w", newline="") as ofs:
+        writer = csv.writer(ofs)
+        columns = ["wallSecs", "cpuSecs", "rssBytes", "peakRssBytes",
+                   "modules", "ports", "refVars", "instances"]
+        writer.writerow(["design", "stage"] + columns)
+        for result in results:
+            for stage in result.get("stages", []):
+                writer.writerow([result["design"], stage["name"]] +
+                                [stage[column] for column in columns])
+            writer.writerow([result["design"], "total", result["wallSecs"],
+                             result.get("totalCpuSecs", ""), "",
+                             result.get("peakRssBytes", "")])
+    return 1 if any(result["returncode"] for result in results) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
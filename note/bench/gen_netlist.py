@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+#########################################################################
+# File Name: gen_netlist.py
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+# Generate a synthetic hierarchical gate-level netlist with the cells of
+# note/misc/LibBlackbox.v. Every module below the top has --variants
+# definitions per level, and every not leaf module instances --children sub
+# modules of the next level, which are chained by a bus of --bus-width bits.
+# A leaf module has --cells random cells, so the flattened netlist has about
+# children^depth * cells instances.
+import argparse
+import random
+import sys
+
+# Cell name, input pins, output pins
+CELLS = [
+    ("INV_X1_LVT", ["A"], ["ZN"]),
+    ("NAND2_X1_LVT", ["A1", "A2"], ["ZN"]),
+    ("XOR2_X1_LVT", ["A", "B"], ["Z"]),
+    ("MUX2_X1_LVT", ["A", "B", "S"], ["Z"]),
+]
+DFF = ("DFFR_X1_LVT", ["D"], ["Q"])
+
+
+def get_mod_name(level, variant):
+    return "blk_l%d_v%d" % (level, variant)
+
+
+def write_header(out, mod_name, bus_width):
+    out.write("module %s (clk, rst_n, din, dout);\n" % mod_name)
+    out.write("  input clk, rst_n;\n")
+    out.write("  input [%d:0] din;\n" % (bus_width - 1))
+    out.write("  output [%d:0] dout;\n" % (bus_width - 1))
+
+
+def write_leaf(out, rng, args, mod_name):
+    write_header(out, mod_name, args.bus_width)
+    total_nets = max(args.cells - args.bus_width, 0)
+    if total_nets:
+        out.write("  wire [%d:0] n;\n" % (total_nets - 1))
+    # A cell only reads din or the nets driven by earlier cells, so there
+    # are no combinational loops.
+    drivers = ["din[%d]" % bit for bit in range(args.bus_width)]
+
+    def get_input():
+        if rng.random() < args.tie_off_ratio:
+            return rng.choice(["1'b0", "1'b1"])
+        return rng.choice(drivers[-4 * args.bus_width:])
+
+    for cell_index in range(args.cells):
+        if cell_index < total_nets:
+            output = "n[%d]" % cell_index
+        else:
+            output = "dout[%d]" % (cell_index - total_nets)
+        if rng.random() < args.dff_ratio:
+            out.write("  %s c%d (.CK(clk), .D(%s), .RN(rst_n), .Q(%s), .QN());\n"
+                      % (DFF[0], cell_index, get_input(), output))
+        else:
+            cell, inputs, outputs = rng.choice(CELLS)
+            pins = ["." + pin + "(" + get_input() + ")" for pin in inputs]
+            pins.append("." + outputs[0] + "(" + output + ")")
+            out.write("  %s c%d (%s);\n" % (cell, cell_index, ", ".join(pins)))
+        drivers.append(output)
+    # Bits of dout which aren't driven by cells if cells < bus width
+    for bit in range(args.cells, args.bus_width):
+        out.write("  assign dout[%d] = din[%d];\n" % (bit, bit))
+    out.write("endmodule\n\n")
+
+
+def write_parent(out, args, mod_name, level):
+    write_header(out, mod_name, args.bus_width)
+    top_bit = args.bus_width - 1
+    for child_index in range(args.children):
+        out.write("  wire [%d:0] b%d;\n" % (top_bit, child_index))
+    for child_index in range(args.children):
+        # Every variant is used, or it would be another top module.
+        child = get_mod_name(level + 1, child_index % args.variants)
+        din = "din" if child_index == 0 else "b%d" % (child_index - 1)
+        out.write("  %s u%d (.clk(clk), .rst_n(rst_n), .din(%s), .dout(b%d));\n"
+                  % (child, child_index, din, child_index))
+    # Glue logic between the bus of the last sub module and dout
+    last = "b%d" % (args.children - 1)
+    for bit in range(args.bus_width):
+        out.write("  XOR2_X1_LVT g%d (.A(%s[%d]), .B(din[%d]), .Z(dout[%d]));\n"
+                  % (bit, last, bit, bit, bit))
+    out.write("endmodule\n\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--depth", type=int, default=3,
+                        help="levels of hierarchy below the top")
+    parser.add_argument("--children", type=int, default=4,
+                        help="sub module instances of every not leaf module")
+    parser.add_argument("--cells", type=int, default=100,
+                        help="cells of every leaf module")
+    parser.add_argument("--bus-width", type=int, default=16,
+                        help="width of the bus between sub modules")
+    parser.add_argument("--variants", type=int, default=2,
+                        help="module definitions per hierarchy level")
+    parser.add_argument("--tie-off-ratio", type=float, default=0.05,
+                        help="ratio of cell inputs tied to 1'b0 or 1'b1")
+    parser.add_argument("--dff-ratio", type=float, default=0.1,
+                        help="ratio of flip-flops in leaf modules")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("-o", "--output", default="-",
+                        help="output verilog file, - for stdout")
+    args = parser.parse_args()
+    if args.depth < 1 or args.children < 1 or args.cells < 1 or \
+       args.bus_width < 1 or args.variants < 1:
+        parser.error("depth, children, cells, bus width and variants must "
+                     "be positive")
+    # A variant which isn't instanced would be another top module.
+    if args.children < args.variants:
+        parser.error("children must be at least variants")
+
+    rng = random.Random(args.seed)
+    out = sys.stdout if args.output == "-" else open(args.output, "w")
+    # Leaves first, so that a module is always defined before it is used.
+    for variant in range(args.variants):
+        write_leaf(out, rng, args, get_mod_name(args.depth, variant))
+    for level in range(args.depth - 1, 0, -1):
+        for variant in range(args.variants):
+            write_parent(out, args, get_mod_name(level, variant), level)
+    write_parent(out, args, "top", 0)
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()
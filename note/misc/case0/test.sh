@@ -7,8 +7,13 @@
 #This a complicated example, which contains a variety of situations to help us understand
 #Ast.
 #!/bin/bash
-../../../bin/verilator -Wno-implicit ripple_adder_modified.v ../LibBlackbox.v --xml-only
-hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v`
-flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v`
-[ $hier ] && echo "In case0,$hier." && error=true
-[ $flat ] && echo "In case0,$flat." && error=true
+rm -f HierNetlist.v FlatNetlist.v NetlistDiff.txt
+../../../bin/verilator -Wno-implicit ripple_adder_modified.v ../LibBlackbox.v --xml-only \
+  --netlist-diff-hier standard/StandardHierNetlist.v \
+  --netlist-diff-flat standard/StandardFlatNetlist.v
+diffs=`grep -v "^//" NetlistDiff.txt 2>&1`
+[ "$diffs" ] && echo "In case0, netlists differ, see NetlistDiff.txt." && error=true
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case0,$hier." && error=true
+[ "$flat" ] && echo "In case0,$flat." && error=true
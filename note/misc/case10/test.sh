@@ -5,8 +5,13 @@
 # Created Time: Sun 05 Dec 2021 04:58:54 PM CST
 #########################################################################
 #!/bin/bash
-../../../bin/verilator -Wno-implicit vector_combination.v ../LibBlackbox.v --xml-only
-hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v`
-flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v`
-[ $hier ] && echo "In case10,$hier." && error=true
-[ $flat ] && echo "In case10,$flat." && error=true
+rm -f HierNetlist.v FlatNetlist.v NetlistDiff.txt
+../../../bin/verilator -Wno-implicit vector_combination.v ../LibBlackbox.v --xml-only \
+  --netlist-diff-hier standard/StandardHierNetlist.v \
+  --netlist-diff-flat standard/StandardFlatNetlist.v
+diffs=`grep -v "^//" NetlistDiff.txt 2>&1`
+[ "$diffs" ] && echo "In case10, netlists differ, see NetlistDiff.txt." && error=true
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case10,$hier." && error=true
+[ "$flat" ] && echo "In case10,$flat." && error=true
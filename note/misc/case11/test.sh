@@ -6,8 +6,13 @@
 #########################################################################
 #This case is use to test void HierNetlistVisitor::swapEmptyAndNotEmptyStdCellPosition()
 #!/bin/bash
-../../../bin/verilator -Wno-implicit has_memory_PLL_blackbox.v ../LibBlackbox.v --xml-only
-hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v`
-flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v`
-[ $hier ] && echo "In case11,$hier." && error=true
-[ $flat ] && echo "In case11,$flat." && error=true
+rm -f HierNetlist.v FlatNetlist.v NetlistDiff.txt
+../../../bin/verilator -Wno-implicit has_memory_PLL_blackbox.v ../LibBlackbox.v --xml-only \
+  --netlist-diff-hier standard/StandardHierNetlist.v \
+  --netlist-diff-flat standard/StandardFlatNetlist.v
+diffs=`grep -v "^//" NetlistDiff.txt 2>&1`
+[ "$diffs" ] && echo "In case11, netlists differ, see NetlistDiff.txt." && error=true
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case11,$hier." && error=true
+[ "$flat" ] && echo "In case11,$flat." && error=true
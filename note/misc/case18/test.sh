@@ -6,8 +6,13 @@
 #########################################################################
 #This is a normal hierarchical netlist without vector.
 #!/bin/bash
-../../../bin/verilator tristate_buffer.v ../LibBlackbox.v --xml-only  -Wno-implicit
-hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v`
-flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v`
-[ $hier ] && echo "In case18,$hier." && error=true
-[ $flat ] && echo "In case18,$flat." && error=true
+rm -f HierNetlist.v FlatNetlist.v NetlistDiff.txt
+../../../bin/verilator tristate_buffer.v ../LibBlackbox.v --xml-only  -Wno-implicit \
+  --netlist-diff-hier standard/StandardHierNetlist.v \
+  --netlist-diff-flat standard/StandardFlatNetlist.v
+diffs=`grep -v "^//" NetlistDiff.txt 2>&1`
+[ "$diffs" ] && echo "In case18, netlists differ, see NetlistDiff.txt." && error=true
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case18,$hier." && error=true
+[ "$flat" ] && echo "In case18,$flat." && error=true
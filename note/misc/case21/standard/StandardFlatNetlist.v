@@ -0,0 +1,50 @@
+module top(ck,rst_n,se,te,en,si,a,b,q,co,so,z);
+   input ck;
+   input rst_n;
+   input se;
+   input te;
+   input en;
+   input si;
+   input [3:0]a;
+   input [3:0]b;
+   output [3:0]q;
+   output co;
+   output so;
+   output z;
+   wire gck;
+   wire c1;
+   wire s0;
+   wire zero;
+   wire x;
+   wire u0/c0;
+   wire [1:0]u0/s;
+   wire u0/n0;
+   wire u0/dead;
+   wire u1/c0;
+   wire [1:0]u1/s;
+   wire u1/n0;
+   wire u1/dead;
+  assign s0 = q[1];
+  assign so = q[3];
+  CLKGATETST_X1 cg (.CK(ck), .E(en), .SE(te), .GCK(gck));
+  FA_X1 u0/add0 (.A(a[0]), .B(b[0]), .CI(zero), .CO(u0/c0), .S(u0/s[0]));
+  FA_X1 u0/add1 (.A(a[1]), .B(b[1]), .CI(u0/c0), .CO(c1), .S(u0/s[1]));
+  SDFFR_X1 u0/r0 (.CK(gck), .D(u0/s[0]), .RN(rst_n), .SE(se), .SI(si), .Q(q[0]), 
+      .QN());
+  SDFFR_X1 u0/r1 (.CK(gck), .D(u0/s[1]), .RN(rst_n), .SE(se), .SI(q[0]), .Q(q[1]), 
+      .QN());
+  NAND2_X1 u0/d0 (.A1(a[0]), .A2(b[0]), .ZN(u0/n0));
+  AND2_X1 u0/d2 (.A1(u0/n0), .A2(u0/n0), .ZN(u0/dead));
+  FA_X1 u1/add0 (.A(a[2]), .B(b[2]), .CI(c1), .CO(u1/c0), .S(u1/s[0]));
+  FA_X1 u1/add1 (.A(a[3]), .B(b[3]), .CI(u1/c0), .CO(co), .S(u1/s[1]));
+  SDFFR_X1 u1/r0 (.CK(gck), .D(u1/s[0]), .RN(rst_n), .SE(se), .SI(s0), .Q(q[2]), 
+      .QN());
+  SDFFR_X1 u1/r1 (.CK(gck), .D(u1/s[1]), .RN(rst_n), .SE(se), .SI(q[2]), .Q(q[3]), 
+      .QN());
+  NAND2_X1 u1/d0 (.A1(a[2]), .A2(b[2]), .ZN(u1/n0));
+  AND2_X1 u1/d2 (.A1(u1/n0), .A2(u1/n0), .ZN(u1/dead));
+  LOGIC0_X1 tie0 (.Z(zero));
+  AND2_X1 g0 (.A1(q[0]), .A2(zero), .ZN(x));
+  OR2_X1 g1 (.A1(x), .A2(q[3]), .ZN(z));
+endmodule
+
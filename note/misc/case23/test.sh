@@ -0,0 +1,23 @@
+#########################################################################
+# File Name: test.sh
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+#This is an adder of two slices with a scan chain, gated clock and tie cells,
+#whose dead logic is removed by --sweep.
+#!/bin/bash
+rm -f HierNetlist.v FlatNetlist.v NetlistDiff.txt SweepReport.txt
+../../../bin/verilator scan_adder.v ../LibBlackbox.v --xml-only --sweep \
+  --netlist-diff-hier standard/StandardHierNetlist.v \
+  --netlist-diff-flat standard/StandardFlatNetlist.v
+diffs=`grep -v "^//" NetlistDiff.txt 2>&1`
+[ "$diffs" ] && echo "In case23, netlists differ, see NetlistDiff.txt." && error=true
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case23,$hier." && error=true
+[ "$flat" ] && echo "In case23,$flat." && error=true
+for file in SweepReport.txt; do
+  report=`diff -bqBH $file standard/$file 2>&1`
+  [ "$report" ] && echo "In case23,$report." && error=true
+done
@@ -0,0 +1,15 @@
+#########################################################################
+# File Name: test.sh
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+#This is an adder of two slices with a scan chain, gated clock and tie cells,
+#whose slices are kept as hard macros by --flatten-depth.
+#!/bin/bash
+rm -f HierNetlist.v* FlatNetlist.v*
+../../../bin/verilator scan_adder.v ../LibBlackbox.v --xml-only --flatten-depth 0
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case25,$hier." && error=true
+[ "$flat" ] && echo "In case25,$flat." && error=true
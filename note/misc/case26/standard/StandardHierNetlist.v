@@ -0,0 +1,54 @@
+module top(ck,rst_n,se,te,en,si,a,b,q,co,so,z);
+   input ck;
+   input rst_n;
+   input se;
+   input te;
+   input en;
+   input si;
+   input [3:0]a;
+   input [3:0]b;
+   output [3:0]q;
+   output co;
+   output so;
+   output z;
+   wire gck;
+   wire c1;
+   wire s0;
+   wire zero;
+   wire x;
+  CLKGATETST_X1 cg (.CK(ck), .E(en), .SE(te), .GCK(gck));
+  slice u0 (.ck(gck), .rst_n(rst_n), .se(se), .si(si), .a({a[1],a[0]}), .b({b[1],
+      b[0]}), .ci(zero), .q({q[1],q[0]}), .co(c1), .so(s0));
+  slice u1 (.ck(gck), .rst_n(rst_n), .se(se), .si(s0), .a({a[3],a[2]}), .b({b[3],
+      b[2]}), .ci(c1), .q({q[3],q[2]}), .co(co), .so(so));
+  LOGIC0_X1 tie0 (.Z(zero));
+  AND2_X1 g0 (.A1(q[0]), .A2(zero), .ZN(x));
+  OR2_X1 g1 (.A1(x), .A2(q[3]), .ZN(z));
+endmodule
+
+module slice(ck,rst_n,se,si,a,b,ci,q,co,so);
+   input ck;
+   input rst_n;
+   input se;
+   input si;
+   input [1:0]a;
+   input [1:0]b;
+   input ci;
+   output [1:0]q;
+   output co;
+   output so;
+   wire c0;
+   wire [1:0]s;
+   wire n0;
+   wire n1;
+   wire dead;
+  assign so = q[1];
+  FA_X1 add0 (.A(a[0]), .B(b[0]), .CI(ci), .CO(c0), .S(s[0]));
+  FA_X1 add1 (.A(a[1]), .B(b[1]), .CI(c0), .CO(co), .S(s[1]));
+  SDFFR_X1 r0 (.CK(ck), .D(s[0]), .RN(rst_n), .SE(se), .SI(si), .Q(q[0]), .QN());
+  SDFFR_X1 r1 (.CK(ck), .D(s[1]), .RN(rst_n), .SE(se), .SI(q[0]), .Q(q[1]), .QN());
+  NAND2_X1 d0 (.A1(a[0]), .A2(b[0]), .ZN(n0));
+  NAND2_X1 d1 (.A1(a[0]), .A2(b[0]), .ZN(n1));
+  AND2_X1 d2 (.A1(n0), .A2(n1), .ZN(dead));
+endmodule
+
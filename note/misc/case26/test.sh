@@ -0,0 +1,16 @@
+#########################################################################
+# File Name: test.sh
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+#This is an adder of two slices with a scan chain, gated clock and tie cells,
+#which is flattened through spill files by --flatten-spill-dir.
+#!/bin/bash
+rm -f HierNetlist.v* FlatNetlist.v*
+mkdir -p spill
+../../../bin/verilator scan_adder.v ../LibBlackbox.v --xml-only --flatten-spill-dir spill
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case26,$hier." && error=true
+[ "$flat" ] && echo "In case26,$flat." && error=true
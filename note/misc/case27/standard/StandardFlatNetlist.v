@@ -0,0 +1,51 @@
+module top(ck,rst_n,se,te,en,si,a,b,q,co,so,z);
+   input ck;
+   input rst_n;
+   input se;
+   input te;
+   input en;
+   input si;
+   input [3:0]a;
+   input [3:0]b;
+   output [3:0]q;
+   output co;
+   output so;
+   output z;
+   wire n1;
+   wire n2;
+   wire n3;
+   wire n4;
+   wire n5;
+   wire n6;
+   wire [1:0]n7;
+   wire n8;
+   wire n9;
+   wire n10;
+   wire n11;
+   wire [1:0]n12;
+   wire n13;
+   wire n14;
+   wire n15;
+  assign n3 = q[1];
+  assign so = q[3];
+  CLKGATETST_X1 i16 (.CK(ck), .E(en), .SE(te), .GCK(n1));
+  FA_X1 i17 (.A(a[0]), .B(b[0]), .CI(n4), .CO(n6), .S(n7[0]));
+  FA_X1 i18 (.A(a[1]), .B(b[1]), .CI(n6), .CO(n2), .S(n7[1]));
+  SDFFR_X1 i19 (.CK(n1), .D(n7[0]), .RN(rst_n), .SE(se), .SI(si), .Q(q[0]), .QN());
+  SDFFR_X1 i20 (.CK(n1), .D(n7[1]), .RN(rst_n), .SE(se), .SI(q[0]), .Q(q[1]), .QN());
+  NAND2_X1 i21 (.A1(a[0]), .A2(b[0]), .ZN(n8));
+  NAND2_X1 i22 (.A1(a[0]), .A2(b[0]), .ZN(n9));
+  AND2_X1 i23 (.A1(n8), .A2(n9), .ZN(n10));
+  FA_X1 i24 (.A(a[2]), .B(b[2]), .CI(n2), .CO(n11), .S(n12[0]));
+  FA_X1 i25 (.A(a[3]), .B(b[3]), .CI(n11), .CO(co), .S(n12[1]));
+  SDFFR_X1 i26 (.CK(n1), .D(n12[0]), .RN(rst_n), .SE(se), .SI(n3), .Q(q[2]), .QN());
+  SDFFR_X1 i27 (.CK(n1), .D(n12[1]), .RN(rst_n), .SE(se), .SI(q[2]), .Q(q[3]), 
+      .QN());
+  NAND2_X1 i28 (.A1(a[2]), .A2(b[2]), .ZN(n13));
+  NAND2_X1 i29 (.A1(a[2]), .A2(b[2]), .ZN(n14));
+  AND2_X1 i30 (.A1(n13), .A2(n14), .ZN(n15));
+  LOGIC0_X1 i31 (.Z(n4));
+  AND2_X1 i32 (.A1(q[0]), .A2(n4), .ZN(n5));
+  OR2_X1 i33 (.A1(n5), .A2(q[3]), .ZN(z));
+endmodule
+
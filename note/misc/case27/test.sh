@@ -0,0 +1,19 @@
+#########################################################################
+# File Name: test.sh
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+#This is an adder of two slices with a scan chain, gated clock and tie cells,
+#whose flattened names are mapped to short ones by --flatten-name-map.
+#!/bin/bash
+rm -f HierNetlist.v* FlatNetlist.v* FlatNameMap.txt
+../../../bin/verilator scan_adder.v ../LibBlackbox.v --xml-only --flatten-name-map FlatNameMap.txt
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case27,$hier." && error=true
+[ "$flat" ] && echo "In case27,$flat." && error=true
+for file in FlatNameMap.txt; do
+  report=`diff -bqBH $file standard/$file 2>&1`
+  [ "$report" ] && echo "In case27,$report." && error=true
+done
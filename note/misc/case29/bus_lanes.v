@@ -0,0 +1,72 @@
+module regfile(we, wa, wd, rd);
+  input we;
+  input [3:0] wa;
+  input [7:0] wd;
+  output [7:0] rd;
+endmodule
+
+module lane(a, b, c, y, z, r, rd);
+  input [3:0] a;
+  input [3:0] b;
+  input [2:0] c;
+  output [3:0] y;
+  output [3:0] z;
+  output [3:0] r;
+  output [7:0] rd;
+  wire [3:0] \data.q ;
+  INV_X1 i0 (.A(a[0]), .ZN(\data.q [0]));
+  INV_X1 i1 (.A(a[1]), .ZN(\data.q [1]));
+  INV_X1 i2 (.A(a[2]), .ZN(\data.q [2]));
+  INV_X1 i3 (.A(a[3]), .ZN(\data.q [3]));
+  assign y[0] = \data.q [0];
+  assign y[1] = \data.q [1];
+  assign y[2] = \data.q [2];
+  assign y[3] = \data.q [3];
+  assign z[3] = b[3];
+  assign z[2] = b[2];
+  assign z[1] = b[1];
+  assign z[0] = b[0];
+  assign r[0] = b[3];
+  assign r[1] = b[2];
+  assign r[2] = b[1];
+  assign r[3] = b[0];
+  regfile rf (.we(1'b1), .wa({\data.q [3], \data.q [2], 1'bx, 1'bx}),
+    .wd({c[2], c[1], c[0], 1'b0, 1'b0, 1'b0, 1'b0, 1'b0}),
+    .rd({rd[7], rd[6], rd[5], rd[4], rd[3], rd[2], rd[1], rd[0]}));
+endmodule
+
+module top(a, b, y, z, r, k, m, n, rd0, rd1);
+  input [7:0] a;
+  input [7:0] b;
+  output [7:0] y;
+  output [7:0] z;
+  output [7:0] r;
+  output [7:0] k;
+  output [3:0] m;
+  output [2:0] n;
+  output [7:0] rd0;
+  output [7:0] rd1;
+  lane u0 (.a({a[3], a[2], a[1], a[0]}), .b({b[3], b[2], b[1], b[0]}),
+    .c({1'b1, 1'b0, 1'bx}), .y({y[3], y[2], y[1], y[0]}),
+    .z({z[3], z[2], z[1], z[0]}), .r({r[3], r[2], r[1], r[0]}),
+    .rd({rd0[7], rd0[6], rd0[5], rd0[4], rd0[3], rd0[2], rd0[1], rd0[0]}));
+  lane u1 (.a({a[4], a[5], a[6], a[7]}), .b({b[7], b[6], b[5], b[4]}),
+    .c({1'b1, 1'b1, 1'b1}), .y({y[7], y[6], y[5], y[4]}),
+    .z({z[7], z[6], z[5], z[4]}), .r({r[7], r[6], r[5], r[4]}),
+    .rd({rd1[7], rd1[6], rd1[5], rd1[4], rd1[3], rd1[2], rd1[1], rd1[0]}));
+  assign k[0] = 1'b1;
+  assign k[1] = 1'b1;
+  assign k[2] = 1'b1;
+  assign k[3] = 1'b1;
+  assign k[4] = 1'b1;
+  assign k[5] = 1'b1;
+  assign k[6] = 1'b1;
+  assign k[7] = 1'b1;
+  assign m[3] = 1'bx;
+  assign m[2] = 1'bx;
+  assign m[1] = 1'bx;
+  assign m[0] = 1'bx;
+  assign n[2] = 1'b0;
+  assign n[1] = 1'bx;
+  assign n[0] = 1'b1;
+endmodule
@@ -0,0 +1,48 @@
+module regfile(we,wa,wd,rd);
+   input we;
+   input [3:0]wa;
+   input [7:0]wd;
+   output [7:0]rd;
+endmodule
+
+module top(a,b,y,z,r,k,m,n,rd0,rd1);
+   input [7:0]a;
+   input [7:0]b;
+   output [7:0]y;
+   output [7:0]z;
+   output [7:0]r;
+   output [7:0]k;
+   output [3:0]m;
+   output [2:0]n;
+   output [7:0]rd0;
+   output [7:0]rd1;
+   wire [3:0]\u0/data.q ;
+   wire [3:0]\u1/data.q ;
+  assign k = 8'hff;
+  assign m = 4'bx;
+  assign n = 3'b0x1;
+  assign y[3:0] = \u0/data.q ;
+  assign z[3:0] = b[3:0];
+  assign r[0] = b[3];
+  assign r[1] = b[2];
+  assign r[2] = b[1];
+  assign r[3] = b[0];
+  assign y[7:4] = \u1/data.q ;
+  assign z[7:4] = b[7:4];
+  assign r[4] = b[7];
+  assign r[5] = b[6];
+  assign r[6] = b[5];
+  assign r[7] = b[4];
+  INV_X1 u0/i0 (.A(a[0]), .ZN(\u0/data.q [0]));
+  INV_X1 u0/i1 (.A(a[1]), .ZN(\u0/data.q [1]));
+  INV_X1 u0/i2 (.A(a[2]), .ZN(\u0/data.q [2]));
+  INV_X1 u0/i3 (.A(a[3]), .ZN(\u0/data.q [3]));
+  regfile u0/rf (.we(1'b1), .wa({\u0/data.q [3:2],2'bx}), .wd(8'b10x00000), .rd(
+      rd0));
+  INV_X1 u1/i0 (.A(a[7]), .ZN(\u1/data.q [0]));
+  INV_X1 u1/i1 (.A(a[6]), .ZN(\u1/data.q [1]));
+  INV_X1 u1/i2 (.A(a[5]), .ZN(\u1/data.q [2]));
+  INV_X1 u1/i3 (.A(a[4]), .ZN(\u1/data.q [3]));
+  regfile u1/rf (.we(1'b1), .wa({\u1/data.q [3:2],2'bx}), .wd(8'he0), .rd(rd1));
+endmodule
+
@@ -0,0 +1,49 @@
+module regfile(we,wa,wd,rd);
+   input we;
+   input [3:0]wa;
+   input [7:0]wd;
+   output [7:0]rd;
+endmodule
+
+module top(a,b,y,z,r,k,m,n,rd0,rd1);
+   input [7:0]a;
+   input [7:0]b;
+   output [7:0]y;
+   output [7:0]z;
+   output [7:0]r;
+   output [7:0]k;
+   output [3:0]m;
+   output [2:0]n;
+   output [7:0]rd0;
+   output [7:0]rd1;
+  assign k = 8'hff;
+  assign m = 4'bx;
+  assign n = 3'b0x1;
+  lane u0 (.a(a[3:0]), .b(b[3:0]), .c(3'b10x), .y(y[3:0]), .z(z[3:0]), .r(r[3:0]), 
+      .rd(rd0));
+  lane u1 (.a({a[4],a[5],a[6],a[7]}), .b(b[7:4]), .c(3'h7), .y(y[7:4]), .z(
+      z[7:4]), .r(r[7:4]), .rd(rd1));
+endmodule
+
+module lane(a,b,c,y,z,r,rd);
+   input [3:0]a;
+   input [3:0]b;
+   input [2:0]c;
+   output [3:0]y;
+   output [3:0]z;
+   output [3:0]r;
+   output [7:0]rd;
+   wire [3:0]\data.q ;
+  assign y = \data.q ;
+  assign z = b;
+  assign r[0] = b[3];
+  assign r[1] = b[2];
+  assign r[2] = b[1];
+  assign r[3] = b[0];
+  INV_X1 i0 (.A(a[0]), .ZN(\data.q [0]));
+  INV_X1 i1 (.A(a[1]), .ZN(\data.q [1]));
+  INV_X1 i2 (.A(a[2]), .ZN(\data.q [2]));
+  INV_X1 i3 (.A(a[3]), .ZN(\data.q [3]));
+  regfile rf (.we(1'b1), .wa({\data.q [3:2],2'bx}), .wd({c,5'h0}), .rd(rd));
+endmodule
+
@@ -0,0 +1,20 @@
+#########################################################################
+# File Name: test.sh
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+#These are two lanes of buses with wide, descending and reversed assign statements,
+#constant-tied buses and an escaped bus name, whose bits are printed as part
+#selects and multi-bit constants by --netlist-group-buses.
+#!/bin/bash
+rm -f HierNetlist.v FlatNetlist.v NetlistDiff.txt
+../../../bin/verilator bus_lanes.v ../LibBlackbox.v --xml-only --netlist-group-buses \
+  --netlist-diff-hier standard/StandardHierNetlist.v \
+  --netlist-diff-flat standard/StandardFlatNetlist.v
+diffs=`grep -v "^//" NetlistDiff.txt 2>&1`
+[ "$diffs" ] && echo "In case29, netlists differ, see NetlistDiff.txt." && error=true
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case29,$hier." && error=true
+[ "$flat" ] && echo "In case29,$flat." && error=true
@@ -0,0 +1,23 @@
+#########################################################################
+# File Name: test.sh
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+#This is an adder of two slices with a scan chain, gated clock and tie cells,
+#which is written as BLIF and AIGER by --netlist-blif and --netlist-aiger.
+#!/bin/bash
+rm -f HierNetlist.v FlatNetlist.v NetlistDiff.txt scan_adder.blif scan_adder.aig
+../../../bin/verilator scan_adder.v ../LibBlackbox.v --xml-only --netlist-blif scan_adder.blif --netlist-aiger scan_adder.aig \
+  --netlist-diff-hier standard/StandardHierNetlist.v \
+  --netlist-diff-flat standard/StandardFlatNetlist.v
+diffs=`grep -v "^//" NetlistDiff.txt 2>&1`
+[ "$diffs" ] && echo "In case30, netlists differ, see NetlistDiff.txt." && error=true
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case30,$hier." && error=true
+[ "$flat" ] && echo "In case30,$flat." && error=true
+for file in scan_adder.blif scan_adder.aig; do
+  report=`diff -bqBH $file standard/$file 2>&1`
+  [ "$report" ] && echo "In case30,$report." && error=true
+done
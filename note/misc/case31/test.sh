@@ -0,0 +1,23 @@
+#########################################################################
+# File Name: test.sh
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+#This is an adder of two slices with a scan chain, gated clock and tie cells,
+#which is written as a hypergraph by --netlist-hgr and --netlist-hgr-csr.
+#!/bin/bash
+rm -f HierNetlist.v FlatNetlist.v NetlistDiff.txt scan_adder.hgr scan_adder.csr
+../../../bin/verilator scan_adder.v ../LibBlackbox.v --xml-only --netlist-hgr scan_adder.hgr --netlist-hgr-csr scan_adder.csr \
+  --netlist-diff-hier standard/StandardHierNetlist.v \
+  --netlist-diff-flat standard/StandardFlatNetlist.v
+diffs=`grep -v "^//" NetlistDiff.txt 2>&1`
+[ "$diffs" ] && echo "In case31, netlists differ, see NetlistDiff.txt." && error=true
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case31,$hier." && error=true
+[ "$flat" ] && echo "In case31,$flat." && error=true
+for file in scan_adder.hgr scan_adder.csr; do
+  report=`diff -bqBH $file standard/$file 2>&1`
+  [ "$report" ] && echo "In case31,$report." && error=true
+done
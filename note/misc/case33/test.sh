@@ -0,0 +1,23 @@
+#########################################################################
+# File Name: test.sh
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+#This is an adder of two slices with a scan chain, gated clock and tie cells,
+#whose netlists are also written as JSON by --netlist-json.
+#!/bin/bash
+rm -f HierNetlist.v FlatNetlist.v NetlistDiff.txt HierNetlist.json FlatNetlist.json
+../../../bin/verilator scan_adder.v ../LibBlackbox.v --xml-only --netlist-json \
+  --netlist-diff-hier standard/StandardHierNetlist.v \
+  --netlist-diff-flat standard/StandardFlatNetlist.v
+diffs=`grep -v "^//" NetlistDiff.txt 2>&1`
+[ "$diffs" ] && echo "In case33, netlists differ, see NetlistDiff.txt." && error=true
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case33,$hier." && error=true
+[ "$flat" ] && echo "In case33,$flat." && error=true
+for file in HierNetlist.json FlatNetlist.json; do
+  report=`diff -bqBH $file standard/$file 2>&1`
+  [ "$report" ] && echo "In case33,$report." && error=true
+done
@@ -0,0 +1,19 @@
+module top(ck, se, si, so, to);
+  input ck;
+  input se;
+  input si;
+  output so;
+  output to;
+  wire q0;
+  wire l0;
+  wire l1;
+  wire l2;
+  wire t0;
+  SDFF_X1 f0 (.CK(ck), .D(si), .SE(se), .SI(si), .Q(q0));
+  SDFF_X1 f1 (.CK(ck), .D(q0), .SE(se), .SI(q0), .Q(so));
+  SDFF_X1 a0 (.CK(ck), .D(l2), .SE(se), .SI(l2), .Q(l0));
+  SDFF_X1 a1 (.CK(ck), .D(l0), .SE(se), .SI(l0), .Q(l1));
+  SDFF_X1 a2 (.CK(ck), .D(l1), .SE(se), .SI(l1), .Q(l2));
+  SDFF_X1 b0 (.CK(ck), .D(l2), .SE(se), .SI(l2), .Q(t0));
+  SDFF_X1 b1 (.CK(ck), .D(t0), .SE(se), .SI(t0), .Q(to));
+endmodule
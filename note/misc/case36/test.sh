@@ -0,0 +1,23 @@
+#########################################################################
+# File Name: test.sh
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+#This has an ok scan chain, and a scan loop with a branching tail, which are
+#reported by --netlist-scan-chains.
+#!/bin/bash
+rm -f HierNetlist.v FlatNetlist.v NetlistDiff.txt ScanChains.txt top_chain0.txt top_chain1.txt top_chain2.txt
+../../../bin/verilator scan_loop.v ../LibBlackbox.v --xml-only --netlist-scan-chains . \
+  --netlist-diff-hier standard/StandardHierNetlist.v \
+  --netlist-diff-flat standard/StandardFlatNetlist.v
+diffs=`grep -v "^//" NetlistDiff.txt 2>&1`
+[ "$diffs" ] && echo "In case36, netlists differ, see NetlistDiff.txt." && error=true
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case36,$hier." && error=true
+[ "$flat" ] && echo "In case36,$flat." && error=true
+for file in ScanChains.txt top_chain0.txt top_chain1.txt top_chain2.txt; do
+  report=`diff -bqBH $file standard/$file 2>&1`
+  [ "$report" ] && echo "In case36,$report." && error=true
+done
@@ -0,0 +1,45 @@
+module top_fanin_cone0(gck,\u1/s[1] ,rst_n,se,\q[2] ,\u0/s[0] ,si,z,\q[3] ,\q[0] ,
+      zero);
+   input gck;
+   input \u1/s[1] ;
+   input rst_n;
+   input se;
+   input \q[2] ;
+   input \u0/s[0] ;
+   input si;
+   output z;
+   output \q[3] ;
+   output \q[0] ;
+   output zero;
+   wire x;
+  OR2_X1 g1 (.A1(x), .A2(\q[3] ), .ZN(z));
+  AND2_X1 g0 (.A1(\q[0] ), .A2(zero), .ZN(x));
+  SDFFR_X1 u1/r1 (.CK(gck), .D(\u1/s[1] ), .RN(rst_n), .SE(se), .SI(\q[2] ), .Q(
+      \q[3] ), .QN());
+  SDFFR_X1 u0/r0 (.CK(gck), .D(\u0/s[0] ), .RN(rst_n), .SE(se), .SI(si), .Q(\q[0] ), 
+      .QN());
+  LOGIC0_X1 tie0 (.Z(zero));
+endmodule
+
+module top_fanout_cone1(gck,\u0/s[0] ,rst_n,se,si,\u0/s[1] ,zero,\q[3] ,\q[0] ,
+      \q[1] ,z);
+   input gck;
+   input \u0/s[0] ;
+   input rst_n;
+   input se;
+   input si;
+   input \u0/s[1] ;
+   input zero;
+   input \q[3] ;
+   output \q[0] ;
+   output \q[1] ;
+   output z;
+   wire x;
+  SDFFR_X1 u0/r0 (.CK(gck), .D(\u0/s[0] ), .RN(rst_n), .SE(se), .SI(si), .Q(\q[0] ), 
+      .QN());
+  SDFFR_X1 u0/r1 (.CK(gck), .D(\u0/s[1] ), .RN(rst_n), .SE(se), .SI(\q[0] ), .Q(
+      \q[1] ), .QN());
+  AND2_X1 g0 (.A1(\q[0] ), .A2(zero), .ZN(x));
+  OR2_X1 g1 (.A1(x), .A2(\q[3] ), .ZN(z));
+endmodule
+
@@ -0,0 +1,33 @@
+#########################################################################
+# File Name: test.sh
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+#This is a design of three levels of modules, which is generated by
+#note/bench/gen_netlist.py --depth 3 --children 3 --cells 12 --bus-width 4
+#--dff-ratio 0.2 --seed 7 with buses split into bits. It is flattened and
+#analyzed with one and four threads of --netlist-threads, whose outputs must be
+#the same.
+#!/bin/bash
+rm -rf threads1 HierNetlist.v FlatNetlist.v StrashReport.txt TimingReport.txt \
+  PowerReport.txt
+mkdir threads1
+cd threads1
+../../../../bin/verilator ../levels.v ../../LibBlackbox.v --xml-only --strash \
+  --netlist-timing 3 --netlist-power --netlist-threads 1
+cd ..
+../../../bin/verilator levels.v ../LibBlackbox.v --xml-only --strash \
+  --netlist-timing 3 --netlist-power --netlist-threads 4
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case39,$hier." && error=true
+[ "$flat" ] && echo "In case39,$flat." && error=true
+for file in StrashReport.txt TimingReport.txt PowerReport.txt; do
+  report=`diff -bqBH $file standard/$file 2>&1`
+  [ "$report" ] && echo "In case39,$report." && error=true
+done
+for file in FlatNetlist.v StrashReport.txt TimingReport.txt PowerReport.txt; do
+  report=`diff -q $file threads1/$file 2>&1`
+  [ "$report" ] && echo "In case39,$report." && error=true
+done
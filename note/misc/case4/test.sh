@@ -6,8 +6,13 @@
 #########################################################################
 #This an example to test effect of the vector range, like a[l:r], l > r or l < r
 #!/bin/bash
-../../../bin/verilator vector_order.v ../LibBlackbox.v --xml-only -Wno-litendian
-hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v`
-flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v`
-[ $hier ] && echo "In case4,$hier." && error=true
-[ $flat ] && echo "In case4,$flat." && error=true
+rm -f HierNetlist.v FlatNetlist.v NetlistDiff.txt
+../../../bin/verilator vector_order.v ../LibBlackbox.v --xml-only -Wno-litendian \
+  --netlist-diff-hier standard/StandardHierNetlist.v \
+  --netlist-diff-flat standard/StandardFlatNetlist.v
+diffs=`grep -v "^//" NetlistDiff.txt 2>&1`
+[ "$diffs" ] && echo "In case4, netlists differ, see NetlistDiff.txt." && error=true
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+[ "$hier" ] && echo "In case4,$hier." && error=true
+[ "$flat" ] && echo "In case4,$flat." && error=true
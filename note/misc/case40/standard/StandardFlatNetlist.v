@@ -0,0 +1,289 @@
+module top(clk,rst_n,din,dout);
+   input clk;
+   input rst_n;
+   input [3:0]din;
+   output [3:0]dout;
+   wire [3:0]b0;
+   wire [3:0]b1;
+   wire [3:0]b2;
+   wire [3:0]u0/b0;
+   wire [3:0]u0/b1;
+   wire [3:0]u0/b2;
+   wire [3:0]u0/u1/b0;
+   wire [3:0]u0/u1/b1;
+   wire [3:0]u0/u1/b2;
+   wire [7:0]u0/u1/u0/n;
+   wire [7:0]u0/u1/u1/n;
+   wire [7:0]u0/u1/u2/n;
+   wire [3:0]u1/b0;
+   wire [3:0]u1/b1;
+   wire [3:0]u1/b2;
+   wire [3:0]u1/u1/b0;
+   wire [3:0]u1/u1/b1;
+   wire [3:0]u1/u1/b2;
+   wire [7:0]u1/u1/u0/n;
+   wire [7:0]u1/u1/u1/n;
+   wire [7:0]u1/u1/u2/n;
+   wire [3:0]u2/b0;
+   wire [3:0]u2/b1;
+   wire [3:0]u2/b2;
+   wire [3:0]u2/u1/b0;
+   wire [3:0]u2/u1/b1;
+   wire [3:0]u2/u1/b2;
+   wire [7:0]u2/u1/u0/n;
+   wire [7:0]u2/u1/u1/n;
+   wire [7:0]u2/u1/u2/n;
+  blk_l2_v0 u0/u0 (.clk(clk), .rst_n(rst_n), .din({din[3],din[2],din[1],din[0]}), 
+      .dout({u0/b0[3],u0/b0[2],u0/b0[1],u0/b0[0]}));
+  NAND2_X1_LVT u0/u1/u0/c0 (.A1(u0/b0[0]), .A2(u0/b0[0]), .ZN(u0/u1/u0/n[0]));
+  INV_X1_LVT u0/u1/u0/c1 (.A(u0/b0[1]), .ZN(u0/u1/u0/n[1]));
+  DFFR_X1_LVT u0/u1/u0/c2 (.CK(clk), .D(u0/b0[0]), .RN(rst_n), .Q(u0/u1/u0/n[2]), 
+      .QN());
+  MUX2_X1_LVT u0/u1/u0/c3 (.A(u0/u1/u0/n[0]), .B(u0/b0[1]), .S(u0/u1/u0/n[0]), .Z(
+      u0/u1/u0/n[3]));
+  MUX2_X1_LVT u0/u1/u0/c4 (.A(1'b0), .B(1'b0), .S(u0/b0[2]), .Z(u0/u1/u0/n[4]));
+  XOR2_X1_LVT u0/u1/u0/c5 (.A(u0/b0[2]), .B(u0/b0[3]), .Z(u0/u1/u0/n[5]));
+  INV_X1_LVT u0/u1/u0/c6 (.A(u0/u1/u0/n[5]), .ZN(u0/u1/u0/n[6]));
+  MUX2_X1_LVT u0/u1/u0/c7 (.A(u0/u1/u0/n[3]), .B(u0/u1/u0/n[3]), .S(u0/b0[3]), 
+      .Z(u0/u1/u0/n[7]));
+  NAND2_X1_LVT u0/u1/u0/c8 (.A1(u0/u1/u0/n[0]), .A2(u0/u1/u0/n[1]), .ZN(
+      u0/u1/b0[0]));
+  XOR2_X1_LVT u0/u1/u0/c9 (.A(u0/b0[1]), .B(u0/u1/u0/n[2]), .Z(u0/u1/b0[1]));
+  DFFR_X1_LVT u0/u1/u0/c10 (.CK(clk), .D(u0/u1/u0/n[3]), .RN(rst_n), .Q(
+      u0/u1/b0[2]), .QN());
+  INV_X1_LVT u0/u1/u0/c11 (.A(u0/u1/u0/n[5]), .ZN(u0/u1/b0[3]));
+  XOR2_X1_LVT u0/u1/u1/c0 (.A(u0/u1/b0[2]), .B(u0/u1/b0[3]), .Z(u0/u1/u1/n[0]));
+  DFFR_X1_LVT u0/u1/u1/c1 (.CK(clk), .D(u0/u1/b0[2]), .RN(rst_n), .Q(
+      u0/u1/u1/n[1]), .QN());
+  INV_X1_LVT u0/u1/u1/c2 (.A(u0/u1/u1/n[1]), .ZN(u0/u1/u1/n[2]));
+  MUX2_X1_LVT u0/u1/u1/c3 (.A(u0/u1/b0[3]), .B(u0/u1/b0[2]), .S(1'b1), .Z(
+      u0/u1/u1/n[3]));
+  INV_X1_LVT u0/u1/u1/c4 (.A(u0/u1/b0[3]), .ZN(u0/u1/u1/n[4]));
+  AND2_X1_LVT u0/u1/u1/c5 (.A1(u0/u1/u1/n[2]), .A2(u0/u1/u1/n[3]), .ZN(
+      u0/u1/u1/n[5]));
+  DFFR_X1_LVT u0/u1/u1/c6 (.CK(clk), .D(u0/u1/u1/n[4]), .RN(rst_n), .Q(
+      u0/u1/u1/n[6]), .QN());
+  NAND2_X1_LVT u0/u1/u1/c7 (.A1(u0/u1/u1/n[4]), .A2(u0/u1/u1/n[2]), .ZN(
+      u0/u1/u1/n[7]));
+  MUX2_X1_LVT u0/u1/u1/c8 (.A(u0/u1/b0[2]), .B(u0/u1/b0[2]), .S(u0/u1/b0[3]), .Z(
+      u0/u1/b1[0]));
+  DFFR_X1_LVT u0/u1/u1/c9 (.CK(clk), .D(u0/u1/b0[2]), .RN(rst_n), .Q(u0/u1/b1[1]), 
+      .QN());
+  INV_X1_LVT u0/u1/u1/c10 (.A(u0/u1/u1/n[4]), .ZN(u0/u1/b1[2]));
+  XOR2_X1_LVT u0/u1/u1/c11 (.A(u0/u1/u1/n[7]), .B(u0/u1/u1/n[5]), .Z(u0/u1/b1[3]));
+  NAND2_X1_LVT u0/u1/u2/c0 (.A1(u0/u1/b1[0]), .A2(u0/u1/b1[0]), .ZN(u0/u1/u2/n[0]));
+  INV_X1_LVT u0/u1/u2/c1 (.A(u0/u1/b1[1]), .ZN(u0/u1/u2/n[1]));
+  DFFR_X1_LVT u0/u1/u2/c2 (.CK(clk), .D(u0/u1/b1[0]), .RN(rst_n), .Q(
+      u0/u1/u2/n[2]), .QN());
+  MUX2_X1_LVT u0/u1/u2/c3 (.A(u0/u1/u2/n[0]), .B(u0/u1/b1[1]), .S(u0/u1/u2/n[0]), 
+      .Z(u0/u1/u2/n[3]));
+  MUX2_X1_LVT u0/u1/u2/c4 (.A(1'b0), .B(1'b0), .S(u0/u1/b1[2]), .Z(u0/u1/u2/n[4]));
+  XOR2_X1_LVT u0/u1/u2/c5 (.A(u0/u1/b1[2]), .B(u0/u1/b1[3]), .Z(u0/u1/u2/n[5]));
+  INV_X1_LVT u0/u1/u2/c6 (.A(u0/u1/u2/n[5]), .ZN(u0/u1/u2/n[6]));
+  MUX2_X1_LVT u0/u1/u2/c7 (.A(u0/u1/u2/n[3]), .B(u0/u1/u2/n[3]), .S(u0/u1/b1[3]), 
+      .Z(u0/u1/u2/n[7]));
+  NAND2_X1_LVT u0/u1/u2/c8 (.A1(u0/u1/u2/n[0]), .A2(u0/u1/u2/n[1]), .ZN(
+      u0/u1/b2[0]));
+  XOR2_X1_LVT u0/u1/u2/c9 (.A(u0/u1/b1[1]), .B(u0/u1/u2/n[2]), .Z(u0/u1/b2[1]));
+  DFFR_X1_LVT u0/u1/u2/c10 (.CK(clk), .D(u0/u1/u2/n[3]), .RN(rst_n), .Q(
+      u0/u1/b2[2]), .QN());
+  INV_X1_LVT u0/u1/u2/c11 (.A(u0/u1/u2/n[5]), .ZN(u0/u1/b2[3]));
+  XOR2_X1_LVT u0/u1/g0 (.A(u0/u1/b2[0]), .B(u0/b0[0]), .Z(u0/b1[0]));
+  XOR2_X1_LVT u0/u1/g1 (.A(u0/u1/b2[1]), .B(u0/b0[1]), .Z(u0/b1[1]));
+  XOR2_X1_LVT u0/u1/g2 (.A(u0/u1/b2[2]), .B(u0/b0[2]), .Z(u0/b1[2]));
+  XOR2_X1_LVT u0/u1/g3 (.A(u0/u1/b2[3]), .B(u0/b0[3]), .Z(u0/b1[3]));
+  blk_l2_v0 u0/u2 (.clk(clk), .rst_n(rst_n), .din({u0/b1[3],u0/b1[2],u0/b1[1],
+      u0/b1[0]}), .dout({u0/b2[3],u0/b2[2],u0/b2[1],u0/b2[0]}));
+  XOR2_X1_LVT u0/g0 (.A(u0/b2[0]), .B(din[0]), .Z(b0[0]));
+  XOR2_X1_LVT u0/g1 (.A(u0/b2[1]), .B(din[1]), .Z(b0[1]));
+  XOR2_X1_LVT u0/g2 (.A(u0/b2[2]), .B(din[2]), .Z(b0[2]));
+  XOR2_X1_LVT u0/g3 (.A(u0/b2[3]), .B(din[3]), .Z(b0[3]));
+  blk_l2_v0 u1/u0 (.clk(clk), .rst_n(rst_n), .din({b0[3],b0[2],b0[1],b0[0]}), 
+      .dout({u1/b0[3],u1/b0[2],u1/b0[1],u1/b0[0]}));
+  NAND2_X1_LVT u1/u1/u0/c0 (.A1(u1/b0[0]), .A2(u1/b0[0]), .ZN(u1/u1/u0/n[0]));
+  INV_X1_LVT u1/u1/u0/c1 (.A(u1/b0[1]), .ZN(u1/u1/u0/n[1]));
+  DFFR_X1_LVT u1/u1/u0/c2 (.CK(clk), .D(u1/b0[0]), .RN(rst_n), .Q(u1/u1/u0/n[2]), 
+      .QN());
+  MUX2_X1_LVT u1/u1/u0/c3 (.A(u1/u1/u0/n[0]), .B(u1/b0[1]), .S(u1/u1/u0/n[0]), .Z(
+      u1/u1/u0/n[3]));
+  MUX2_X1_LVT u1/u1/u0/c4 (.A(1'b0), .B(1'b0), .S(u1/b0[2]), .Z(u1/u1/u0/n[4]));
+  XOR2_X1_LVT u1/u1/u0/c5 (.A(u1/b0[2]), .B(u1/b0[3]), .Z(u1/u1/u0/n[5]));
+  INV_X1_LVT u1/u1/u0/c6 (.A(u1/u1/u0/n[5]), .ZN(u1/u1/u0/n[6]));
+  MUX2_X1_LVT u1/u1/u0/c7 (.A(u1/u1/u0/n[3]), .B(u1/u1/u0/n[3]), .S(u1/b0[3]), 
+      .Z(u1/u1/u0/n[7]));
+  NAND2_X1_LVT u1/u1/u0/c8 (.A1(u1/u1/u0/n[0]), .A2(u1/u1/u0/n[1]), .ZN(
+      u1/u1/b0[0]));
+  XOR2_X1_LVT u1/u1/u0/c9 (.A(u1/b0[1]), .B(u1/u1/u0/n[2]), .Z(u1/u1/b0[1]));
+  DFFR_X1_LVT u1/u1/u0/c10 (.CK(clk), .D(u1/u1/u0/n[3]), .RN(rst_n), .Q(
+      u1/u1/b0[2]), .QN());
+  INV_X1_LVT u1/u1/u0/c11 (.A(u1/u1/u0/n[5]), .ZN(u1/u1/b0[3]));
+  XOR2_X1_LVT u1/u1/u1/c0 (.A(u1/u1/b0[2]), .B(u1/u1/b0[3]), .Z(u1/u1/u1/n[0]));
+  DFFR_X1_LVT u1/u1/u1/c1 (.CK(clk), .D(u1/u1/b0[2]), .RN(rst_n), .Q(
+      u1/u1/u1/n[1]), .QN());
+  INV_X1_LVT u1/u1/u1/c2 (.A(u1/u1/u1/n[1]), .ZN(u1/u1/u1/n[2]));
+  MUX2_X1_LVT u1/u1/u1/c3 (.A(u1/u1/b0[3]), .B(u1/u1/b0[2]), .S(1'b1), .Z(
+      u1/u1/u1/n[3]));
+  INV_X1_LVT u1/u1/u1/c4 (.A(u1/u1/b0[3]), .ZN(u1/u1/u1/n[4]));
+  AND2_X1_LVT u1/u1/u1/c5 (.A1(u1/u1/u1/n[2]), .A2(u1/u1/u1/n[3]), .ZN(
+      u1/u1/u1/n[5]));
+  DFFR_X1_LVT u1/u1/u1/c6 (.CK(clk), .D(u1/u1/u1/n[4]), .RN(rst_n), .Q(
+      u1/u1/u1/n[6]), .QN());
+  NAND2_X1_LVT u1/u1/u1/c7 (.A1(u1/u1/u1/n[4]), .A2(u1/u1/u1/n[2]), .ZN(
+      u1/u1/u1/n[7]));
+  MUX2_X1_LVT u1/u1/u1/c8 (.A(u1/u1/b0[2]), .B(u1/u1/b0[2]), .S(u1/u1/b0[3]), .Z(
+      u1/u1/b1[0]));
+  DFFR_X1_LVT u1/u1/u1/c9 (.CK(clk), .D(u1/u1/b0[2]), .RN(rst_n), .Q(u1/u1/b1[1]), 
+      .QN());
+  INV_X1_LVT u1/u1/u1/c10 (.A(u1/u1/u1/n[4]), .ZN(u1/u1/b1[2]));
+  XOR2_X1_LVT u1/u1/u1/c11 (.A(u1/u1/u1/n[7]), .B(u1/u1/u1/n[5]), .Z(u1/u1/b1[3]));
+  NAND2_X1_LVT u1/u1/u2/c0 (.A1(u1/u1/b1[0]), .A2(u1/u1/b1[0]), .ZN(u1/u1/u2/n[0]));
+  INV_X1_LVT u1/u1/u2/c1 (.A(u1/u1/b1[1]), .ZN(u1/u1/u2/n[1]));
+  DFFR_X1_LVT u1/u1/u2/c2 (.CK(clk), .D(u1/u1/b1[0]), .RN(rst_n), .Q(
+      u1/u1/u2/n[2]), .QN());
+  MUX2_X1_LVT u1/u1/u2/c3 (.A(u1/u1/u2/n[0]), .B(u1/u1/b1[1]), .S(u1/u1/u2/n[0]), 
+      .Z(u1/u1/u2/n[3]));
+  MUX2_X1_LVT u1/u1/u2/c4 (.A(1'b0), .B(1'b0), .S(u1/u1/b1[2]), .Z(u1/u1/u2/n[4]));
+  XOR2_X1_LVT u1/u1/u2/c5 (.A(u1/u1/b1[2]), .B(u1/u1/b1[3]), .Z(u1/u1/u2/n[5]));
+  INV_X1_LVT u1/u1/u2/c6 (.A(u1/u1/u2/n[5]), .ZN(u1/u1/u2/n[6]));
+  MUX2_X1_LVT u1/u1/u2/c7 (.A(u1/u1/u2/n[3]), .B(u1/u1/u2/n[3]), .S(u1/u1/b1[3]), 
+      .Z(u1/u1/u2/n[7]));
+  NAND2_X1_LVT u1/u1/u2/c8 (.A1(u1/u1/u2/n[0]), .A2(u1/u1/u2/n[1]), .ZN(
+      u1/u1/b2[0]));
+  XOR2_X1_LVT u1/u1/u2/c9 (.A(u1/u1/b1[1]), .B(u1/u1/u2/n[2]), .Z(u1/u1/b2[1]));
+  DFFR_X1_LVT u1/u1/u2/c10 (.CK(clk), .D(u1/u1/u2/n[3]), .RN(rst_n), .Q(
+      u1/u1/b2[2]), .QN());
+  INV_X1_LVT u1/u1/u2/c11 (.A(u1/u1/u2/n[5]), .ZN(u1/u1/b2[3]));
+  XOR2_X1_LVT u1/u1/g0 (.A(u1/u1/b2[0]), .B(u1/b0[0]), .Z(u1/b1[0]));
+  XOR2_X1_LVT u1/u1/g1 (.A(u1/u1/b2[1]), .B(u1/b0[1]), .Z(u1/b1[1]));
+  XOR2_X1_LVT u1/u1/g2 (.A(u1/u1/b2[2]), .B(u1/b0[2]), .Z(u1/b1[2]));
+  XOR2_X1_LVT u1/u1/g3 (.A(u1/u1/b2[3]), .B(u1/b0[3]), .Z(u1/b1[3]));
+  blk_l2_v0 u1/u2 (.clk(clk), .rst_n(rst_n), .din({u1/b1[3],u1/b1[2],u1/b1[1],
+      u1/b1[0]}), .dout({u1/b2[3],u1/b2[2],u1/b2[1],u1/b2[0]}));
+  XOR2_X1_LVT u1/g0 (.A(u1/b2[0]), .B(b0[0]), .Z(b1[0]));
+  XOR2_X1_LVT u1/g1 (.A(u1/b2[1]), .B(b0[1]), .Z(b1[1]));
+  XOR2_X1_LVT u1/g2 (.A(u1/b2[2]), .B(b0[2]), .Z(b1[2]));
+  XOR2_X1_LVT u1/g3 (.A(u1/b2[3]), .B(b0[3]), .Z(b1[3]));
+  blk_l2_v0 u2/u0 (.clk(clk), .rst_n(rst_n), .din({b1[3],b1[2],b1[1],b1[0]}), 
+      .dout({u2/b0[3],u2/b0[2],u2/b0[1],u2/b0[0]}));
+  NAND2_X1_LVT u2/u1/u0/c0 (.A1(u2/b0[0]), .A2(u2/b0[0]), .ZN(u2/u1/u0/n[0]));
+  INV_X1_LVT u2/u1/u0/c1 (.A(u2/b0[1]), .ZN(u2/u1/u0/n[1]));
+  DFFR_X1_LVT u2/u1/u0/c2 (.CK(clk), .D(u2/b0[0]), .RN(rst_n), .Q(u2/u1/u0/n[2]), 
+      .QN());
+  MUX2_X1_LVT u2/u1/u0/c3 (.A(u2/u1/u0/n[0]), .B(u2/b0[1]), .S(u2/u1/u0/n[0]), .Z(
+      u2/u1/u0/n[3]));
+  MUX2_X1_LVT u2/u1/u0/c4 (.A(1'b0), .B(1'b0), .S(u2/b0[2]), .Z(u2/u1/u0/n[4]));
+  XOR2_X1_LVT u2/u1/u0/c5 (.A(u2/b0[2]), .B(u2/b0[3]), .Z(u2/u1/u0/n[5]));
+  INV_X1_LVT u2/u1/u0/c6 (.A(u2/u1/u0/n[5]), .ZN(u2/u1/u0/n[6]));
+  MUX2_X1_LVT u2/u1/u0/c7 (.A(u2/u1/u0/n[3]), .B(u2/u1/u0/n[3]), .S(u2/b0[3]), 
+      .Z(u2/u1/u0/n[7]));
+  NAND2_X1_LVT u2/u1/u0/c8 (.A1(u2/u1/u0/n[0]), .A2(u2/u1/u0/n[1]), .ZN(
+      u2/u1/b0[0]));
+  XOR2_X1_LVT u2/u1/u0/c9 (.A(u2/b0[1]), .B(u2/u1/u0/n[2]), .Z(u2/u1/b0[1]));
+  DFFR_X1_LVT u2/u1/u0/c10 (.CK(clk), .D(u2/u1/u0/n[3]), .RN(rst_n), .Q(
+      u2/u1/b0[2]), .QN());
+  INV_X1_LVT u2/u1/u0/c11 (.A(u2/u1/u0/n[5]), .ZN(u2/u1/b0[3]));
+  XOR2_X1_LVT u2/u1/u1/c0 (.A(u2/u1/b0[2]), .B(u2/u1/b0[3]), .Z(u2/u1/u1/n[0]));
+  DFFR_X1_LVT u2/u1/u1/c1 (.CK(clk), .D(u2/u1/b0[2]), .RN(rst_n), .Q(
+      u2/u1/u1/n[1]), .QN());
+  INV_X1_LVT u2/u1/u1/c2 (.A(u2/u1/u1/n[1]), .ZN(u2/u1/u1/n[2]));
+  MUX2_X1_LVT u2/u1/u1/c3 (.A(u2/u1/b0[3]), .B(u2/u1/b0[2]), .S(1'b1), .Z(
+      u2/u1/u1/n[3]));
+  INV_X1_LVT u2/u1/u1/c4 (.A(u2/u1/b0[3]), .ZN(u2/u1/u1/n[4]));
+  AND2_X1_LVT u2/u1/u1/c5 (.A1(u2/u1/u1/n[2]), .A2(u2/u1/u1/n[3]), .ZN(
+      u2/u1/u1/n[5]));
+  DFFR_X1_LVT u2/u1/u1/c6 (.CK(clk), .D(u2/u1/u1/n[4]), .RN(rst_n), .Q(
+      u2/u1/u1/n[6]), .QN());
+  NAND2_X1_LVT u2/u1/u1/c7 (.A1(u2/u1/u1/n[4]), .A2(u2/u1/u1/n[2]), .ZN(
+      u2/u1/u1/n[7]));
+  MUX2_X1_LVT u2/u1/u1/c8 (.A(u2/u1/b0[2]), .B(u2/u1/b0[2]), .S(u2/u1/b0[3]), .Z(
+      u2/u1/b1[0]));
+  DFFR_X1_LVT u2/u1/u1/c9 (.CK(clk), .D(u2/u1/b0[2]), .RN(rst_n), .Q(u2/u1/b1[1]), 
+      .QN());
+  INV_X1_LVT u2/u1/u1/c10 (.A(u2/u1/u1/n[4]), .ZN(u2/u1/b1[2]));
+  XOR2_X1_LVT u2/u1/u1/c11 (.A(u2/u1/u1/n[7]), .B(u2/u1/u1/n[5]), .Z(u2/u1/b1[3]));
+  NAND2_X1_LVT u2/u1/u2/c0 (.A1(u2/u1/b1[0]), .A2(u2/u1/b1[0]), .ZN(u2/u1/u2/n[0]));
+  INV_X1_LVT u2/u1/u2/c1 (.A(u2/u1/b1[1]), .ZN(u2/u1/u2/n[1]));
+  DFFR_X1_LVT u2/u1/u2/c2 (.CK(clk), .D(u2/u1/b1[0]), .RN(rst_n), .Q(
+      u2/u1/u2/n[2]), .QN());
+  MUX2_X1_LVT u2/u1/u2/c3 (.A(u2/u1/u2/n[0]), .B(u2/u1/b1[1]), .S(u2/u1/u2/n[0]), 
+      .Z(u2/u1/u2/n[3]));
+  MUX2_X1_LVT u2/u1/u2/c4 (.A(1'b0), .B(1'b0), .S(u2/u1/b1[2]), .Z(u2/u1/u2/n[4]));
+  XOR2_X1_LVT u2/u1/u2/c5 (.A(u2/u1/b1[2]), .B(u2/u1/b1[3]), .Z(u2/u1/u2/n[5]));
+  INV_X1_LVT u2/u1/u2/c6 (.A(u2/u1/u2/n[5]), .ZN(u2/u1/u2/n[6]));
+  MUX2_X1_LVT u2/u1/u2/c7 (.A(u2/u1/u2/n[3]), .B(u2/u1/u2/n[3]), .S(u2/u1/b1[3]), 
+      .Z(u2/u1/u2/n[7]));
+  NAND2_X1_LVT u2/u1/u2/c8 (.A1(u2/u1/u2/n[0]), .A2(u2/u1/u2/n[1]), .ZN(
+      u2/u1/b2[0]));
+  XOR2_X1_LVT u2/u1/u2/c9 (.A(u2/u1/b1[1]), .B(u2/u1/u2/n[2]), .Z(u2/u1/b2[1]));
+  DFFR_X1_LVT u2/u1/u2/c10 (.CK(clk), .D(u2/u1/u2/n[3]), .RN(rst_n), .Q(
+      u2/u1/b2[2]), .QN());
+  INV_X1_LVT u2/u1/u2/c11 (.A(u2/u1/u2/n[5]), .ZN(u2/u1/b2[3]));
+  XOR2_X1_LVT u2/u1/g0 (.A(u2/u1/b2[0]), .B(u2/b0[0]), .Z(u2/b1[0]));
+  XOR2_X1_LVT u2/u1/g1 (.A(u2/u1/b2[1]), .B(u2/b0[1]), .Z(u2/b1[1]));
+  XOR2_X1_LVT u2/u1/g2 (.A(u2/u1/b2[2]), .B(u2/b0[2]), .Z(u2/b1[2]));
+  XOR2_X1_LVT u2/u1/g3 (.A(u2/u1/b2[3]), .B(u2/b0[3]), .Z(u2/b1[3]));
+  blk_l2_v0 u2/u2 (.clk(clk), .rst_n(rst_n), .din({u2/b1[3],u2/b1[2],u2/b1[1],
+      u2/b1[0]}), .dout({u2/b2[3],u2/b2[2],u2/b2[1],u2/b2[0]}));
+  XOR2_X1_LVT u2/g0 (.A(u2/b2[0]), .B(b1[0]), .Z(b2[0]));
+  XOR2_X1_LVT u2/g1 (.A(u2/b2[1]), .B(b1[1]), .Z(b2[1]));
+  XOR2_X1_LVT u2/g2 (.A(u2/b2[2]), .B(b1[2]), .Z(b2[2]));
+  XOR2_X1_LVT u2/g3 (.A(u2/b2[3]), .B(b1[3]), .Z(b2[3]));
+  XOR2_X1_LVT g0 (.A(b2[0]), .B(din[0]), .Z(dout[0]));
+  XOR2_X1_LVT g1 (.A(b2[1]), .B(din[1]), .Z(dout[1]));
+  XOR2_X1_LVT g2 (.A(b2[2]), .B(din[2]), .Z(dout[2]));
+  XOR2_X1_LVT g3 (.A(b2[3]), .B(din[3]), .Z(dout[3]));
+endmodule
+
+module blk_l2_v0(clk,rst_n,din,dout);
+   input clk;
+   input rst_n;
+   input [3:0]din;
+   output [3:0]dout;
+   wire [3:0]b0;
+   wire [3:0]b1;
+   wire [3:0]b2;
+   wire [7:0]u0/n;
+   wire [7:0]u1/n;
+   wire [7:0]u2/n;
+  NAND2_X1_LVT u0/c0 (.A1(din[0]), .A2(din[0]), .ZN(u0/n[0]));
+  INV_X1_LVT u0/c1 (.A(din[1]), .ZN(u0/n[1]));
+  DFFR_X1_LVT u0/c2 (.CK(clk), .D(din[0]), .RN(rst_n), .Q(u0/n[2]), .QN());
+  MUX2_X1_LVT u0/c3 (.A(u0/n[0]), .B(din[1]), .S(u0/n[0]), .Z(u0/n[3]));
+  MUX2_X1_LVT u0/c4 (.A(1'b0), .B(1'b0), .S(din[2]), .Z(u0/n[4]));
+  XOR2_X1_LVT u0/c5 (.A(din[2]), .B(din[3]), .Z(u0/n[5]));
+  INV_X1_LVT u0/c6 (.A(u0/n[5]), .ZN(u0/n[6]));
+  MUX2_X1_LVT u0/c7 (.A(u0/n[3]), .B(u0/n[3]), .S(din[3]), .Z(u0/n[7]));
+  NAND2_X1_LVT u0/c8 (.A1(u0/n[0]), .A2(u0/n[1]), .ZN(b0[0]));
+  XOR2_X1_LVT u0/c9 (.A(din[1]), .B(u0/n[2]), .Z(b0[1]));
+  DFFR_X1_LVT u0/c10 (.CK(clk), .D(u0/n[3]), .RN(rst_n), .Q(b0[2]), .QN());
+  INV_X1_LVT u0/c11 (.A(u0/n[5]), .ZN(b0[3]));
+  XOR2_X1_LVT u1/c0 (.A(b0[2]), .B(b0[3]), .Z(u1/n[0]));
+  DFFR_X1_LVT u1/c1 (.CK(clk), .D(b0[2]), .RN(rst_n), .Q(u1/n[1]), .QN());
+  INV_X1_LVT u1/c2 (.A(u1/n[1]), .ZN(u1/n[2]));
+  MUX2_X1_LVT u1/c3 (.A(b0[3]), .B(b0[2]), .S(1'b1), .Z(u1/n[3]));
+  INV_X1_LVT u1/c4 (.A(b0[3]), .ZN(u1/n[4]));
+  AND2_X1_LVT u1/c5 (.A1(u1/n[2]), .A2(u1/n[3]), .ZN(u1/n[5]));
+  DFFR_X1_LVT u1/c6 (.CK(clk), .D(u1/n[4]), .RN(rst_n), .Q(u1/n[6]), .QN());
+  NAND2_X1_LVT u1/c7 (.A1(u1/n[4]), .A2(u1/n[2]), .ZN(u1/n[7]));
+  MUX2_X1_LVT u1/c8 (.A(b0[2]), .B(b0[2]), .S(b0[3]), .Z(b1[0]));
+  DFFR_X1_LVT u1/c9 (.CK(clk), .D(b0[2]), .RN(rst_n), .Q(b1[1]), .QN());
+  INV_X1_LVT u1/c10 (.A(u1/n[4]), .ZN(b1[2]));
+  XOR2_X1_LVT u1/c11 (.A(u1/n[7]), .B(u1/n[5]), .Z(b1[3]));
+  NAND2_X1_LVT u2/c0 (.A1(b1[0]), .A2(b1[0]), .ZN(u2/n[0]));
+  INV_X1_LVT u2/c1 (.A(b1[1]), .ZN(u2/n[1]));
+  DFFR_X1_LVT u2/c2 (.CK(clk), .D(b1[0]), .RN(rst_n), .Q(u2/n[2]), .QN());
+  MUX2_X1_LVT u2/c3 (.A(u2/n[0]), .B(b1[1]), .S(u2/n[0]), .Z(u2/n[3]));
+  MUX2_X1_LVT u2/c4 (.A(1'b0), .B(1'b0), .S(b1[2]), .Z(u2/n[4]));
+  XOR2_X1_LVT u2/c5 (.A(b1[2]), .B(b1[3]), .Z(u2/n[5]));
+  INV_X1_LVT u2/c6 (.A(u2/n[5]), .ZN(u2/n[6]));
+  MUX2_X1_LVT u2/c7 (.A(u2/n[3]), .B(u2/n[3]), .S(b1[3]), .Z(u2/n[7]));
+  NAND2_X1_LVT u2/c8 (.A1(u2/n[0]), .A2(u2/n[1]), .ZN(b2[0]));
+  XOR2_X1_LVT u2/c9 (.A(b1[1]), .B(u2/n[2]), .Z(b2[1]));
+  DFFR_X1_LVT u2/c10 (.CK(clk), .D(u2/n[3]), .RN(rst_n), .Q(b2[2]), .QN());
+  INV_X1_LVT u2/c11 (.A(u2/n[5]), .ZN(b2[3]));
+  XOR2_X1_LVT g0 (.A(b2[0]), .B(din[0]), .Z(dout[0]));
+  XOR2_X1_LVT g1 (.A(b2[1]), .B(din[1]), .Z(dout[1]));
+  XOR2_X1_LVT g2 (.A(b2[2]), .B(din[2]), .Z(dout[2]));
+  XOR2_X1_LVT g3 (.A(b2[3]), .B(din[3]), .Z(dout[3]));
+endmodule
+
@@ -0,0 +1,140 @@
+module top(clk,rst_n,din,dout);
+   input clk;
+   input rst_n;
+   input [3:0]din;
+   output [3:0]dout;
+   wire [3:0]b0;
+   wire [3:0]b1;
+   wire [3:0]b2;
+  blk_l1_v0 u0 (.clk(clk), .rst_n(rst_n), .din({din[3],din[2],din[1],din[0]}), 
+      .dout({b0[3],b0[2],b0[1],b0[0]}));
+  blk_l1_v1 u1 (.clk(clk), .rst_n(rst_n), .din({b0[3],b0[2],b0[1],b0[0]}), .dout({
+      b1[3],b1[2],b1[1],b1[0]}));
+  blk_l1_v0 u2 (.clk(clk), .rst_n(rst_n), .din({b1[3],b1[2],b1[1],b1[0]}), .dout({
+      b2[3],b2[2],b2[1],b2[0]}));
+  XOR2_X1_LVT g0 (.A(b2[0]), .B(din[0]), .Z(dout[0]));
+  XOR2_X1_LVT g1 (.A(b2[1]), .B(din[1]), .Z(dout[1]));
+  XOR2_X1_LVT g2 (.A(b2[2]), .B(din[2]), .Z(dout[2]));
+  XOR2_X1_LVT g3 (.A(b2[3]), .B(din[3]), .Z(dout[3]));
+endmodule
+
+module blk_l1_v0(clk,rst_n,din,dout);
+   input clk;
+   input rst_n;
+   input [3:0]din;
+   output [3:0]dout;
+   wire [3:0]b0;
+   wire [3:0]b1;
+   wire [3:0]b2;
+  blk_l2_v0 u0 (.clk(clk), .rst_n(rst_n), .din({din[3],din[2],din[1],din[0]}), 
+      .dout({b0[3],b0[2],b0[1],b0[0]}));
+  blk_l2_v1 u1 (.clk(clk), .rst_n(rst_n), .din({b0[3],b0[2],b0[1],b0[0]}), .dout({
+      b1[3],b1[2],b1[1],b1[0]}));
+  blk_l2_v0 u2 (.clk(clk), .rst_n(rst_n), .din({b1[3],b1[2],b1[1],b1[0]}), .dout({
+      b2[3],b2[2],b2[1],b2[0]}));
+  XOR2_X1_LVT g0 (.A(b2[0]), .B(din[0]), .Z(dout[0]));
+  XOR2_X1_LVT g1 (.A(b2[1]), .B(din[1]), .Z(dout[1]));
+  XOR2_X1_LVT g2 (.A(b2[2]), .B(din[2]), .Z(dout[2]));
+  XOR2_X1_LVT g3 (.A(b2[3]), .B(din[3]), .Z(dout[3]));
+endmodule
+
+module blk_l1_v1(clk,rst_n,din,dout);
+   input clk;
+   input rst_n;
+   input [3:0]din;
+   output [3:0]dout;
+   wire [3:0]b0;
+   wire [3:0]b1;
+   wire [3:0]b2;
+  blk_l2_v0 u0 (.clk(clk), .rst_n(rst_n), .din({din[3],din[2],din[1],din[0]}), 
+      .dout({b0[3],b0[2],b0[1],b0[0]}));
+  blk_l2_v1 u1 (.clk(clk), .rst_n(rst_n), .din({b0[3],b0[2],b0[1],b0[0]}), .dout({
+      b1[3],b1[2],b1[1],b1[0]}));
+  blk_l2_v0 u2 (.clk(clk), .rst_n(rst_n), .din({b1[3],b1[2],b1[1],b1[0]}), .dout({
+      b2[3],b2[2],b2[1],b2[0]}));
+  XOR2_X1_LVT g0 (.A(b2[0]), .B(din[0]), .Z(dout[0]));
+  XOR2_X1_LVT g1 (.A(b2[1]), .B(din[1]), .Z(dout[1]));
+  XOR2_X1_LVT g2 (.A(b2[2]), .B(din[2]), .Z(dout[2]));
+  XOR2_X1_LVT g3 (.A(b2[3]), .B(din[3]), .Z(dout[3]));
+endmodule
+
+module blk_l2_v0(clk,rst_n,din,dout);
+   input clk;
+   input rst_n;
+   input [3:0]din;
+   output [3:0]dout;
+   wire [3:0]b0;
+   wire [3:0]b1;
+   wire [3:0]b2;
+  blk_l3_v0 u0 (.clk(clk), .rst_n(rst_n), .din({din[3],din[2],din[1],din[0]}), 
+      .dout({b0[3],b0[2],b0[1],b0[0]}));
+  blk_l3_v1 u1 (.clk(clk), .rst_n(rst_n), .din({b0[3],b0[2],b0[1],b0[0]}), .dout({
+      b1[3],b1[2],b1[1],b1[0]}));
+  blk_l3_v0 u2 (.clk(clk), .rst_n(rst_n), .din({b1[3],b1[2],b1[1],b1[0]}), .dout({
+      b2[3],b2[2],b2[1],b2[0]}));
+  XOR2_X1_LVT g0 (.A(b2[0]), .B(din[0]), .Z(dout[0]));
+  XOR2_X1_LVT g1 (.A(b2[1]), .B(din[1]), .Z(dout[1]));
+  XOR2_X1_LVT g2 (.A(b2[2]), .B(din[2]), .Z(dout[2]));
+  XOR2_X1_LVT g3 (.A(b2[3]), .B(din[3]), .Z(dout[3]));
+endmodule
+
+module blk_l2_v1(clk,rst_n,din,dout);
+   input clk;
+   input rst_n;
+   input [3:0]din;
+   output [3:0]dout;
+   wire [3:0]b0;
+   wire [3:0]b1;
+   wire [3:0]b2;
+  blk_l3_v0 u0 (.clk(clk), .rst_n(rst_n), .din({din[3],din[2],din[1],din[0]}), 
+      .dout({b0[3],b0[2],b0[1],b0[0]}));
+  blk_l3_v1 u1 (.clk(clk), .rst_n(rst_n), .din({b0[3],b0[2],b0[1],b0[0]}), .dout({
+      b1[3],b1[2],b1[1],b1[0]}));
+  blk_l3_v0 u2 (.clk(clk), .rst_n(rst_n), .din({b1[3],b1[2],b1[1],b1[0]}), .dout({
+      b2[3],b2[2],b2[1],b2[0]}));
+  XOR2_X1_LVT g0 (.A(b2[0]), .B(din[0]), .Z(dout[0]));
+  XOR2_X1_LVT g1 (.A(b2[1]), .B(din[1]), .Z(dout[1]));
+  XOR2_X1_LVT g2 (.A(b2[2]), .B(din[2]), .Z(dout[2]));
+  XOR2_X1_LVT g3 (.A(b2[3]), .B(din[3]), .Z(dout[3]));
+endmodule
+
+module blk_l3_v0(clk,rst_n,din,dout);
+   input clk;
+   input rst_n;
+   input [3:0]din;
+   output [3:0]dout;
+   wire [7:0]n;
+  NAND2_X1_LVT c0 (.A1(din[0]), .A2(din[0]), .ZN(n[0]));
+  INV_X1_LVT c1 (.A(din[1]), .ZN(n[1]));
+  DFFR_X1_LVT c2 (.CK(clk), .D(din[0]), .RN(rst_n), .Q(n[2]), .QN());
+  MUX2_X1_LVT c3 (.A(n[0]), .B(din[1]), .S(n[0]), .Z(n[3]));
+  MUX2_X1_LVT c4 (.A(1'b0), .B(1'b0), .S(din[2]), .Z(n[4]));
+  XOR2_X1_LVT c5 (.A(din[2]), .B(din[3]), .Z(n[5]));
+  INV_X1_LVT c6 (.A(n[5]), .ZN(n[6]));
+  MUX2_X1_LVT c7 (.A(n[3]), .B(n[3]), .S(din[3]), .Z(n[7]));
+  NAND2_X1_LVT c8 (.A1(n[0]), .A2(n[1]), .ZN(dout[0]));
+  XOR2_X1_LVT c9 (.A(din[1]), .B(n[2]), .Z(dout[1]));
+  DFFR_X1_LVT c10 (.CK(clk), .D(n[3]), .RN(rst_n), .Q(dout[2]), .QN());
+  INV_X1_LVT c11 (.A(n[5]), .ZN(dout[3]));
+endmodule
+
+module blk_l3_v1(clk,rst_n,din,dout);
+   input clk;
+   input rst_n;
+   input [3:0]din;
+   output [3:0]dout;
+   wire [7:0]n;
+  XOR2_X1_LVT c0 (.A(din[2]), .B(din[3]), .Z(n[0]));
+  DFFR_X1_LVT c1 (.CK(clk), .D(din[2]), .RN(rst_n), .Q(n[1]), .QN());
+  INV_X1_LVT c2 (.A(n[1]), .ZN(n[2]));
+  MUX2_X1_LVT c3 (.A(din[3]), .B(din[2]), .S(1'b1), .Z(n[3]));
+  INV_X1_LVT c4 (.A(din[3]), .ZN(n[4]));
+  AND2_X1_LVT c5 (.A1(n[2]), .A2(n[3]), .ZN(n[5]));
+  DFFR_X1_LVT c6 (.CK(clk), .D(n[4]), .RN(rst_n), .Q(n[6]), .QN());
+  NAND2_X1_LVT c7 (.A1(n[4]), .A2(n[2]), .ZN(n[7]));
+  MUX2_X1_LVT c8 (.A(din[2]), .B(din[2]), .S(din[3]), .Z(dout[0]));
+  DFFR_X1_LVT c9 (.CK(clk), .D(din[2]), .RN(rst_n), .Q(dout[1]), .QN());
+  INV_X1_LVT c10 (.A(n[4]), .ZN(dout[2]));
+  XOR2_X1_LVT c11 (.A(n[7]), .B(n[5]), .Z(dout[3]));
+endmodule
+
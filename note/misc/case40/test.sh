@@ -0,0 +1,33 @@
+#########################################################################
+# File Name: test.sh
+# Author: 16hxliang3
+# mail: 16hxliang3@stu.edu.cn
+# Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+#########################################################################
+#This is the design of case39, which is flattened three times with
+#--netlist-cache for each of the options of flattening: as it is, again, and
+#after a cell of the leaf module blk_l3_v1 is changed by levels_eco.v. Every
+#FlatNetlist.v must be the same as the one flattened without the cache, and the
+#numbers of reused modules are compared with standard/Reused.txt.
+#!/bin/bash
+rm -rf nocache NetlistCache.bin Reused.txt HierNetlist.v FlatNetlist.v
+mkdir nocache
+for options in "" "--flatten-depth 1" "--flatten-keep blk_l2_v0"; do
+  for design in levels.v levels.v levels_eco.v; do
+    ../../../bin/verilator $design ../LibBlackbox.v --xml-only $options \
+      --netlist-cache NetlistCache.bin | grep "^Reused" >> Reused.txt
+    cd nocache
+    ../../../../bin/verilator ../$design ../../LibBlackbox.v --xml-only \
+      $options > /dev/null
+    cd ..
+    report=`diff -q FlatNetlist.v nocache/FlatNetlist.v 2>&1`
+    [ "$report" ] && echo "In case40 with $design $options,$report." && \
+      error=true
+  done
+done
+hier=`diff -bqBH HierNetlist.v standard/StandardHierNetlist.v 2>&1`
+flat=`diff -bqBH FlatNetlist.v standard/StandardFlatNetlist.v 2>&1`
+reused=`diff -bqBH Reused.txt standard/Reused.txt 2>&1`
+[ "$hier" ] && echo "In case40,$hier." && error=true
+[ "$flat" ] && echo "In case40,$flat." && error=true
+[ "$reused" ] && echo "In case40,$reused." && error=true
@@ -23,6 +23,9 @@ for dir in `ls`; do                  #历遍ls命令显示目录
       mv standard standard_old
       mkdir standard;
       mv StandardHierNetlist.v StandardFlatNetlist.v standard;
+      for file in `ls standard_old`; do  #其他输出的标准文件，如SweepReport.txt
+        [ -f $file ] && mv $file standard;
+      done
       cd ..;
     fi
 done
@@ -0,0 +1,283 @@
+/*************************************************************************
+  > File Name: FlatNetlistIndex.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include <algorithm>
+
+FlatNetlistIndex::FlatNetlistIndex(const std::vector<Module> &netlist,
+                                   const uint32_t &flatModDefIndex)
+  : _flatMod(netlist[flatModDefIndex])
+{
+  _portBitOffsets.resize(_flatMod.ports.size() + 1);
+  _portBitOffsets[0] = 0;
+  for(uint32_t portDefIndex = 0; portDefIndex < _flatMod.ports.size();
+      portDefIndex++)
+    _portBitOffsets[portDefIndex + 1] =
+      _portBitOffsets[portDefIndex] + _flatMod.ports[portDefIndex].bitWidth;
+  _totalNetsExcludingConsts = _portBitOffsets.back();
+
+  // Counting sort all pins by net id: count, prefix sum, then fill.
+  const uint32_t totalNets = getTotalNets();
+  _driverStarts.assign(totalNets + 1, 0);
+  _loadStarts.assign(totalNets + 1, 0);
+  auto forEachPin = [&](auto &&onePin)
+  {
+    for(uint32_t insIndex = 0; insIndex < _flatMod.subModuleDefIndexs.size();
+        insIndex++)
+    {
+      const auto &subMod = netlist[_flatMod.subModuleDefIndexs[insIndex]];
+      const auto &portAssignments =
+        _flatMod.portAssignmentsOfSubModInss[insIndex];
+      for(uint32_t portDefIndex = 0; portDefIndex < portAssignments.size();
+          portDefIndex++)
+      {
+        const bool isLoad = portDefIndex < subMod.totalInputsAndInouts;
+        const bool isDriver = portDefIndex >= subMod.totalInputs;
+        const auto &refVars = portAssignments[portDefIndex].refVars;
+        for(uint32_t bitIndex = 0; bitIndex < refVars.size(); bitIndex++)
+          onePin(FlatPin{ insIndex, portDefIndex, bitIndex },
+                 getNetId(refVars[bitIndex]), isDriver, isLoad);
+      }
+    }
+  };
+  forEachPin(
+    [this](const FlatPin &, uint32_t netId, bool isDriver, bool isLoad)
+    {
+      if(isDriver)
+        _driverStarts[netId + 1]++;
+      if(isLoad)
+        _loadStarts[netId + 1]++;
+    });
+  for(uint32_t netId = 0; netId < totalNets; netId++)
+  {
+    _driverStarts[netId + 1] += _driverStarts[netId];
+    _loadStarts[netId + 1] += _loadStarts[netId];
+  }
+  _drivers.resize(_driverStarts.back());
+  _loads.resize(_loadStarts.back());
+  std::vector<uint32_t> driverPos(_driverStarts.begin(),
+                                  _driverStarts.end() - 1);
+  std::vector<uint32_t> loadPos(_loadStarts.begin(), _loadStarts.end() - 1);
+  forEachPin(
+    [&](const FlatPin &pin, uint32_t netId, bool isDriver, bool isLoad)
+    {
+      if(isDriver)
+        _drivers[driverPos[netId]++] = pin;
+      if(isLoad)
+        _loads[loadPos[netId]++] = pin;
+    });
+}
+
+uint32_t FlatNetlistIndex::getNetId(const RefVar &refVar) const
+{
+  if(refVar.refVarDefIndex == UINT32_MAX)
+    return getConstNetId(refVar.valueAndValueX);
+  return _portBitOffsets[refVar.refVarDefIndex] + refVar.bitIndex;
+}
+
+uint32_t FlatNetlistIndex::getConstNetId(const char &valueAndValueX) const
+{
+  switch(valueAndValueX)
+  {
+  case CHAR_ZERO:
+    return _totalNetsExcludingConsts;
+  case CHAR_ONE:
+    return _totalNetsExcludingConsts + 1;
+  case CHAR_Z:
+    return _totalNetsExcludingConsts + 3;
+  default: // x or error value
+    return _totalNetsExcludingConsts + 2;
+  }
+}
+
+RefVar FlatNetlistIndex::getRefVar(const uint32_t &netId) const
+{
+  RefVar refVar;
+  if(isConstNet(netId))
+  {
+    const char constValues[4] = { CHAR_ZERO, CHAR_ONE, CHAR_X, CHAR_Z };
+    refVar.refVarDefIndex = UINT32_MAX;
+    refVar.valueAndValueX = constValues[netId - _totalNetsExcludingConsts];
+  }
+  else
+  {
+    // The last port whose first net id is not bigger than netId
+    refVar.refVarDefIndex = std::upper_bound(_portBitOffsets.begin(),
+                                             _portBitOffsets.end(), netId) -
+                            _portBitOffsets.begin() - 1;
+    refVar.bitIndex = netId - _portBitOffsets[refVar.refVarDefIndex];
+  }
+  return refVar;
+}
+
+std::string FlatNetlistIndex::getNetName(const uint32_t &netId) const
+{
+  if(isConstNet(netId))
+  {
+    const char *constNames[4] = { "1'b0", "1'b1", "1'bx", "1'bz" };
+    return constNames[netId - _totalNetsExcludingConsts];
+  }
+  const RefVar refVar = getRefVar(netId);
+  const auto &port = _flatMod.ports[refVar.refVarDefIndex];
+  if(port.isVector)
+    return port.portDefName + "[" + std::to_string(refVar.bitIndex) + "]";
+  return port.portDefName;
+}
+
+void FlatNetlistIndex::splitNetName(const std::string &netName,
+                                    std::string &portDefName,
+                                    uint32_t &bitIndex)
+{
+  portDefName = netName;
+  bitIndex = UINT32_MAX;
+  const size_t bracketPos = netName.rfind('[');
+  // At most 9 digits, so the bit fits in uint32_t.
+  if(bracketPos == std::string::npos || bracketPos + 2 >= netName.size() ||
+     netName.size() - bracketPos > 11 || netName.back() != ']' ||
+     netName.find_first_not_of("0123456789", bracketPos + 1) !=
+       netName.size() - 1)
+    return;
+  portDefName = netName.substr(0, bracketPos);
+  bitIndex = std::stoul(netName.substr(bracketPos + 1));
+}
+
+uint32_t FlatNetlistIndex::findNetId(const std::string &netName) const
+{
+  std::string portDefName;
+  uint32_t bitIndex;
+  splitNetName(netName, portDefName, bitIndex);
+  for(uint32_t portDefIndex = 0; portDefIndex < _flatMod.ports.size();
+      portDefIndex++)
+  {
+    const auto &port = _flatMod.ports[portDefIndex];
+    if(port.portDefName == netName && !port.isVector)
+      return _portBitOffsets[portDefIndex];
+    if(port.portDefName == portDefName && port.isVector &&
+       bitIndex < port.bitWidth)
+      return _portBitOffsets[portDefIndex] + bitIndex;
+  }
+  return UINT32_MAX;
+}
+
+NetUnionFind::NetUnionFind(const uint32_t &totalNets)
+{
+  _parents.resize(totalNets);
+  for(uint32_t netId = 0; netId < totalNets; netId++)
+    _parents[netId] = netId;
+}
+
+uint32_t NetUnionFind::find(uint32_t netId)
+{
+  // Path halving keeps the trees flat without recursion.
+  while(_parents[netId] != netId)
+  {
+    _parents[netId] = _parents[_parents[netId]];
+    netId = _parents[netId];
+  }
+  return netId;
+}
+
+uint32_t NetUnionFind::unite(const uint32_t &rootNetId,
+                             const uint32_t &childNetId)
+{
+  const uint32_t root = find(rootNetId);
+  _parents[find(childNetId)] = root;
+  return root;
+}
+
+void NetUnionFind::uniteAssigns(const FlatNetlistIndex &index,
+                                const Module &flatMod)
+{
+  for(const auto &oneAssign: flatMod.assigns)
+  {
+    const uint32_t lRoot = find(index.getNetId(oneAssign.lValue));
+    const uint32_t rRoot = find(index.getNetId(oneAssign.rValue));
+    // Const values must be the root of their set, a set may have got one
+    // from an earlier assign statement.
+    if(index.isConstNet(lRoot))
+      unite(lRoot, rRoot);
+    else
+      unite(rRoot, lRoot);
+  }
+}
+
+void removeInstances(Module &flatMod, const std::vector<bool> &shouldRemove)
+{
+  uint32_t keptInsIndex = 0;
+  for(uint32_t insIndex = 0; insIndex < flatMod.subModuleDefIndexs.size();
+      insIndex++)
+  {
+    if(shouldRemove[insIndex])
+      continue;
+    if(keptInsIndex != insIndex)
+    {
+      flatMod.subModuleInstanceNames[keptInsIndex] =
+        std::move(flatMod.subModuleInstanceNames[insIndex]);
+      flatMod.subModuleDefIndexs[keptInsIndex] =
+        flatMod.subModuleDefIndexs[insIndex];
+      flatMod.portAssignmentsOfSubModInss[keptInsIndex] =
+        std::move(flatMod.portAssignmentsOfSubModInss[insIndex]);
+    }
+    keptInsIndex++;
+  }
+  flatMod.subModuleInstanceNames.resize(keptInsIndex);
+  flatMod.subModuleDefIndexs.resize(keptInsIndex);
+  flatMod.portAssignmentsOfSubModInss.resize(keptInsIndex);
+}
+
+void removeUnusedWires(Module &flatMod, const std::vector<bool> &isCandidate)
+{
+  std::vector<bool> isUsed(flatMod.ports.size(), false);
+  auto markUsed = [&isUsed](const RefVar &refVar)
+  {
+    if(refVar.refVarDefIndex != UINT32_MAX)
+      isUsed[refVar.refVarDefIndex] = true;
+  };
+  for(const auto &portAssignments: flatMod.portAssignmentsOfSubModInss)
+    for(const auto &portAssignment: portAssignments)
+      for(const auto &refVar: portAssignment.refVars)
+        markUsed(refVar);
+  for(const auto &oneAssign: flatMod.assigns)
+  {
+    markUsed(oneAssign.lValue);
+    markUsed(oneAssign.rValue);
+  }
+  // newPortDefIndexs[i] = the index of ports[i] after removing wires
+  std::vector<uint32_t> newPortDefIndexs(flatMod.ports.size());
+  uint32_t keptPortDefIndex = 0;
+  for(uint32_t portDefIndex = 0; portDefIndex < flatMod.ports.size();
+      portDefIndex++)
+  {
+    if(portDefIndex >= flatMod.totalPortsExcludingWires &&
+       isCandidate[portDefIndex] && !isUsed[portDefIndex])
+    {
+      newPortDefIndexs[portDefIndex] = UINT32_MAX;
+      continue;
+    }
+    newPortDefIndexs[portDefIndex] = keptPortDefIndex;
+    if(keptPortDefIndex != portDefIndex)
+      flatMod.ports[keptPortDefIndex] = std::move(flatMod.ports[portDefIndex]);
+    keptPortDefIndex++;
+  }
+  if(keptPortDefIndex == flatMod.ports.size())
+    return;
+  flatMod.ports.resize(keptPortDefIndex);
+  auto remap = [&newPortDefIndexs](RefVar &refVar)
+  {
+    if(refVar.refVarDefIndex != UINT32_MAX)
+      refVar.refVarDefIndex = newPortDefIndexs[refVar.refVarDefIndex];
+  };
+  for(auto &portAssignments: flatMod.portAssignmentsOfSubModInss)
+    for(auto &portAssignment: portAssignments)
+      for(auto &refVar: portAssignment.refVars)
+        remap(refVar);
+  for(auto &oneAssign: flatMod.assigns)
+  {
+    remap(oneAssign.lValue);
+    remap(oneAssign.rValue);
+  }
+}
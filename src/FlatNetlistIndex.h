@@ -0,0 +1,121 @@
+/*************************************************************************
+  > File Name: FlatNetlistIndex.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+#pragma once
+#include "OneBitNetlist.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// In a flattened module, every bit of every port and wire is a net. For
+// example, if ports = {A[3:0], ci, C[4:0]}, then A[0] ~ A[3] are net 0 ~ 3, ci
+// is net 4 and C[0] ~ C[4] are net 5 ~ 9. The const values 1'b0, 1'b1, 1'bx
+// and 1'bz are regarded as the last four nets, so every RefVar has a net id.
+// A pin is one bit of one port of a std cell instance, for example, .A(a) of
+// INV_X1_LVT U1/U0/i_0_0.
+struct FlatPin
+{
+    uint32_t insIndex;     // Index in subModuleDefIndexs of flattened module
+    uint32_t portDefIndex; // Index in ports of instanced black box
+    uint32_t bitIndex;     // Index in PortAssignment::refVars
+};
+
+// Index between nets and pins of a flattened module. Input pins are loads
+// of a net, output pins are drivers of a net and inout pins are both of them.
+// Assign statements are not indexed, see NetUnionFind.
+class FlatNetlistIndex final
+{
+  private:
+    const Module &_flatMod;
+    // _portBitOffsets[i] = the first net id of ports[i]
+    std::vector<uint32_t> _portBitOffsets;
+    uint32_t _totalNetsExcludingConsts;
+    // Compressed sparse rows: pins of net i are in
+    // [_driverStarts[i], _driverStarts[i + 1]) of _drivers.
+    std::vector<uint32_t> _driverStarts;
+    std::vector<FlatPin> _drivers;
+    std::vector<uint32_t> _loadStarts;
+    std::vector<FlatPin> _loads;
+
+  public:
+    FlatNetlistIndex(const std::vector<Module> &netlist,
+                     const uint32_t &flatModDefIndex);
+    const Module &getFlatMod() const { return _flatMod; };
+    // The number of nets including four const nets
+    uint32_t getTotalNets() const { return _totalNetsExcludingConsts + 4; };
+    uint32_t getTotalNetsExcludingConsts() const
+    {
+      return _totalNetsExcludingConsts;
+    };
+    bool isConstNet(const uint32_t &netId) const
+    {
+      return netId >= _totalNetsExcludingConsts;
+    };
+    // Net is a bit of input, output or inout of flattened module.
+    bool isPortNet(const uint32_t &netId) const
+    {
+      return netId < _portBitOffsets[_flatMod.totalPortsExcludingWires];
+    };
+    uint32_t getNetId(const RefVar &refVar) const;
+    // Net id of a const value, valueAndValueX is CHAR_ZERO, CHAR_ONE ...
+    uint32_t getConstNetId(const char &valueAndValueX) const;
+    RefVar getRefVar(const uint32_t &netId) const;
+    // Name used in reports, like C[1], ci or 1'b0
+    std::string getNetName(const uint32_t &netId) const;
+    // Split C[1] into C and 1, and ci into ci and UINT32_MAX.
+    static void splitNetName(const std::string &netName,
+                             std::string &portDefName, uint32_t &bitIndex);
+    // The net of a port or wire bit named like getNetName, or UINT32_MAX.
+    uint32_t findNetId(const std::string &netName) const;
+    const RefVar &getPinRefVar(const FlatPin &pin) const
+    {
+      return _flatMod.portAssignmentsOfSubModInss[pin.insIndex]
+        [pin.portDefIndex]
+          .refVars[pin.bitIndex];
+    };
+    const FlatPin *driversBegin(const uint32_t &netId) const
+    {
+      return _drivers.data() + _driverStarts[netId];
+    };
+    const FlatPin *driversEnd(const uint32_t &netId) const
+    {
+      return _drivers.data() + _driverStarts[netId + 1];
+    };
+    const FlatPin *loadsBegin(const uint32_t &netId) const
+    {
+      return _loads.data() + _loadStarts[netId];
+    };
+    const FlatPin *loadsEnd(const uint32_t &netId) const
+    {
+      return _loads.data() + _loadStarts[netId + 1];
+    };
+};
+
+// Disjoint sets of nets which are connected by assign statements or merged
+// by an optimization, for example, assign a = b; assign b = c; makes a, b
+// and c in the same set.
+class NetUnionFind final
+{
+  private:
+    std::vector<uint32_t> _parents;
+
+  public:
+    explicit NetUnionFind(const uint32_t &totalNets);
+    uint32_t find(uint32_t netId);
+    // Make the root of childNetId's set point to the root of rootNetId's set,
+    // return the root of the merged set.
+    uint32_t unite(const uint32_t &rootNetId, const uint32_t &childNetId);
+    // Unite lValue and rValue of every assign statement of flatMod, a const
+    // net is always the root of its set.
+    void uniteAssigns(const FlatNetlistIndex &index, const Module &flatMod);
+};
+
+// Remove instances whose shouldRemove[insIndex] is true and keep the order
+// of other instances.
+void removeInstances(Module &flatMod, const std::vector<bool> &shouldRemove);
+// Remove wires whose isCandidate[portDefIndex] is true and which are not
+// referenced by any instance or assign statement any more.
+void removeUnusedWires(Module &flatMod, const std::vector<bool> &isCandidate);
@@ -0,0 +1,221 @@
+/*************************************************************************
+  > File Name: NetlistBinary.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistBinary.h"
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+
+// "VNLB" and the version of the file layout
+const uint32_t NETLIST_BINARY_MAGIC = 0x424C4E56;
+const uint32_t NETLIST_BINARY_VERSION = 2;
+
+class BinaryWriter final
+{
+  private:
+    std::ofstream _ofs;
+
+  public:
+    explicit BinaryWriter(const std::string &fileName)
+      : _ofs(fileName, std::ios::binary)
+    {
+      if(!_ofs)
+        throw std::runtime_error("Can't write " + fileName);
+    };
+    void writeU32(const uint32_t &number)
+    {
+      _ofs.write(reinterpret_cast<const char *>(&number), sizeof(number));
+    };
+    void writeString(const std::string &str)
+    {
+      writeU32(str.size());
+      _ofs.write(str.data(), str.size());
+    };
+    void writeRefVar(const RefVar &refVar)
+    {
+      writeU32(refVar.refVarDefIndex);
+      writeU32(refVar.refVarDefIndex == UINT32_MAX
+                 ? static_cast<uint8_t>(refVar.valueAndValueX)
+                 : refVar.bitIndex);
+    };
+    void writeModule(const Module &oneMod)
+    {
+      writeString(oneMod.moduleDefName);
+      writeU32(oneMod.level);
+      writeU32(oneMod.ports.size());
+      for(const auto &port: oneMod.ports)
+      {
+        writeString(port.portDefName);
+        writeU32(static_cast<uint32_t>(port.portType));
+        writeU32(port.isVector);
+        writeU32(port.bitWidth);
+      }
+      writeU32(oneMod.totalInputs);
+      writeU32(oneMod.totalInputsAndInouts);
+      writeU32(oneMod.totalPortsExcludingWires);
+      writeU32(oneMod.assigns.size());
+      for(const auto &oneAssign: oneMod.assigns)
+      {
+        writeRefVar(oneAssign.lValue);
+        writeRefVar(oneAssign.rValue);
+      }
+      writeU32(oneMod.subModuleDefIndexs.size());
+      for(uint32_t insIndex = 0; insIndex < oneMod.subModuleDefIndexs.size();
+          insIndex++)
+      {
+        writeString(oneMod.subModuleInstanceNames[insIndex]);
+        writeU32(oneMod.subModuleDefIndexs[insIndex]);
+        const auto &portAssignments =
+          oneMod.portAssignmentsOfSubModInss[insIndex];
+        writeU32(portAssignments.size());
+        for(const auto &portAssignment: portAssignments)
+        {
+          writeU32(portAssignment.refVars.size());
+          for(const auto &refVar: portAssignment.refVars)
+            writeRefVar(refVar);
+        }
+      }
+    };
+    void writeNetlist(const std::vector<Module> &netlist)
+    {
+      writeU32(netlist.size());
+      for(const auto &oneMod: netlist)
+        writeModule(oneMod);
+    };
+    bool good() const { return _ofs.good(); };
+};
+
+class BinaryReader final
+{
+  private:
+    std::ifstream _ifs;
+    std::string _fileName;
+
+  public:
+    explicit BinaryReader(const std::string &fileName)
+      : _ifs(fileName, std::ios::binary), _fileName(fileName)
+    {
+      if(!_ifs)
+        throw std::runtime_error("Can't read " + fileName);
+    };
+    uint32_t readU32()
+    {
+      uint32_t number;
+      if(!_ifs.read(reinterpret_cast<char *>(&number), sizeof(number)))
+        throw std::runtime_error(_fileName + " is truncated");
+      return number;
+    };
+    std::string readString()
+    {
+      std::string str(readU32(), '\0');
+      if(!_ifs.read(&str[0], str.size()))
+        throw std::runtime_error(_fileName + " is truncated");
+      return str;
+    };
+    RefVar readRefVar()
+    {
+      RefVar refVar;
+      refVar.refVarDefIndex = readU32();
+      const uint32_t bitIndexOrValue = readU32();
+      if(refVar.refVarDefIndex == UINT32_MAX)
+        refVar.valueAndValueX = static_cast<char>(bitIndexOrValue);
+      else
+        refVar.bitIndex = bitIndexOrValue;
+      return refVar;
+    };
+    Module readModule()
+    {
+      Module oneMod;
+      oneMod.moduleDefName = readString();
+      oneMod.level = readU32();
+      oneMod.ports.resize(readU32());
+      for(auto &port: oneMod.ports)
+      {
+        port.portDefName = readString();
+        port.portType = static_cast<PortType>(readU32());
+        port.isVector = readU32();
+        port.bitWidth = readU32();
+      }
+      oneMod.totalInputs = readU32();
+      oneMod.totalInputsAndInouts = readU32();
+      oneMod.totalPortsExcludingWires = readU32();
+      oneMod.assigns.resize(readU32());
+      for(auto &oneAssign: oneMod.assigns)
+      {
+        oneAssign.lValue = readRefVar();
+        oneAssign.rValue = readRefVar();
+      }
+      const uint32_t totalInss = readU32();
+      oneMod.subModuleInstanceNames.resize(totalInss);
+      oneMod.subModuleDefIndexs.resize(totalInss);
+      oneMod.portAssignmentsOfSubModInss.resize(totalInss);
+      for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+      {
+        oneMod.subModuleInstanceNames[insIndex] = readString();
+        oneMod.subModuleDefIndexs[insIndex] = readU32();
+        auto &portAssignments = oneMod.portAssignmentsOfSubModInss[insIndex];
+        portAssignments.resize(readU32());
+        for(auto &portAssignment: portAssignments)
+        {
+          portAssignment.refVars.resize(readU32());
+          for(auto &refVar: portAssignment.refVars)
+            refVar = readRefVar();
+        }
+      }
+      return oneMod;
+    };
+    std::vector<Module> readNetlist()
+    {
+      std::vector<Module> netlist(readU32());
+      for(auto &oneMod: netlist)
+        oneMod = readModule();
+      return netlist;
+    };
+};
+
+} // namespace
+
+void writeNetlistBinary(const std::string &fileName,
+                        const SavedNetlists &savedNetlists)
+{
+  BinaryWriter writer(fileName);
+  writer.writeU32(NETLIST_BINARY_MAGIC);
+  writer.writeU32(NETLIST_BINARY_VERSION);
+  writer.writeU32(savedNetlists.totalUsedStdCells);
+  writer.writeU32(savedNetlists.totalUsedNotEmptyStdCells);
+  writer.writeU32(savedNetlists.totalUsedBlackBoxes);
+  writer.writeNetlist(savedNetlists.hierNetlist);
+  writer.writeNetlist(savedNetlists.flatNetlist);
+  writer.writeString(savedNetlists.flattenConfig);
+  writer.writeU32(savedNetlists.subtreeHashes.size());
+  for(const auto &subtreeHash: savedNetlists.subtreeHashes)
+    writer.writeU32(subtreeHash);
+  if(!writer.good())
+    throw std::runtime_error("Can't write " + fileName);
+}
+
+SavedNetlists readNetlistBinary(const std::string &fileName)
+{
+  BinaryReader reader(fileName);
+  if(reader.readU32() != NETLIST_BINARY_MAGIC)
+    throw std::runtime_error(fileName + " isn't a netlist binary file");
+  if(reader.readU32() != NETLIST_BINARY_VERSION)
+    throw std::runtime_error(fileName + " is written by another version");
+  SavedNetlists savedNetlists;
+  savedNetlists.totalUsedStdCells = reader.readU32();
+  savedNetlists.totalUsedNotEmptyStdCells = reader.readU32();
+  savedNetlists.totalUsedBlackBoxes = reader.readU32();
+  savedNetlists.hierNetlist = reader.readNetlist();
+  savedNetlists.flatNetlist = reader.readNetlist();
+  savedNetlists.flattenConfig = reader.readString();
+  savedNetlists.subtreeHashes.resize(reader.readU32());
+  for(auto &subtreeHash: savedNetlists.subtreeHashes)
+    subtreeHash = reader.readU32();
+  return savedNetlists;
+}
@@ -0,0 +1,32 @@
+/*************************************************************************
+  > File Name: NetlistBinary.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+#pragma once
+#include "OneBitNetlist.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Both netlists of one run, which are saved into a binary file, so that a
+// later run can compare with them or reuse them without parsing Verilog.
+struct SavedNetlists
+{
+    uint32_t totalUsedStdCells = 0;
+    uint32_t totalUsedNotEmptyStdCells = 0;
+    uint32_t totalUsedBlackBoxes = 0;
+    std::vector<Module> hierNetlist;
+    std::vector<Module> flatNetlist;
+    // Only used by the incremental flattening, see flattenHierNetIncrementally
+    std::string flattenConfig;
+    std::vector<uint32_t> subtreeHashes;
+};
+
+// The file is only read by the same build on the same machine, so numbers
+// are written in the native byte order. A std::runtime_error is thrown if
+// the file can't be written or read, or if it is written by another version.
+void writeNetlistBinary(const std::string &fileName,
+                        const SavedNetlists &savedNetlists);
+SavedNetlists readNetlistBinary(const std::string &fileName);
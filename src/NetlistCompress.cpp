@@ -0,0 +1,324 @@
+/*************************************************************************
+  > File Name: NetlistCompress.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "config_build.h"
+
+#include "NetlistCompress.h"
+#include "NetlistParallel.h"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace
+{
+
+const int gzipLevel = 6;
+const int zstdLevel = 3;
+
+std::string compressBlock(const std::string &block,
+                          const NetlistCompression &compression)
+{
+  std::string compressed;
+  if(compression == NetlistCompression::GZIP)
+  {
+#ifdef HAVE_ZLIB
+    z_stream stream = {};
+    // 16 + MAX_WBITS writes a gzip header and trailer.
+    if(deflateInit2(&stream, gzipLevel, Z_DEFLATED, 16 + MAX_WBITS, 8,
+                    Z_DEFAULT_STRATEGY) != Z_OK)
+      throw std::runtime_error("Can't initialize gzip compression.");
+    compressed.resize(deflateBound(&stream, block.size()));
+    stream.next_in =
+      reinterpret_cast<Bytef *>(const_cast<char *>(block.data()));
+    stream.avail_in = block.size();
+    stream.next_out = reinterpret_cast<Bytef *>(&compressed[0]);
+    stream.avail_out = compressed.size();
+    const int result = deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    if(result != Z_STREAM_END)
+      throw std::runtime_error("Can't compress a gzip block.");
+#else
+    throw std::runtime_error("Verilator is built without zlib.");
+#endif
+  }
+  else if(compression == NetlistCompression::ZSTD)
+  {
+#ifdef HAVE_ZSTD
+    compressed.resize(ZSTD_compressBound(block.size()));
+    const size_t totalBytes =
+      ZSTD_compress(&compressed[0], compressed.size(), block.data(),
+                    block.size(), zstdLevel);
+    if(ZSTD_isError(totalBytes))
+      throw std::runtime_error(std::string("Can't compress a zstd block: ") +
+                               ZSTD_getErrorName(totalBytes));
+    compressed.resize(totalBytes);
+#else
+    throw std::runtime_error("Verilator is built without zstd.");
+#endif
+  }
+  return compressed;
+}
+
+void checkLibrary(const NetlistCompression &compression)
+{
+#ifndef HAVE_ZLIB
+  if(compression == NetlistCompression::GZIP)
+    throw std::runtime_error("Verilator is built without zlib.");
+#endif
+#ifndef HAVE_ZSTD
+  if(compression == NetlistCompression::ZSTD)
+    throw std::runtime_error("Verilator is built without zstd.");
+#endif
+}
+
+} // namespace
+
+NetlistCompression getNetlistCompression(const std::string &name)
+{
+  NetlistCompression compression = NetlistCompression::NONE;
+  if(name == "gzip")
+    compression = NetlistCompression::GZIP;
+  else if(name == "zstd")
+    compression = NetlistCompression::ZSTD;
+  else if(!name.empty())
+    throw std::runtime_error("Unknown netlist compression: " + name + ".");
+  checkLibrary(compression);
+  return compression;
+}
+
+std::string getNetlistCompressionSuffix(const NetlistCompression &compression)
+{
+  switch(compression)
+  {
+  case NetlistCompression::GZIP:
+    return ".gz";
+  case NetlistCompression::ZSTD:
+    return ".zst";
+  default:
+    return "";
+  }
+}
+
+CompressedStreamBuf::CompressedStreamBuf(const std::string &fileName,
+                                         const NetlistCompression &compression,
+                                         const uint32_t &totalThreads)
+  : _fileName(fileName), _compression(compression),
+    _totalThreads(getTotalNetlistThreads(totalThreads))
+{
+  // No empty file is left if the library isn't there.
+  checkLibrary(compression);
+  _ofs.open(fileName, std::ios::binary);
+  if(!_ofs)
+    throw std::runtime_error("Can't open " + fileName + ".");
+  _blocks.emplace_back();
+  _blocks.back().reserve(BLOCK_BYTES);
+}
+
+CompressedStreamBuf::~CompressedStreamBuf()
+{
+  try
+  {
+    if(_ofs.is_open())
+      close();
+  }
+  catch(const std::exception &error)
+  {
+    std::cerr << "Can't write " << _fileName << ": " << error.what()
+              << std::endl;
+  }
+}
+
+void CompressedStreamBuf::compressBlocks()
+{
+  std::vector<std::string> compressedBlocks(_blocks.size());
+  parallelFor(0, _blocks.size(), _totalThreads,
+              [&](const uint32_t &blockIndex)
+              {
+                compressedBlocks[blockIndex] =
+                  compressBlock(_blocks[blockIndex], _compression);
+              });
+  for(const auto &compressedBlock: compressedBlocks)
+    _ofs.write(compressedBlock.data(), compressedBlock.size());
+  _blocks.resize(1);
+  _blocks.back().clear();
+}
+
+CompressedStreamBuf::int_type CompressedStreamBuf::overflow(int_type ch)
+{
+  if(traits_type::eq_int_type(ch, traits_type::eof()))
+    return traits_type::not_eof(ch);
+  const char oneChar = traits_type::to_char_type(ch);
+  xsputn(&oneChar, 1);
+  return ch;
+}
+
+std::streamsize CompressedStreamBuf::xsputn(const char *data,
+                                            std::streamsize size)
+{
+  std::streamsize totalWritten = 0;
+  while(totalWritten < size)
+  {
+    if(_blocks.back().size() == BLOCK_BYTES)
+    {
+      if(_blocks.size() == _totalThreads)
+        compressBlocks();
+      else
+      {
+        _blocks.emplace_back();
+        _blocks.back().reserve(BLOCK_BYTES);
+      }
+    }
+    auto &block = _blocks.back();
+    const std::streamsize totalBytes =
+      std::min<std::streamsize>(size - totalWritten,
+                                BLOCK_BYTES - block.size());
+    block.append(data + totalWritten, totalBytes);
+    totalWritten += totalBytes;
+  }
+  return size;
+}
+
+void CompressedStreamBuf::close()
+{
+  if(!_blocks.back().empty())
+    compressBlocks();
+  _ofs.close();
+  if(!_ofs)
+    throw std::runtime_error("Can't write " + _fileName + ".");
+}
+
+std::unique_ptr<std::ostream> openNetlistFile(
+  const std::string &fileName, const NetlistCompression &compression,
+  const uint32_t &totalThreads)
+{
+  if(compression == NetlistCompression::NONE)
+    return std::unique_ptr<std::ostream>(
+      new std::ofstream(fileName, std::ios::binary));
+  return std::unique_ptr<std::ostream>(
+    new CompressedOfstream(fileName, compression, totalThreads));
+}
+
+bool isCompressedNetlist(const std::string &head)
+{
+  return !head.compare(0, 2, "\x1f\x8b") ||
+         !head.compare(0, 4, "\x28\xb5\x2f\xfd");
+}
+
+struct NetlistDecompressor::State
+{
+    NetlistCompression compression = NetlistCompression::NONE;
+    // Whether the last member or frame is complete
+    bool isEnd = false;
+#ifdef HAVE_ZLIB
+    z_stream gzipStream = {};
+#endif
+#ifdef HAVE_ZSTD
+    ZSTD_DCtx *zstdContext = nullptr;
+#endif
+    char buffer[1 << 16];
+};
+
+NetlistDecompressor::NetlistDecompressor(const std::string &head)
+  : _state(new State)
+{
+  _state->compression = !head.compare(0, 2, "\x1f\x8b")
+                          ? NetlistCompression::GZIP
+                          : NetlistCompression::ZSTD;
+  checkLibrary(_state->compression);
+#ifdef HAVE_ZLIB
+  // 32 + MAX_WBITS detects the gzip header.
+  if(_state->compression == NetlistCompression::GZIP &&
+     inflateInit2(&_state->gzipStream, 32 + MAX_WBITS) != Z_OK)
+    throw std::runtime_error("Can't initialize gzip decompression.");
+#endif
+#ifdef HAVE_ZSTD
+  if(_state->compression == NetlistCompression::ZSTD)
+    _state->zstdContext = ZSTD_createDCtx();
+#endif
+}
+
+NetlistDecompressor::~NetlistDecompressor()
+{
+#ifdef HAVE_ZLIB
+  if(_state->compression == NetlistCompression::GZIP)
+    inflateEnd(&_state->gzipStream);
+#endif
+#ifdef HAVE_ZSTD
+  if(_state->compression == NetlistCompression::ZSTD)
+    ZSTD_freeDCtx(_state->zstdContext);
+#endif
+}
+
+void NetlistDecompressor::decompress(const char *data, size_t size,
+                                     std::string &text)
+{
+  auto &buffer = _state->buffer;
+#ifdef HAVE_ZLIB
+  auto &stream = _state->gzipStream;
+  // avail_in is a 32-bit uInt, so a big piece is fed in chunks.
+  while(_state->compression == NetlistCompression::GZIP && size)
+  {
+    const uInt chunkBytes =
+      static_cast<uInt>(std::min<size_t>(size, UINT32_MAX));
+    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+    stream.avail_in = chunkBytes;
+    data += chunkBytes;
+    size -= chunkBytes;
+    do
+    {
+      // The next member
+      if(_state->isEnd && stream.avail_in)
+      {
+        inflateReset(&stream);
+        _state->isEnd = false;
+      }
+      stream.next_out = reinterpret_cast<Bytef *>(buffer);
+      stream.avail_out = sizeof(buffer);
+      const int result = inflate(&stream, Z_NO_FLUSH);
+      if(result == Z_STREAM_END)
+        _state->isEnd = true;
+      else if(result != Z_OK && result != Z_BUF_ERROR)
+        throw std::runtime_error("Broken gzip file.");
+      text.append(buffer, sizeof(buffer) - stream.avail_out);
+      // The output buffer may be full before all input is decompressed.
+    } while(stream.avail_in || !stream.avail_out);
+  }
+#endif
+#ifdef HAVE_ZSTD
+  if(_state->compression == NetlistCompression::ZSTD)
+  {
+    ZSTD_inBuffer input = { data, size, 0 };
+    ZSTD_outBuffer output = { buffer, sizeof(buffer), 0 };
+    do
+    {
+      output.pos = 0;
+      const size_t result =
+        ZSTD_decompressStream(_state->zstdContext, &output, &input);
+      if(ZSTD_isError(result))
+        throw std::runtime_error("Broken zstd file.");
+      // result is 0 at the end of a frame.
+      _state->isEnd = !result;
+      text.append(buffer, output.pos);
+    } while(input.pos < input.size || output.pos == output.size);
+  }
+#endif
+}
+
+void NetlistDecompressor::finish() const
+{
+  if(!_state->isEnd)
+    throw std::runtime_error(_state->compression == NetlistCompression::GZIP
+                               ? "Broken gzip file."
+                               : "Broken zstd file.");
+}
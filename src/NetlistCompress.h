@@ -0,0 +1,105 @@
+/*************************************************************************
+  > File Name: NetlistCompress.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+enum class NetlistCompression
+{
+  NONE,
+  GZIP,
+  ZSTD
+};
+
+// "gzip" or "zstd" of --netlist-compress, NONE for an empty name. A
+// std::runtime_error is thrown for other names, or if Verilator is built
+// without the library.
+NetlistCompression getNetlistCompression(const std::string &name);
+// ".gz", ".zst" or ""
+std::string getNetlistCompressionSuffix(const NetlistCompression &compression);
+
+// Written bytes are cut into blocks of BLOCK_BYTES, and every totalThreads
+// blocks are compressed in parallel into independent gzip members or zstd
+// frames, which are written in order. Concatenated members and frames are a
+// valid gzip or zstd file, which gunzip and unzstd read as one stream.
+class CompressedStreamBuf final : public std::streambuf
+{
+  private:
+    std::string _fileName;
+    std::ofstream _ofs;
+    NetlistCompression _compression;
+    uint32_t _totalThreads;
+    std::vector<std::string> _blocks;
+    void compressBlocks();
+
+  protected:
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char *data, std::streamsize size) override;
+
+  public:
+    static const uint32_t BLOCK_BYTES = 4 << 20;
+    CompressedStreamBuf(const std::string &fileName,
+                        const NetlistCompression &compression,
+                        const uint32_t &totalThreads);
+    // An error of close() is written to std::cerr, since a destructor can't
+    // throw it. Call close() first to get it as an exception.
+    ~CompressedStreamBuf();
+    // Compress the last blocks and close the file.
+    void close();
+};
+
+class CompressedOfstream final : public std::ostream
+{
+  private:
+    CompressedStreamBuf _streamBuf;
+
+  public:
+    CompressedOfstream(const std::string &fileName,
+                       const NetlistCompression &compression,
+                       const uint32_t &totalThreads)
+      : std::ostream(nullptr), _streamBuf(fileName, compression, totalThreads)
+    {
+      rdbuf(&_streamBuf);
+    };
+    void close() { _streamBuf.close(); };
+};
+
+// An output netlist file, which is compressed if compression isn't NONE. It
+// is opened in binary mode, so binary formats can be written, too.
+// totalThreads = 0 means all hardware threads.
+std::unique_ptr<std::ostream> openNetlistFile(
+  const std::string &fileName,
+  const NetlistCompression &compression = NetlistCompression::NONE,
+  const uint32_t &totalThreads = 1);
+
+// Whether the beginning of a file is the magic number of gzip or zstd
+bool isCompressedNetlist(const std::string &head);
+
+// Decompress a gzip or zstd file with one or more members or frames piece
+// by piece as it is read, so the whole compressed file is never in memory.
+// A std::runtime_error is thrown if it is broken, or if Verilator is built
+// without the library.
+class NetlistDecompressor final
+{
+  private:
+    struct State;
+    std::unique_ptr<State> _state;
+
+  public:
+    // head is the beginning of the file, see isCompressedNetlist.
+    explicit NetlistDecompressor(const std::string &head);
+    ~NetlistDecompressor();
+    // Decompress the next piece of the file and append it to text.
+    void decompress(const char *data, size_t size, std::string &text);
+    // Throw if the file ends in the middle of a member or frame.
+    void finish() const;
+};
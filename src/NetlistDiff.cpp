@@ -0,0 +1,309 @@
+/*************************************************************************
+  > File Name: NetlistDiff.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistDiff.h"
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+
+using NameIndexs = std::unordered_map<std::string, uint32_t>;
+
+// Top modules and all modules instanced by them
+std::vector<bool> getComparedMods(const std::vector<Module> &netlist,
+                                  const uint32_t &totalUsedBlackBoxes)
+{
+  std::vector<bool> isCompared(netlist.size(), false);
+  for(uint32_t modDefIndex = totalUsedBlackBoxes; modDefIndex < netlist.size();
+      modDefIndex++)
+  {
+    const auto &oneMod = netlist[modDefIndex];
+    if(oneMod.level == netlist[totalUsedBlackBoxes].level)
+      isCompared[modDefIndex] = true;
+    if(!isCompared[modDefIndex])
+      continue;
+    for(const auto &subModDefIndex: oneMod.subModuleDefIndexs)
+      isCompared[subModDefIndex] = true;
+  }
+  return isCompared;
+}
+
+std::string getPortTypeName(const PortDefinition &port)
+{
+  const char *portTypeNames[] = { "input", "output", "inout", "wire", "" };
+  std::string portTypeName = portTypeNames[static_cast<int>(port.portType)];
+  if(port.isVector)
+    portTypeName += " [" + std::to_string(port.bitWidth - 1) + ":0]";
+  return portTypeName;
+}
+
+std::string getRefVarName(const Module &oneMod, const RefVar &refVar)
+{
+  if(refVar.refVarDefIndex == UINT32_MAX)
+  {
+    switch(refVar.valueAndValueX)
+    {
+    case CHAR_ZERO:
+      return "1'b0";
+    case CHAR_ONE:
+      return "1'b1";
+    case CHAR_X:
+      return "1'bx";
+    default:
+      return "1'bz";
+    }
+  }
+  const auto &port = oneMod.ports[refVar.refVarDefIndex];
+  if(port.isVector)
+    return port.portDefName + "[" + std::to_string(refVar.bitIndex) + "]";
+  return port.portDefName;
+}
+
+// a, {a, b} or () for an unconnected pin
+std::string getPinName(const Module &oneMod,
+                       const PortAssignment &portAssignment)
+{
+  const auto &refVars = portAssignment.refVars;
+  if(refVars.size() == 1)
+    return getRefVarName(oneMod, refVars[0]);
+  std::string pinName = refVars.empty() ? "(" : "{";
+  for(uint32_t bitIndex = 0; bitIndex < refVars.size(); bitIndex++)
+    pinName +=
+      (bitIndex ? ", " : "") + getRefVarName(oneMod, refVars[bitIndex]);
+  return pinName + (refVars.empty() ? ")" : "}");
+}
+
+class NetlistDiffer final
+{
+  private:
+    const std::vector<Module> &_oldNetlist;
+    const std::vector<Module> &_newNetlist;
+    // _oldPortIndexs[oldModDefIndex] is built when it is used first.
+    std::vector<NameIndexs> _oldPortIndexs;
+    std::ostringstream _modDiffs;
+    uint64_t _totalDiffs = 0;
+
+    const NameIndexs &getOldPortIndexs(const uint32_t &oldModDefIndex)
+    {
+      auto &oldPortIndexs = _oldPortIndexs[oldModDefIndex];
+      const auto &oldMod = _oldNetlist[oldModDefIndex];
+      if(oldPortIndexs.empty() && !oldMod.ports.empty())
+      {
+        for(uint32_t portDefIndex = 0; portDefIndex < oldMod.ports.size();
+            portDefIndex++)
+          oldPortIndexs.emplace(oldMod.ports[portDefIndex].portDefName,
+                                portDefIndex);
+      }
+      return oldPortIndexs;
+    };
+    void addDiff(const std::string &diff)
+    {
+      _modDiffs << "  " << diff << std::endl;
+      _totalDiffs++;
+    };
+    void diffPorts(const uint32_t &oldModDefIndex, const Module &newMod);
+    void diffInstances(const Module &oldMod, const Module &newMod);
+    void diffAssigns(const Module &oldMod, const Module &newMod);
+
+  public:
+    NetlistDiffer(const std::vector<Module> &oldNetlist,
+                  const std::vector<Module> &newNetlist)
+      : _oldNetlist(oldNetlist),
+        _newNetlist(newNetlist),
+        _oldPortIndexs(oldNetlist.size()){};
+    // Return the differences of one module, every line is indented.
+    std::string diffModule(const uint32_t &oldModDefIndex,
+                           const uint32_t &newModDefIndex)
+    {
+      _modDiffs.str("");
+      const auto &oldMod = _oldNetlist[oldModDefIndex];
+      const auto &newMod = _newNetlist[newModDefIndex];
+      diffPorts(oldModDefIndex, newMod);
+      diffInstances(oldMod, newMod);
+      diffAssigns(oldMod, newMod);
+      return _modDiffs.str();
+    };
+    void addModDiff() { _totalDiffs++; };
+    const uint64_t &getTotalDiffs() const { return _totalDiffs; };
+};
+
+void NetlistDiffer::diffPorts(const uint32_t &oldModDefIndex,
+                              const Module &newMod)
+{
+  const auto &oldMod = _oldNetlist[oldModDefIndex];
+  const auto &oldPortIndexs = getOldPortIndexs(oldModDefIndex);
+  std::vector<bool> isMatched(oldMod.ports.size(), false);
+  for(const auto &newPort: newMod.ports)
+  {
+    auto it = oldPortIndexs.find(newPort.portDefName);
+    if(it == oldPortIndexs.end())
+    {
+      addDiff("+ " + getPortTypeName(newPort) + " " + newPort.portDefName);
+      continue;
+    }
+    isMatched[it->second] = true;
+    const auto &oldPort = oldMod.ports[it->second];
+    if(getPortTypeName(oldPort) != getPortTypeName(newPort))
+      addDiff("~ " + newPort.portDefName + ": " + getPortTypeName(oldPort) +
+              " -> " + getPortTypeName(newPort));
+  }
+  for(uint32_t portDefIndex = 0; portDefIndex < oldMod.ports.size();
+      portDefIndex++)
+  {
+    if(!isMatched[portDefIndex])
+      addDiff("- " + getPortTypeName(oldMod.ports[portDefIndex]) + " " +
+              oldMod.ports[portDefIndex].portDefName);
+  }
+}
+
+void NetlistDiffer::diffInstances(const Module &oldMod, const Module &newMod)
+{
+  NameIndexs oldInsIndexs;
+  for(uint32_t insIndex = 0; insIndex < oldMod.subModuleInstanceNames.size();
+      insIndex++)
+    oldInsIndexs.emplace(oldMod.subModuleInstanceNames[insIndex], insIndex);
+  std::vector<bool> isMatched(oldMod.subModuleInstanceNames.size(), false);
+  for(uint32_t newInsIndex = 0;
+      newInsIndex < newMod.subModuleInstanceNames.size(); newInsIndex++)
+  {
+    const auto &insName = newMod.subModuleInstanceNames[newInsIndex];
+    const auto &newSubMod = _newNetlist[newMod.subModuleDefIndexs[newInsIndex]];
+    auto it = oldInsIndexs.find(insName);
+    if(it == oldInsIndexs.end())
+    {
+      addDiff("+ " + newSubMod.moduleDefName + " " + insName);
+      continue;
+    }
+    const uint32_t &oldInsIndex = it->second;
+    isMatched[oldInsIndex] = true;
+    const uint32_t &oldSubModDefIndex = oldMod.subModuleDefIndexs[oldInsIndex];
+    const auto &oldSubMod = _oldNetlist[oldSubModDefIndex];
+    if(oldSubMod.moduleDefName != newSubMod.moduleDefName)
+    {
+      addDiff("~ " + insName + ": " + oldSubMod.moduleDefName + " -> " +
+              newSubMod.moduleDefName);
+      continue;
+    }
+    // A port which is only in one module definition is reported there.
+    const auto &oldPortIndexs = getOldPortIndexs(oldSubModDefIndex);
+    const auto &oldPortAssignments =
+      oldMod.portAssignmentsOfSubModInss[oldInsIndex];
+    const auto &newPortAssignments =
+      newMod.portAssignmentsOfSubModInss[newInsIndex];
+    for(uint32_t portDefIndex = 0; portDefIndex < newPortAssignments.size();
+        portDefIndex++)
+    {
+      const auto &portName = newSubMod.ports[portDefIndex].portDefName;
+      auto portIt = oldPortIndexs.find(portName);
+      if(portIt == oldPortIndexs.end() ||
+         portIt->second >= oldPortAssignments.size())
+        continue;
+      const std::string oldPinName =
+        getPinName(oldMod, oldPortAssignments[portIt->second]);
+      const std::string newPinName =
+        getPinName(newMod, newPortAssignments[portDefIndex]);
+      if(oldPinName != newPinName)
+        addDiff("~ " + insName + "." + portName + ": " + oldPinName + " -> " +
+                newPinName);
+    }
+  }
+  for(uint32_t insIndex = 0; insIndex < oldMod.subModuleInstanceNames.size();
+      insIndex++)
+  {
+    if(!isMatched[insIndex])
+      addDiff("- " +
+              _oldNetlist[oldMod.subModuleDefIndexs[insIndex]].moduleDefName +
+              " " + oldMod.subModuleInstanceNames[insIndex]);
+  }
+}
+
+void NetlistDiffer::diffAssigns(const Module &oldMod, const Module &newMod)
+{
+  auto getAssignName = [](const Module &oneMod,
+                          const BitSlicedAssignStatement &oneAssign)
+  {
+    return "assign " + getRefVarName(oneMod, oneAssign.lValue) + " = " +
+           getRefVarName(oneMod, oneAssign.rValue);
+  };
+  // The same assign statement may be written more than once.
+  std::unordered_map<std::string, int64_t> totalOldAssigns;
+  for(const auto &oneAssign: oldMod.assigns)
+    totalOldAssigns[getAssignName(oldMod, oneAssign)]++;
+  for(const auto &oneAssign: newMod.assigns)
+    totalOldAssigns[getAssignName(newMod, oneAssign)]--;
+  for(const auto &oneAssign: oldMod.assigns)
+  {
+    const std::string assignName = getAssignName(oldMod, oneAssign);
+    auto &totalAssigns = totalOldAssigns[assignName];
+    if(totalAssigns > 0)
+    {
+      totalAssigns--;
+      addDiff("- " + assignName);
+    }
+  }
+  for(const auto &oneAssign: newMod.assigns)
+  {
+    const std::string assignName = getAssignName(newMod, oneAssign);
+    auto &totalAssigns = totalOldAssigns[assignName];
+    if(totalAssigns < 0)
+    {
+      totalAssigns++;
+      addDiff("+ " + assignName);
+    }
+  }
+}
+
+} // namespace
+
+uint64_t diffNetlists(const std::vector<Module> &oldNetlist,
+                      const uint32_t &oldTotalUsedBlackBoxes,
+                      const std::vector<Module> &newNetlist,
+                      const uint32_t &newTotalUsedBlackBoxes,
+                      std::ostream &os)
+{
+  const auto isOldCompared =
+    getComparedMods(oldNetlist, oldTotalUsedBlackBoxes);
+  const auto isNewCompared =
+    getComparedMods(newNetlist, newTotalUsedBlackBoxes);
+  NameIndexs oldModIndexs;
+  for(uint32_t modDefIndex = 0; modDefIndex < oldNetlist.size(); modDefIndex++)
+  {
+    if(isOldCompared[modDefIndex])
+      oldModIndexs.emplace(oldNetlist[modDefIndex].moduleDefName, modDefIndex);
+  }
+  std::vector<bool> isMatched(oldNetlist.size(), false);
+  NetlistDiffer netlistDiffer(oldNetlist, newNetlist);
+  for(uint32_t modDefIndex = 0; modDefIndex < newNetlist.size(); modDefIndex++)
+  {
+    if(!isNewCompared[modDefIndex])
+      continue;
+    const auto &modName = newNetlist[modDefIndex].moduleDefName;
+    auto it = oldModIndexs.find(modName);
+    if(it == oldModIndexs.end())
+    {
+      os << "+ module " << modName << std::endl;
+      netlistDiffer.addModDiff();
+      continue;
+    }
+    isMatched[it->second] = true;
+    const std::string modDiffs = netlistDiffer.diffModule(it->second,
+                                                          modDefIndex);
+    if(!modDiffs.empty())
+      os << "module " << modName << std::endl << modDiffs;
+  }
+  for(uint32_t modDefIndex = 0; modDefIndex < oldNetlist.size(); modDefIndex++)
+  {
+    if(isOldCompared[modDefIndex] && !isMatched[modDefIndex])
+    {
+      os << "- module " << oldNetlist[modDefIndex].moduleDefName << std::endl;
+      netlistDiffer.addModDiff();
+    }
+  }
+  return netlistDiffer.getTotalDiffs();
+}
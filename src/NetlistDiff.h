@@ -0,0 +1,30 @@
+/*************************************************************************
+  > File Name: NetlistDiff.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+#pragma once
+#include "OneBitNetlist.h"
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+// Compare two netlists by names instead of by text, so the order of modules,
+// ports, instances, pins and assign statements doesn't matter. Modules are
+// matched by module name, ports and instances by their names in a module,
+// and pins by port name and bit. Every lookup uses a hash table, so it runs
+// in linear time of the netlist size.
+//
+// Only the top modules, whose level is the same as the first module after
+// all black boxes, and the modules they instance are compared, so the
+// modules which have been inlined into a flattened netlist are skipped.
+//
+// Every difference is written as one line into os, "-" for something only
+// in oldNetlist, "+" for something only in newNetlist and "~" for something
+// changed, and the number of differences is returned.
+uint64_t diffNetlists(const std::vector<Module> &oldNetlist,
+                      const uint32_t &oldTotalUsedBlackBoxes,
+                      const std::vector<Module> &newNetlist,
+                      const uint32_t &newTotalUsedBlackBoxes,
+                      std::ostream &os);
@@ -0,0 +1,169 @@
+/*************************************************************************
+  > File Name: NetlistHypergraph.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistHypergraph.h"
+#include "FlatNetlistIndex.h"
+#include "NetlistWriter.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+
+// "VNHG" and the version of the file layout
+const uint32_t HYPERGRAPH_CSR_MAGIC = 0x47484E56;
+const uint32_t HYPERGRAPH_CSR_VERSION = 1;
+
+} // namespace
+
+NetlistHypergraph buildNetlistHypergraph(
+  const std::vector<Module> &flatNetlist, const uint32_t &flatModDefIndex,
+  const uint32_t &totalUsedBlackBoxes,
+  const std::vector<UsedStdCell> &usedStdCells)
+{
+  const auto &flatMod = flatNetlist[flatModDefIndex];
+  const uint32_t totalInss = flatMod.subModuleDefIndexs.size();
+  FlatNetlistIndex index(flatNetlist, flatModDefIndex);
+  NetUnionFind netUnionFind(index.getTotalNets());
+  netUnionFind.uniteAssigns(index, flatMod);
+  const uint32_t totalNets = index.getTotalNets();
+  NetlistHypergraph hypergraph;
+  hypergraph.totalVertices = totalInss;
+
+  // A pin is skipped if its net set is tied to a constant, or if the same
+  // instance has been counted in the net set.
+  std::vector<bool> isConstRoot(totalNets, false);
+  for(uint32_t netId = index.getTotalNetsExcludingConsts(); netId < totalNets;
+      netId++)
+    isConstRoot[netUnionFind.find(netId)] = true;
+  std::vector<uint32_t> lastInsOfRoots(totalNets, UINT32_MAX);
+  auto forEachRoot = [&](auto &&oneRoot)
+  {
+    lastInsOfRoots.assign(totalNets, UINT32_MAX);
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      for(const auto &portAssignment:
+          flatMod.portAssignmentsOfSubModInss[insIndex])
+      {
+        for(const auto &refVar: portAssignment.refVars)
+        {
+          const uint32_t netRootId =
+            netUnionFind.find(index.getNetId(refVar));
+          if(isConstRoot[netRootId] || lastInsOfRoots[netRootId] == insIndex)
+            continue;
+          lastInsOfRoots[netRootId] = insIndex;
+          oneRoot(insIndex, netRootId);
+        }
+      }
+    }
+  };
+  std::vector<uint32_t> rootTotalInss(totalNets, 0);
+  forEachRoot([&](uint32_t, uint32_t netRootId)
+              { rootTotalInss[netRootId]++; });
+  // rootEdgeIds[netRootId] is UINT32_MAX if it connects less than two
+  // instances.
+  std::vector<uint32_t> rootEdgeIds(totalNets, UINT32_MAX);
+  for(uint32_t netRootId = 0; netRootId < totalNets; netRootId++)
+  {
+    if(rootTotalInss[netRootId] < 2)
+      continue;
+    rootEdgeIds[netRootId] = hypergraph.edgeNetIds.size();
+    hypergraph.edgeNetIds.push_back(netRootId);
+    hypergraph.edgeStarts.push_back(hypergraph.edgeStarts.back() +
+                                    rootTotalInss[netRootId]);
+  }
+  hypergraph.edgePins.resize(hypergraph.edgeStarts.back());
+  std::vector<uint32_t> edgeEnds(hypergraph.edgeStarts.begin(),
+                                 hypergraph.edgeStarts.end() - 1);
+  forEachRoot(
+    [&](uint32_t insIndex, uint32_t netRootId)
+    {
+      if(rootEdgeIds[netRootId] != UINT32_MAX)
+        hypergraph.edgePins[edgeEnds[rootEdgeIds[netRootId]]++] = insIndex;
+    });
+
+  bool hasArea = false;
+  for(uint32_t blackBoxDefIndex = 0; blackBoxDefIndex < totalUsedBlackBoxes;
+      blackBoxDefIndex++)
+    hasArea |= usedStdCells[blackBoxDefIndex].area > 0;
+  if(!hasArea)
+    return hypergraph;
+  // A sub module always has a bigger index than its parent.
+  std::vector<uint32_t> modWeights(flatNetlist.size(), 1);
+  for(uint32_t blackBoxDefIndex = 0; blackBoxDefIndex < totalUsedBlackBoxes;
+      blackBoxDefIndex++)
+  {
+    modWeights[blackBoxDefIndex] = std::max<uint32_t>(
+      1, std::lround(usedStdCells[blackBoxDefIndex].area));
+  }
+  for(uint32_t modDefIndex = flatNetlist.size() - 1;
+      modDefIndex > flatModDefIndex; modDefIndex--)
+  {
+    if(flatNetlist[modDefIndex].subModuleDefIndexs.empty())
+      continue;
+    const auto &hardMacro = flatNetlist[modDefIndex];
+    modWeights[modDefIndex] = 0;
+    for(const auto &subModDefIndex: hardMacro.subModuleDefIndexs)
+      modWeights[modDefIndex] += modWeights[subModDefIndex];
+  }
+  hypergraph.vertexWeights.reserve(totalInss);
+  for(const auto &subModDefIndex: flatMod.subModuleDefIndexs)
+    hypergraph.vertexWeights.push_back(modWeights[subModDefIndex]);
+  return hypergraph;
+}
+
+void writeHgr(const NetlistHypergraph &hypergraph, std::ostream &os)
+{
+  std::string buffer = std::to_string(hypergraph.getTotalEdges()) + " " +
+                       std::to_string(hypergraph.totalVertices) +
+                       (hypergraph.vertexWeights.empty() ? "\n" : " 10\n");
+  auto flushIfFull = [&]()
+  {
+    if(buffer.size() < NETLIST_WRITER_BUFFER_BYTES)
+      return;
+    os.write(buffer.data(), buffer.size());
+    buffer.clear();
+  };
+  for(uint32_t edgeId = 0; edgeId < hypergraph.getTotalEdges(); edgeId++)
+  {
+    for(uint32_t pinIndex = hypergraph.edgeStarts[edgeId];
+        pinIndex < hypergraph.edgeStarts[edgeId + 1]; pinIndex++)
+    {
+      if(pinIndex != hypergraph.edgeStarts[edgeId])
+        buffer += ' ';
+      buffer += std::to_string(hypergraph.edgePins[pinIndex] + 1);
+    }
+    buffer += '\n';
+    flushIfFull();
+  }
+  for(const auto &vertexWeight: hypergraph.vertexWeights)
+  {
+    buffer += std::to_string(vertexWeight) + "\n";
+    flushIfFull();
+  }
+  os.write(buffer.data(), buffer.size());
+}
+
+void writeHypergraphCsr(const NetlistHypergraph &hypergraph, std::ostream &os)
+{
+  auto writeU32s = [&os](const uint32_t *numbers, const size_t &size)
+  {
+    os.write(reinterpret_cast<const char *>(numbers),
+              size * sizeof(uint32_t));
+  };
+  const uint32_t header[] = { HYPERGRAPH_CSR_MAGIC,
+                              HYPERGRAPH_CSR_VERSION,
+                              hypergraph.totalVertices,
+                              hypergraph.getTotalEdges(),
+                              uint32_t(hypergraph.edgePins.size()),
+                              !hypergraph.vertexWeights.empty() };
+  writeU32s(header, sizeof(header) / sizeof(header[0]));
+  writeU32s(hypergraph.edgeStarts.data(), hypergraph.edgeStarts.size());
+  writeU32s(hypergraph.edgePins.data(), hypergraph.edgePins.size());
+  writeU32s(hypergraph.vertexWeights.data(), hypergraph.vertexWeights.size());
+}
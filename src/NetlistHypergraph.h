@@ -0,0 +1,48 @@
+/*************************************************************************
+  > File Name: NetlistHypergraph.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+#pragma once
+#include "OneBitNetlist.h"
+#include "StdCellLibrary.h"
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// A flattened module as a hypergraph: vertex i is the i-th instance of the
+// module, and a hyperedge is a net set, i.e. nets connected by assign
+// statements, which connects two or more instances. Nets tied to constants
+// are not hyperedges. Vertices of hyperedge e are
+// [edgeStarts[e], edgeStarts[e + 1]) of edgePins.
+struct NetlistHypergraph
+{
+    uint32_t totalVertices = 0;
+    std::vector<uint32_t> edgeStarts = { 0 };
+    std::vector<uint32_t> edgePins;
+    // Empty if no used std cell has an area in the library.
+    std::vector<uint32_t> vertexWeights;
+    // edgeNetIds[e] is the net id of the root of hyperedge e, see
+    // FlatNetlistIndex.
+    std::vector<uint32_t> edgeNetIds;
+    uint32_t getTotalEdges() const { return edgeStarts.size() - 1; };
+};
+
+// Build the hypergraph in linear time of the number of pins. The weight of
+// a std cell instance is its area rounded to an integer, at least 1, and
+// the weight of a hard macro instance is the sum of its instances.
+NetlistHypergraph buildNetlistHypergraph(
+  const std::vector<Module> &flatNetlist, const uint32_t &flatModDefIndex,
+  const uint32_t &totalUsedBlackBoxes,
+  const std::vector<UsedStdCell> &usedStdCells);
+
+// Write the hMETIS format: "totalEdges totalVertices [10]", one line of 1
+// based vertices per hyperedge, then one line per vertex weight.
+void writeHgr(const NetlistHypergraph &hypergraph, std::ostream &os);
+
+// Write a binary file in the native byte order: "VNHG", version,
+// totalVertices, totalEdges, totalPins and whether there are weights as
+// uint32_t, then edgeStarts, edgePins and vertexWeights as uint32_t arrays.
+void writeHypergraphCsr(const NetlistHypergraph &hypergraph, std::ostream &os);
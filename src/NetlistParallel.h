@@ -0,0 +1,69 @@
+/*************************************************************************
+  > File Name: NetlistParallel.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <vector>
+
+// The number of threads used by netlist algorithms, 0 means all hardware
+// threads.
+inline uint32_t getTotalNetlistThreads(const uint32_t &totalThreads)
+{
+  if(totalThreads)
+    return totalThreads;
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Call oneTask(taskIndex) for every taskIndex in [taskBegin, taskEnd) with at
+// most totalThreads threads. Tasks are handed out one by one, so a task must
+// only write its own results if the results should not depend on threads.
+// The first exception thrown by a task is thrown again after all threads
+// finish.
+template <typename OneTask>
+void parallelFor(const uint32_t &taskBegin, const uint32_t &taskEnd,
+                 const uint32_t &totalThreads, OneTask &&oneTask)
+{
+  if(taskBegin >= taskEnd)
+    return;
+  const uint32_t totalWorkers =
+    std::min(getTotalNetlistThreads(totalThreads), taskEnd - taskBegin);
+  if(totalWorkers == 1)
+  {
+    for(uint32_t taskIndex = taskBegin; taskIndex < taskEnd; taskIndex++)
+      oneTask(taskIndex);
+    return;
+  }
+  std::atomic<uint32_t> nextTaskIndex(taskBegin);
+  std::atomic<bool> hasException(false);
+  std::exception_ptr firstException;
+  auto work = [&]()
+  {
+    try
+    {
+      uint32_t taskIndex;
+      while(!hasException && (taskIndex = nextTaskIndex++) < taskEnd)
+        oneTask(taskIndex);
+    }
+    catch(...)
+    {
+      if(!hasException.exchange(true))
+        firstException = std::current_exception();
+    }
+  };
+  std::vector<std::thread> workers;
+  for(uint32_t workerIndex = 1; workerIndex < totalWorkers; workerIndex++)
+    workers.emplace_back(work);
+  work();
+  for(auto &worker: workers)
+    worker.join();
+  if(firstException)
+    std::rethrow_exception(firstException);
+}
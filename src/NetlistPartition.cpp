@@ -0,0 +1,647 @@
+/*************************************************************************
+  > File Name: NetlistPartition.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "config_build.h"
+
+#include "NetlistPartition.h"
+#include "NetlistParallel.h"
+#include "V3Scoreboard.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+
+namespace
+{
+
+// Coarsening stops at this number of vertices, or if a level shrinks less
+// than minShrinkRatio.
+const uint32_t coarsestVertices = 160;
+const double minShrinkRatio = 0.95;
+// Bigger hyperedges, like clock and reset nets, don't attract matching.
+const uint32_t maxRatedEdgeSize = 64;
+const uint32_t totalInitialTries = 8;
+const uint32_t maxFmPasses = 8;
+// A pass of FM stops after 50 + 1% of vertices moves without improvement.
+const uint32_t minFmUselessMoves = 50;
+
+// A weighted hypergraph with both directions of incidence.
+struct Hypergraph
+{
+    std::vector<uint32_t> vertexWeights;
+    std::vector<uint32_t> edgeStarts = { 0 };
+    std::vector<uint32_t> edgePins;
+    std::vector<uint32_t> edgeWeights;
+    // Edges of vertex v are [vertexStarts[v], vertexStarts[v + 1]) of
+    // vertexEdges, built by buildIncidence.
+    std::vector<uint32_t> vertexStarts;
+    std::vector<uint32_t> vertexEdges;
+    uint32_t getTotalVertices() const { return vertexWeights.size(); };
+    uint32_t getTotalEdges() const { return edgeWeights.size(); };
+    uint64_t getTotalWeight() const
+    {
+      return std::accumulate(vertexWeights.begin(), vertexWeights.end(),
+                             uint64_t(0));
+    };
+    uint32_t getMaxVertexWeight() const
+    {
+      return vertexWeights.empty() ? 0
+                                   : *std::max_element(vertexWeights.begin(),
+                                                       vertexWeights.end());
+    };
+    void addEdge(const uint32_t *pinsBegin, const uint32_t *pinsEnd,
+                 const uint32_t &edgeWeight)
+    {
+      edgePins.insert(edgePins.end(), pinsBegin, pinsEnd);
+      edgeStarts.push_back(edgePins.size());
+      edgeWeights.push_back(edgeWeight);
+    };
+    void buildIncidence()
+    {
+      vertexStarts.assign(getTotalVertices() + 1, 0);
+      for(const auto &pin: edgePins)
+        vertexStarts[pin + 1]++;
+      std::partial_sum(vertexStarts.begin(), vertexStarts.end(),
+                       vertexStarts.begin());
+      vertexEdges.resize(edgePins.size());
+      std::vector<uint32_t> vertexEnds(vertexStarts.begin(),
+                                       vertexStarts.end() - 1);
+      for(uint32_t edgeId = 0; edgeId < getTotalEdges(); edgeId++)
+      {
+        for(uint32_t pinIndex = edgeStarts[edgeId];
+            pinIndex < edgeStarts[edgeId + 1]; pinIndex++)
+          vertexEdges[vertexEnds[edgePins[pinIndex]]++] = edgeId;
+      }
+    };
+};
+
+// Heavy edge matching: every unmatched vertex, in random order, is matched
+// with the unmatched neighbor of the highest rating, which is the sum of
+// w(e) / (|e| - 1) of their shared hyperedges. Identical hyperedges of the
+// coarse hypergraph are merged and their weights are added.
+Hypergraph coarsen(const Hypergraph &fine, std::vector<uint32_t> &coarseIds,
+                   const uint64_t &maxVertexWeight, std::mt19937 &rng)
+{
+  const uint32_t totalVertices = fine.getTotalVertices();
+  std::vector<uint32_t> order(totalVertices);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), rng);
+  coarseIds.assign(totalVertices, UINT32_MAX);
+  std::vector<double> ratings(totalVertices, 0);
+  std::vector<uint32_t> ratedVertices;
+  uint32_t totalCoarseVertices = 0;
+  Hypergraph coarse;
+  for(const auto &vertex: order)
+  {
+    if(coarseIds[vertex] != UINT32_MAX)
+      continue;
+    for(uint32_t incidence = fine.vertexStarts[vertex];
+        incidence < fine.vertexStarts[vertex + 1]; incidence++)
+    {
+      const uint32_t edgeId = fine.vertexEdges[incidence];
+      const uint32_t edgeSize =
+        fine.edgeStarts[edgeId + 1] - fine.edgeStarts[edgeId];
+      if(edgeSize > maxRatedEdgeSize)
+        continue;
+      const double rating = double(fine.edgeWeights[edgeId]) / (edgeSize - 1);
+      for(uint32_t pinIndex = fine.edgeStarts[edgeId];
+          pinIndex < fine.edgeStarts[edgeId + 1]; pinIndex++)
+      {
+        const uint32_t neighbor = fine.edgePins[pinIndex];
+        if(neighbor == vertex || coarseIds[neighbor] != UINT32_MAX)
+          continue;
+        if(ratings[neighbor] == 0)
+          ratedVertices.push_back(neighbor);
+        ratings[neighbor] += rating;
+      }
+    }
+    uint32_t bestNeighbor = UINT32_MAX;
+    double bestRating = 0;
+    for(const auto &neighbor: ratedVertices)
+    {
+      if(ratings[neighbor] > bestRating &&
+         fine.vertexWeights[vertex] + fine.vertexWeights[neighbor] <=
+           maxVertexWeight)
+      {
+        bestNeighbor = neighbor;
+        bestRating = ratings[neighbor];
+      }
+      ratings[neighbor] = 0;
+    }
+    ratedVertices.clear();
+    coarseIds[vertex] = totalCoarseVertices;
+    coarse.vertexWeights.push_back(fine.vertexWeights[vertex]);
+    if(bestNeighbor != UINT32_MAX)
+    {
+      coarseIds[bestNeighbor] = totalCoarseVertices;
+      coarse.vertexWeights.back() += fine.vertexWeights[bestNeighbor];
+    }
+    totalCoarseVertices++;
+  }
+
+  std::unordered_map<uint64_t, uint32_t> edgeIdsByHash;
+  std::vector<uint32_t> pins;
+  for(uint32_t edgeId = 0; edgeId < fine.getTotalEdges(); edgeId++)
+  {
+    pins.clear();
+    for(uint32_t pinIndex = fine.edgeStarts[edgeId];
+        pinIndex < fine.edgeStarts[edgeId + 1]; pinIndex++)
+      pins.push_back(coarseIds[fine.edgePins[pinIndex]]);
+    std::sort(pins.begin(), pins.end());
+    pins.erase(std::unique(pins.begin(), pins.end()), pins.end());
+    if(pins.size() < 2)
+      continue;
+    uint64_t hash = pins.size();
+    for(const auto &pin: pins)
+      hash = hash * 0x100000001b3ull ^ pin;
+    const auto it = edgeIdsByHash.find(hash);
+    if(it != edgeIdsByHash.end())
+    {
+      const uint32_t sameEdgeId = it->second;
+      if(std::equal(pins.begin(), pins.end(),
+                    coarse.edgePins.begin() + coarse.edgeStarts[sameEdgeId],
+                    coarse.edgePins.begin() +
+                      coarse.edgeStarts[sameEdgeId + 1]))
+      {
+        coarse.edgeWeights[sameEdgeId] += fine.edgeWeights[edgeId];
+        continue;
+      }
+    }
+    else
+      edgeIdsByHash.emplace(hash, coarse.getTotalEdges());
+    coarse.addEdge(pins.data(), pins.data() + pins.size(),
+                   fine.edgeWeights[edgeId]);
+  }
+  coarse.buildIncidence();
+  return coarse;
+}
+
+// Cut and balance of a bisection, a smaller one is better.
+struct BisectionCost
+{
+    uint64_t overweight = 0;
+    int64_t cut = 0;
+    bool operator<(const BisectionCost &other) const
+    {
+      return overweight != other.overweight ? overweight < other.overweight
+                                            : cut < other.cut;
+    };
+};
+
+// Gain of moving a vertex to the other side
+struct FmVertex
+{
+    int64_t gain;
+    uint32_t vertex;
+    // True if the vertex has been added to the scoreboard of its side.
+    bool isQueued;
+    bool operator<(const FmVertex &other) const
+    {
+      return vertex < other.vertex;
+    };
+};
+// V3Scoreboard returns the lowest score first.
+int64_t getFmScore(const FmVertex *fmVertex) { return -fmVertex->gain; }
+
+class Bisection final
+{
+  private:
+    const Hypergraph &_graph;
+    const uint64_t *_maxSideWeights;
+    std::vector<uint8_t> &_sides;
+    uint64_t _sideWeights[2] = { 0, 0 };
+    // _pinCounts[2 * edgeId + side] is the number of pins on side.
+    std::vector<uint32_t> _pinCounts;
+    int64_t _cut = 0;
+    uint64_t getOverweight() const
+    {
+      uint64_t overweight = 0;
+      for(const uint32_t side: { 0, 1 })
+      {
+        if(_sideWeights[side] > _maxSideWeights[side])
+          overweight += _sideWeights[side] - _maxSideWeights[side];
+      }
+      return overweight;
+    };
+    int64_t getGain(const uint32_t &vertex) const;
+    // Move a vertex and update the gains of unlocked vertices.
+    void move(const uint32_t &vertex, std::vector<FmVertex> &fmVertices,
+              const std::vector<bool> &isLocked,
+              V3Scoreboard<FmVertex, int64_t> *scoreboards[2]);
+    bool refineOnePass();
+
+  public:
+    Bisection(const Hypergraph &graph, const uint64_t *maxSideWeights,
+              std::vector<uint8_t> &sides);
+    BisectionCost getCost() const { return { getOverweight(), _cut }; };
+    void refine()
+    {
+      for(uint32_t pass = 0; pass < maxFmPasses; pass++)
+      {
+        if(!refineOnePass())
+          break;
+      }
+    };
+};
+
+Bisection::Bisection(const Hypergraph &graph, const uint64_t *maxSideWeights,
+                     std::vector<uint8_t> &sides)
+  : _graph(graph), _maxSideWeights(maxSideWeights), _sides(sides),
+    _pinCounts(2 * graph.getTotalEdges(), 0)
+{
+  for(uint32_t vertex = 0; vertex < graph.getTotalVertices(); vertex++)
+    _sideWeights[sides[vertex]] += graph.vertexWeights[vertex];
+  for(uint32_t edgeId = 0; edgeId < graph.getTotalEdges(); edgeId++)
+  {
+    for(uint32_t pinIndex = graph.edgeStarts[edgeId];
+        pinIndex < graph.edgeStarts[edgeId + 1]; pinIndex++)
+      _pinCounts[2 * edgeId + sides[graph.edgePins[pinIndex]]]++;
+    if(_pinCounts[2 * edgeId] && _pinCounts[2 * edgeId + 1])
+      _cut += graph.edgeWeights[edgeId];
+  }
+}
+
+int64_t Bisection::getGain(const uint32_t &vertex) const
+{
+  const uint32_t from = _sides[vertex];
+  int64_t gain = 0;
+  for(uint32_t incidence = _graph.vertexStarts[vertex];
+      incidence < _graph.vertexStarts[vertex + 1]; incidence++)
+  {
+    const uint32_t edgeId = _graph.vertexEdges[incidence];
+    if(_pinCounts[2 * edgeId + from] == 1)
+      gain += _graph.edgeWeights[edgeId];
+    if(_pinCounts[2 * edgeId + (from ^ 1)] == 0)
+      gain -= _graph.edgeWeights[edgeId];
+  }
+  return gain;
+}
+
+// The classic update rules of Fiduccia and Mattheyses, only the pins of a
+// hyperedge with 0 or 1 pins on one side change their gains.
+void Bisection::move(const uint32_t &vertex, std::vector<FmVertex> &fmVertices,
+                     const std::vector<bool> &isLocked,
+                     V3Scoreboard<FmVertex, int64_t> *scoreboards[2])
+{
+  const uint32_t from = _sides[vertex];
+  const uint32_t to = from ^ 1;
+  auto addGain = [&](const uint32_t &edgeId, const int64_t &delta,
+                     const int &onlySide)
+  {
+    for(uint32_t pinIndex = _graph.edgeStarts[edgeId];
+        pinIndex < _graph.edgeStarts[edgeId + 1]; pinIndex++)
+    {
+      const uint32_t pin = _graph.edgePins[pinIndex];
+      if(isLocked[pin] || pin == vertex ||
+         (onlySide >= 0 && _sides[pin] != onlySide))
+        continue;
+      fmVertices[pin].gain += delta;
+      if(fmVertices[pin].isQueued)
+        scoreboards[_sides[pin]]->hintScoreChanged(&fmVertices[pin]);
+      else
+      {
+        fmVertices[pin].isQueued = true;
+        scoreboards[_sides[pin]]->addElem(&fmVertices[pin]);
+      }
+    }
+  };
+  _cut -= fmVertices[vertex].gain;
+  for(uint32_t incidence = _graph.vertexStarts[vertex];
+      incidence < _graph.vertexStarts[vertex + 1]; incidence++)
+  {
+    const uint32_t edgeId = _graph.vertexEdges[incidence];
+    const int64_t edgeWeight = _graph.edgeWeights[edgeId];
+    uint32_t &fromCount = _pinCounts[2 * edgeId + from];
+    uint32_t &toCount = _pinCounts[2 * edgeId + to];
+    if(toCount == 0)
+      addGain(edgeId, edgeWeight, -1);
+    else if(toCount == 1)
+      addGain(edgeId, -edgeWeight, to);
+    fromCount--;
+    toCount++;
+    if(fromCount == 0)
+      addGain(edgeId, -edgeWeight, -1);
+    else if(fromCount == 1)
+      addGain(edgeId, edgeWeight, from);
+  }
+  _sides[vertex] = to;
+  _sideWeights[from] -= _graph.vertexWeights[vertex];
+  _sideWeights[to] += _graph.vertexWeights[vertex];
+}
+
+// Move unlocked vertices of the highest gain one by one, as long as the
+// moved side doesn't become too heavy, and go back to the best cost.
+bool Bisection::refineOnePass()
+{
+  const uint32_t totalVertices = _graph.getTotalVertices();
+  std::vector<FmVertex> fmVertices(totalVertices);
+  V3Scoreboard<FmVertex, int64_t> scoreboard0(&getFmScore, false);
+  V3Scoreboard<FmVertex, int64_t> scoreboard1(&getFmScore, false);
+  V3Scoreboard<FmVertex, int64_t> *scoreboards[2] = { &scoreboard0,
+                                                      &scoreboard1 };
+  // Only vertices on the cut, or on a side which is too heavy, are added at
+  // first. Other vertices are added by move once their gains change.
+  for(uint32_t vertex = 0; vertex < totalVertices; vertex++)
+  {
+    fmVertices[vertex] = { getGain(vertex), vertex, false };
+    bool isCandidate =
+      _sideWeights[_sides[vertex]] > _maxSideWeights[_sides[vertex]];
+    for(uint32_t incidence = _graph.vertexStarts[vertex];
+        !isCandidate && incidence < _graph.vertexStarts[vertex + 1];
+        incidence++)
+    {
+      const uint32_t edgeId = _graph.vertexEdges[incidence];
+      isCandidate = _pinCounts[2 * edgeId] && _pinCounts[2 * edgeId + 1];
+    }
+    if(isCandidate)
+    {
+      fmVertices[vertex].isQueued = true;
+      scoreboards[_sides[vertex]]->addElem(&fmVertices[vertex]);
+    }
+  }
+  std::vector<bool> isLocked(totalVertices, false);
+  std::vector<uint32_t> moves;
+  const BisectionCost startCost = getCost();
+  BisectionCost bestCost = startCost;
+  uint32_t bestTotalMoves = 0;
+  const uint32_t maxUselessMoves = minFmUselessMoves + totalVertices / 100;
+  while(moves.size() - bestTotalMoves <= maxUselessMoves)
+  {
+    const FmVertex *best = nullptr;
+    for(const uint32_t side: { 0, 1 })
+    {
+      scoreboards[side]->rescore();
+      const FmVertex *candidate = scoreboards[side]->bestp();
+      if(!candidate)
+        continue;
+      const uint32_t weight = _graph.vertexWeights[candidate->vertex];
+      // A move is allowed if the other side isn't too heavy after it, or
+      // if this side is too heavy.
+      if(_sideWeights[side ^ 1] + weight > _maxSideWeights[side ^ 1] &&
+         _sideWeights[side] <= _maxSideWeights[side])
+        continue;
+      if(!best || candidate->gain > best->gain ||
+         (candidate->gain == best->gain &&
+          _sideWeights[side] > _sideWeights[_sides[best->vertex]]))
+        best = candidate;
+    }
+    if(!best)
+      break;
+    const uint32_t vertex = best->vertex;
+    scoreboards[_sides[vertex]]->removeElem(best);
+    isLocked[vertex] = true;
+    move(vertex, fmVertices, isLocked, scoreboards);
+    moves.push_back(vertex);
+    if(getCost() < bestCost)
+    {
+      bestCost = getCost();
+      bestTotalMoves = moves.size();
+    }
+  }
+  // Undo the moves after the best cost, the gains aren't needed any more.
+  isLocked.assign(totalVertices, true);
+  while(moves.size() > bestTotalMoves)
+  {
+    const uint32_t vertex = moves.back();
+    moves.pop_back();
+    fmVertices[vertex].gain = getGain(vertex);
+    move(vertex, fmVertices, isLocked, scoreboards);
+  }
+  return bestCost < startCost;
+}
+
+// Grow side 0 by breadth first search from a random vertex until it
+// reaches its target weight.
+void growBisection(const Hypergraph &graph, const uint64_t &targetWeight,
+                   std::mt19937 &rng, std::vector<uint8_t> &sides)
+{
+  const uint32_t totalVertices = graph.getTotalVertices();
+  sides.assign(totalVertices, 1);
+  std::vector<bool> isVisited(totalVertices, false);
+  std::vector<uint32_t> queue;
+  std::vector<uint32_t> order(totalVertices);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), rng);
+  uint32_t orderIndex = 0;
+  uint64_t weight = 0;
+  size_t queueHead = 0;
+  while(weight < targetWeight)
+  {
+    if(queueHead == queue.size())
+    {
+      while(orderIndex < totalVertices && isVisited[order[orderIndex]])
+        orderIndex++;
+      if(orderIndex == totalVertices)
+        break;
+      queue.push_back(order[orderIndex]);
+      isVisited[order[orderIndex]] = true;
+    }
+    const uint32_t vertex = queue[queueHead++];
+    sides[vertex] = 0;
+    weight += graph.vertexWeights[vertex];
+    for(uint32_t incidence = graph.vertexStarts[vertex];
+        incidence < graph.vertexStarts[vertex + 1]; incidence++)
+    {
+      const uint32_t edgeId = graph.vertexEdges[incidence];
+      for(uint32_t pinIndex = graph.edgeStarts[edgeId];
+          pinIndex < graph.edgeStarts[edgeId + 1]; pinIndex++)
+      {
+        const uint32_t neighbor = graph.edgePins[pinIndex];
+        if(!isVisited[neighbor])
+        {
+          isVisited[neighbor] = true;
+          queue.push_back(neighbor);
+        }
+      }
+    }
+  }
+}
+
+// Multilevel bisection, side 0 gets side0Ratio of the total weight.
+std::vector<uint8_t> bisect(const Hypergraph &graph, const double &side0Ratio,
+                            const double &epsilon, const uint32_t &seed,
+                            const uint32_t &totalThreads)
+{
+  std::mt19937 rng(seed);
+  const uint64_t totalWeight = graph.getTotalWeight();
+  const uint64_t maxVertexWeight =
+    std::max<uint64_t>(graph.getMaxVertexWeight(),
+                       totalWeight / coarsestVertices);
+  std::vector<Hypergraph> coarseGraphs;
+  std::vector<std::vector<uint32_t>> coarseIdsOfLevels;
+  const Hypergraph *finest = &graph;
+  while(finest->getTotalVertices() > coarsestVertices)
+  {
+    std::vector<uint32_t> coarseIds;
+    Hypergraph coarse = coarsen(*finest, coarseIds, maxVertexWeight, rng);
+    if(coarse.getTotalVertices() >
+       minShrinkRatio * finest->getTotalVertices())
+      break;
+    coarseGraphs.push_back(std::move(coarse));
+    coarseIdsOfLevels.push_back(std::move(coarseIds));
+    finest = &coarseGraphs.back();
+  }
+
+  const uint64_t targetWeights[2] = {
+    static_cast<uint64_t>(std::ceil(side0Ratio * totalWeight)),
+    static_cast<uint64_t>(std::ceil((1 - side0Ratio) * totalWeight))
+  };
+  auto getMaxSideWeights = [&](const Hypergraph &levelGraph,
+                               uint64_t *maxSideWeights)
+  {
+    for(const uint32_t side: { 0, 1 })
+      maxSideWeights[side] = std::max<uint64_t>(
+        static_cast<uint64_t>(std::ceil((1 + epsilon) * targetWeights[side])),
+        targetWeights[side] + levelGraph.getMaxVertexWeight());
+  };
+
+  // Initial bisections of the coarsest level with different seeds
+  const Hypergraph &coarsest =
+    coarseGraphs.empty() ? graph : coarseGraphs.back();
+  uint64_t maxSideWeights[2];
+  getMaxSideWeights(coarsest, maxSideWeights);
+  std::vector<std::vector<uint8_t>> triedSides(totalInitialTries);
+  std::vector<BisectionCost> triedCosts(totalInitialTries);
+  parallelFor(0, totalInitialTries, totalThreads,
+              [&](const uint32_t &tryIndex)
+              {
+                std::mt19937 tryRng(seed * totalInitialTries + tryIndex);
+                growBisection(coarsest, targetWeights[0], tryRng,
+                              triedSides[tryIndex]);
+                Bisection bisection(coarsest, maxSideWeights,
+                                    triedSides[tryIndex]);
+                bisection.refine();
+                triedCosts[tryIndex] = bisection.getCost();
+              });
+  const uint32_t bestTryIndex =
+    std::min_element(triedCosts.begin(), triedCosts.end()) -
+    triedCosts.begin();
+  std::vector<uint8_t> sides = std::move(triedSides[bestTryIndex]);
+
+  // Project to finer levels and refine.
+  for(uint32_t level = coarseGraphs.size(); level > 0; level--)
+  {
+    const Hypergraph &fine = level == 1 ? graph : coarseGraphs[level - 2];
+    const auto &coarseIds = coarseIdsOfLevels[level - 1];
+    std::vector<uint8_t> fineSides(fine.getTotalVertices());
+    for(uint32_t vertex = 0; vertex < fine.getTotalVertices(); vertex++)
+      fineSides[vertex] = sides[coarseIds[vertex]];
+    sides = std::move(fineSides);
+    getMaxSideWeights(fine, maxSideWeights);
+    Bisection(fine, maxSideWeights, sides).refine();
+  }
+  return sides;
+}
+
+// A part of the hypergraph which is split into totalBlocks blocks, starting
+// from firstBlock.
+struct PartitionTask
+{
+    Hypergraph graph;
+    std::vector<uint32_t> vertices; // original vertex of every vertex
+    uint32_t firstBlock;
+    uint32_t totalBlocks;
+};
+
+// The vertices of one side, and the pins of hyperedges on this side
+PartitionTask extractSide(const PartitionTask &task,
+                          const std::vector<uint8_t> &sides,
+                          const uint8_t &side)
+{
+  PartitionTask subTask;
+  const Hypergraph &graph = task.graph;
+  std::vector<uint32_t> newIds(graph.getTotalVertices(), UINT32_MAX);
+  for(uint32_t vertex = 0; vertex < graph.getTotalVertices(); vertex++)
+  {
+    if(sides[vertex] != side)
+      continue;
+    newIds[vertex] = subTask.vertices.size();
+    subTask.vertices.push_back(task.vertices[vertex]);
+    subTask.graph.vertexWeights.push_back(graph.vertexWeights[vertex]);
+  }
+  std::vector<uint32_t> pins;
+  for(uint32_t edgeId = 0; edgeId < graph.getTotalEdges(); edgeId++)
+  {
+    pins.clear();
+    for(uint32_t pinIndex = graph.edgeStarts[edgeId];
+        pinIndex < graph.edgeStarts[edgeId + 1]; pinIndex++)
+    {
+      if(sides[graph.edgePins[pinIndex]] == side)
+        pins.push_back(newIds[graph.edgePins[pinIndex]]);
+    }
+    if(pins.size() >= 2)
+      subTask.graph.addEdge(pins.data(), pins.data() + pins.size(),
+                            graph.edgeWeights[edgeId]);
+  }
+  subTask.graph.buildIncidence();
+  return subTask;
+}
+
+} // namespace
+
+std::vector<uint32_t> partitionHypergraph(const NetlistHypergraph &hypergraph,
+                                          const uint32_t &totalBlocks,
+                                          const double &imbalance,
+                                          const uint32_t &totalThreads)
+{
+  std::vector<uint32_t> blocks(hypergraph.totalVertices, 0);
+  if(totalBlocks <= 1 || !hypergraph.totalVertices)
+    return blocks;
+  std::vector<PartitionTask> tasks(1);
+  auto &rootTask = tasks.front();
+  rootTask.graph.vertexWeights = hypergraph.vertexWeights;
+  rootTask.graph.vertexWeights.resize(hypergraph.totalVertices, 1);
+  rootTask.graph.edgeStarts = hypergraph.edgeStarts;
+  rootTask.graph.edgePins = hypergraph.edgePins;
+  rootTask.graph.edgeWeights.assign(hypergraph.getTotalEdges(), 1);
+  rootTask.graph.buildIncidence();
+  rootTask.vertices.resize(hypergraph.totalVertices);
+  std::iota(rootTask.vertices.begin(), rootTask.vertices.end(), 0);
+  rootTask.firstBlock = 0;
+  rootTask.totalBlocks = totalBlocks;
+  // Every level of bisections may use a part of the imbalance.
+  const double totalLevels = std::ceil(std::log2(totalBlocks));
+  const double epsilon = std::pow(1 + imbalance, 1 / totalLevels) - 1;
+  const uint32_t totalWorkers = getTotalNetlistThreads(totalThreads);
+  while(!tasks.empty())
+  {
+    std::vector<PartitionTask> subTasks(2 * tasks.size());
+    parallelFor(
+      0, tasks.size(), totalWorkers,
+      [&](const uint32_t &taskIndex)
+      {
+        PartitionTask &task = tasks[taskIndex];
+        if(task.totalBlocks == 1 || task.vertices.size() <= 1)
+        {
+          for(const auto &vertex: task.vertices)
+            blocks[vertex] = task.firstBlock;
+          return;
+        }
+        const uint32_t totalBlocks0 = task.totalBlocks / 2;
+        const std::vector<uint8_t> sides = bisect(
+          task.graph, double(totalBlocks0) / task.totalBlocks, epsilon,
+          task.firstBlock * totalBlocks + task.totalBlocks,
+          std::max<uint32_t>(1, totalWorkers / tasks.size()));
+        for(const uint8_t side: { 0, 1 })
+        {
+          PartitionTask &subTask = subTasks[2 * taskIndex + side];
+          subTask = extractSide(task, sides, side);
+          subTask.firstBlock = task.firstBlock + (side ? totalBlocks0 : 0);
+          subTask.totalBlocks =
+            side ? task.totalBlocks - totalBlocks0 : totalBlocks0;
+        }
+        task = PartitionTask();
+      });
+    subTasks.erase(std::remove_if(subTasks.begin(), subTasks.end(),
+                                  [](const PartitionTask &subTask)
+                                  { return subTask.vertices.empty(); }),
+                   subTasks.end());
+    tasks = std::move(subTasks);
+  }
+  return blocks;
+}
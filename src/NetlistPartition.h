@@ -0,0 +1,29 @@
+/*************************************************************************
+  > File Name: NetlistPartition.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+#pragma once
+#include "NetlistHypergraph.h"
+#include <cstdint>
+#include <vector>
+
+// Split the vertices of a hypergraph into totalBlocks blocks with few cut
+// hyperedges by recursive multilevel bisection:
+// 1. Coarsening: vertices are matched with the neighbor sharing the most
+//    small hyperedges and contracted, until the hypergraph is small enough.
+// 2. Initial partitioning: the coarsest hypergraph is bisected by growing a
+//    block from several random seeds, the best result is kept.
+// 3. Uncoarsening: the bisection is projected back level by level and
+//    refined by Fiduccia-Mattheyses moves, whose gains are kept in
+//    V3Scoreboard.
+// Every block weighs at most (1 + imbalance) times its share of the total
+// vertex weight, plus the weight of one vertex. Bisections of the same
+// level run in parallel with totalThreads threads, 0 means all hardware
+// threads, and the result doesn't depend on the number of threads.
+// blocks[vertex] is returned.
+std::vector<uint32_t> partitionHypergraph(const NetlistHypergraph &hypergraph,
+                                          const uint32_t &totalBlocks,
+                                          const double &imbalance,
+                                          const uint32_t &totalThreads = 1);
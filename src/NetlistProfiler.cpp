@@ -0,0 +1,163 @@
+/*************************************************************************
+  > File Name: NetlistProfiler.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistProfiler.h"
+#include "V3Global.h"
+#include "V3Stats.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+using SteadyClock = std::chrono::steady_clock;
+
+std::vector<NetlistStage> stages;
+SteadyClock::time_point lastStageEnd = SteadyClock::now();
+double lastCpuSecs = 0;
+
+// User and system time of all threads, peak RSS of the process
+void getResourceUsage(double &cpuSecs, uint64_t &peakRssBytes)
+{
+  cpuSecs = 0;
+  peakRssBytes = 0;
+#if !defined(_WIN32)
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage))
+    return;
+  cpuSecs = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+            (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1.0e6;
+#if defined(__APPLE__)
+  peakRssBytes = usage.ru_maxrss;
+#else
+  peakRssBytes = static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+// V3Os::memUsageBytes is the size of text and data, not the resident size.
+uint64_t getRssBytes()
+{
+#if defined(__linux__)
+  FILE *fp = fopen("/proc/self/statm", "r");
+  if(!fp)
+    return 0;
+  unsigned long long size = 0, resident = 0;
+  const int items = fscanf(fp, "%llu %llu", &size, &resident);
+  fclose(fp);
+  return items == 2 ? resident * sysconf(_SC_PAGESIZE) : 0;
+#else
+  return 0;
+#endif
+}
+
+void countNetlist(const std::vector<Module> &netlist, NetlistStage &stage)
+{
+  stage.totalModules = netlist.size();
+  for(const auto &oneMod: netlist)
+  {
+    stage.totalPorts += oneMod.ports.size();
+    stage.totalRefVars += oneMod.assigns.size() * 2;
+    stage.totalInss += oneMod.subModuleDefIndexs.size();
+    for(const auto &portAssignments: oneMod.portAssignmentsOfSubModInss)
+      for(const auto &portAssignment: portAssignments)
+        stage.totalRefVars += portAssignment.refVars.size();
+  }
+}
+
+void addStats(const uint32_t &stageNumber, const NetlistStage &stage)
+{
+  const std::string digitName =
+    V3Global::digitsFilename(stageNumber) + "_" + stage.name;
+  V3Stats::addStatPerf("Netlist stage, Elapsed time (sec), " + digitName,
+                       stage.wallSecs);
+  V3Stats::addStatPerf("Netlist stage, CPU time (sec), " + digitName,
+                       stage.cpuSecs);
+  V3Stats::addStatPerf("Netlist stage, Memory (MB), " + digitName,
+                       stage.rssBytes / 1024.0 / 1024.0);
+  V3Stats::addStatPerf("Netlist stage, Peak memory (MB), " + digitName,
+                       stage.peakRssBytes / 1024.0 / 1024.0);
+  if(!stage.totalModules)
+    return;
+  V3Stats::addStat("Netlist stage, Modules, " + digitName,
+                   stage.totalModules);
+  V3Stats::addStat("Netlist stage, Ports, " + digitName, stage.totalPorts);
+  V3Stats::addStat("Netlist stage, RefVars, " + digitName,
+                   stage.totalRefVars);
+  V3Stats::addStat("Netlist stage, Instances, " + digitName,
+                   stage.totalInss);
+}
+
+} // namespace
+
+void NetlistProfiler::endStage(const std::string &stageName,
+                               const std::vector<Module> &netlist)
+{
+  const SteadyClock::time_point now = SteadyClock::now();
+  NetlistStage stage;
+  stage.name = stageName;
+  stage.wallSecs = std::chrono::duration<double>(now - lastStageEnd).count();
+  double cpuSecs;
+  getResourceUsage(cpuSecs, stage.peakRssBytes);
+  stage.cpuSecs = cpuSecs - lastCpuSecs;
+  stage.rssBytes = getRssBytes();
+  // The peak of getrusage may lag behind the current RSS.
+  stage.peakRssBytes = std::max(stage.peakRssBytes, stage.rssBytes);
+  const bool isStats = v3Global.opt.stats();
+  if(isStats || !v3Global.opt.netlistProfile().empty())
+    countNetlist(netlist, stage);
+  stages.push_back(stage);
+  if(isStats)
+    addStats(stages.size(), stage);
+  // The time of counting isn't a part of any stage.
+  uint64_t peakRssBytes;
+  lastStageEnd = SteadyClock::now();
+  getResourceUsage(lastCpuSecs, peakRssBytes);
+}
+
+const std::vector<NetlistStage> &NetlistProfiler::getStages() { return stages; }
+
+void NetlistProfiler::writeJson(const std::string &fileName)
+{
+  std::ofstream ofs(fileName);
+  if(!ofs)
+    throw std::runtime_error("Can't write " + fileName);
+  double totalWallSecs = 0, totalCpuSecs = 0;
+  uint64_t peakRssBytes = 0;
+  ofs << std::fixed << std::setprecision(6);
+  ofs << "{" << std::endl << "  \"stages\": [" << std::endl;
+  for(uint32_t stageIndex = 0; stageIndex < stages.size(); stageIndex++)
+  {
+    const auto &stage = stages[stageIndex];
+    totalWallSecs += stage.wallSecs;
+    totalCpuSecs += stage.cpuSecs;
+    peakRssBytes = std::max(peakRssBytes, stage.peakRssBytes);
+    ofs << "    {\"name\": \"" << stage.name
+        << "\", \"wallSecs\": " << stage.wallSecs
+        << ", \"cpuSecs\": " << stage.cpuSecs
+        << ", \"rssBytes\": " << stage.rssBytes
+        << ", \"peakRssBytes\": " << stage.peakRssBytes
+        << ", \"modules\": " << stage.totalModules
+        << ", \"ports\": " << stage.totalPorts
+        << ", \"refVars\": " << stage.totalRefVars
+        << ", \"instances\": " << stage.totalInss << "}"
+        << (stageIndex + 1 < stages.size() ? "," : "") << std::endl;
+  }
+  ofs << "  ]," << std::endl;
+  ofs << "  \"totalWallSecs\": " << totalWallSecs << "," << std::endl;
+  ofs << "  \"totalCpuSecs\": " << totalCpuSecs << "," << std::endl;
+  ofs << "  \"peakRssBytes\": " << peakRssBytes << std::endl << "}"
+      << std::endl;
+}
@@ -0,0 +1,39 @@
+/*************************************************************************
+  > File Name: NetlistProfiler.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+#pragma once
+#include "OneBitNetlist.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Time, memory and netlist size of every stage of the netlist extraction,
+// from parsing to printing, so that runs of big designs can be compared.
+struct NetlistStage
+{
+    std::string name;
+    double wallSecs = 0;       // Of this stage only
+    double cpuSecs = 0;        // Of this stage only, summed over threads
+    uint64_t rssBytes = 0;     // At the end of the stage
+    uint64_t peakRssBytes = 0; // Of the process up to the end of the stage
+    // Of the netlist which is the result of the stage, all zero if none
+    uint64_t totalModules = 0;
+    uint64_t totalPorts = 0;
+    uint64_t totalRefVars = 0;
+    uint64_t totalInss = 0;
+};
+
+class NetlistProfiler final
+{
+  public:
+    // Called at the end of every stage, a stage begins where the last one
+    // ended or at the start of the process. The netlist is only counted if
+    // --stats or --netlist-profile is used.
+    static void endStage(const std::string &stageName,
+                         const std::vector<Module> &netlist = {});
+    static const std::vector<NetlistStage> &getStages();
+    static void writeJson(const std::string &fileName);
+};
@@ -0,0 +1,580 @@
+/*************************************************************************
+  > File Name: NetlistReader.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistReader.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace
+{
+
+using NameIndexs = std::unordered_map<std::string, uint32_t>;
+
+const std::string punctuations = "(),;.[]:{}=";
+
+[[noreturn]] void throwReadError(const std::string &fileName,
+                                 const uint32_t &line,
+                                 const std::string &message)
+{
+  throw std::runtime_error(fileName + ":" + std::to_string(line) + ": " +
+                           message + ".");
+}
+
+bool isSpace(const char &c)
+{
+  return std::isspace(static_cast<unsigned char>(c));
+}
+
+// Split a file into names, numbers, const values like 4'hf and the
+// punctuations, an escaped name is read without its backslash. Comments and
+// compiler directives like `timescale are skipped.
+class NetlistLexer final
+{
+  private:
+    const std::string &_fileName;
+    std::string _text;
+    size_t _pos = 0;
+    uint32_t _line = 1;
+    // The next token and its line, _isEnd is true after the last token.
+    std::string _token;
+    uint32_t _tokenLine = 1;
+    bool _isEnd = false;
+    void readToken();
+
+  public:
+    explicit NetlistLexer(const std::string &fileName);
+    bool isEnd() const { return _isEnd; };
+    const uint32_t &getLine() const { return _tokenLine; };
+    const std::string &peek() const { return _token; };
+    std::string next()
+    {
+      if(_isEnd)
+        error("unexpected end of file");
+      std::string token = std::move(_token);
+      readToken();
+      return token;
+    };
+    void expect(const std::string &token)
+    {
+      if(_isEnd || _token != token)
+        error("expected \"" + token + "\"");
+      readToken();
+    };
+    [[noreturn]] void error(const std::string &message) const
+    {
+      throwReadError(_fileName, _tokenLine,
+                     _isEnd ? message : message + " near \"" + _token + "\"");
+    };
+};
+
+NetlistLexer::NetlistLexer(const std::string &fileName) : _fileName(fileName)
+{
+  std::ifstream ifs(fileName, std::ios::binary);
+  if(!ifs)
+    throw std::runtime_error("Can't read " + fileName + ".");
+  std::ostringstream oss;
+  oss << ifs.rdbuf();
+  _text = oss.str();
+  readToken();
+}
+
+void NetlistLexer::readToken()
+{
+  while(_pos < _text.size())
+  {
+    const char c = _text[_pos];
+    if(c == '\n')
+      _line++;
+    if(isSpace(c))
+      _pos++;
+    else if(c == '`' || !_text.compare(_pos, 2, "//"))
+      _pos = std::min(_text.find('\n', _pos), _text.size());
+    else if(!_text.compare(_pos, 2, "/*"))
+    {
+      const size_t commentEnd = _text.find("*/", _pos + 2);
+      if(commentEnd == std::string::npos)
+        throwReadError(_fileName, _line, "unterminated comment");
+      _line += std::count(_text.begin() + _pos, _text.begin() + commentEnd,
+                          '\n');
+      _pos = commentEnd + 2;
+    }
+    else
+      break;
+  }
+  _tokenLine = _line;
+  if(_pos == _text.size())
+  {
+    _isEnd = true;
+    _token.clear();
+    return;
+  }
+  size_t tokenBegin = _pos;
+  if(_text[_pos] == '\\')
+  {
+    tokenBegin++;
+    while(++_pos < _text.size() && !isSpace(_text[_pos]))
+      ;
+  }
+  else if(punctuations.find(_text[_pos]) != std::string::npos)
+    _pos++;
+  else
+  {
+    while(_pos < _text.size() && !isSpace(_text[_pos]) &&
+          punctuations.find(_text[_pos]) == std::string::npos)
+      _pos++;
+  }
+  _token.assign(_text, tokenBegin, _pos - tokenBegin);
+}
+
+uint32_t readNumber(NetlistLexer &lexer)
+{
+  const std::string token = lexer.peek();
+  if(token.empty() || token.size() > 9 ||
+     token.find_first_not_of("0123456789") != std::string::npos)
+    lexer.error("expected a number");
+  lexer.next();
+  return std::stoul(token);
+}
+
+// Values of a const value like 1'b0, 4'hf, 3'b0x1 or 8'bx from the highest
+// bit, or false if token isn't one.
+bool getConstValues(const std::string &token, std::string &values)
+{
+  const size_t quote = token.find('\'');
+  if(quote == 0 || quote > 9 || quote + 2 >= token.size() ||
+     token.find_first_not_of("0123456789") != quote)
+    return false;
+  const uint32_t bitWidth = std::stoul(token.substr(0, quote));
+  const char base = std::tolower(token[quote + 1]);
+  values.clear();
+  for(size_t digitIndex = quote + 2; digitIndex < token.size(); digitIndex++)
+  {
+    const char digit = std::tolower(token[digitIndex]);
+    const uint32_t totalDigitBits = base == 'h' ? 4 : 1;
+    if(digit == 'x' || digit == 'z')
+      values.append(totalDigitBits, digit == 'x' ? CHAR_X : CHAR_Z);
+    else if(base == 'b' && (digit == '0' || digit == '1'))
+      values += digit == '1' ? CHAR_ONE : CHAR_ZERO;
+    else if(base == 'h' && std::isxdigit(static_cast<unsigned char>(digit)))
+    {
+      const uint32_t number = std::stoul(std::string(1, digit), nullptr, 16);
+      for(uint32_t bitIndex = 4; bitIndex > 0; bitIndex--)
+        values += (number >> (bitIndex - 1)) & 1 ? CHAR_ONE : CHAR_ZERO;
+    }
+    else
+      return false;
+  }
+  // The highest digit is extended if it is x or z, otherwise 0 is.
+  if(values.size() < bitWidth)
+    values.insert(0, bitWidth - values.size(),
+                  values[0] == CHAR_X || values[0] == CHAR_Z ? values[0]
+                                                             : CHAR_ZERO);
+  else if(values.find_first_not_of(CHAR_ZERO) < values.size() - bitWidth)
+    return false;
+  else
+    values.erase(0, values.size() - bitWidth);
+  return bitWidth > 0;
+}
+
+// The ports and wires of the module being read
+struct ModuleScope
+{
+    const Module &oneMod;
+    const NameIndexs &portDefIndexs;
+};
+
+// Append the nets of a name, a bit select, a part select or a const value
+// to nets from the highest bit.
+void readNetRun(NetlistLexer &lexer, const ModuleScope &scope,
+                std::vector<RefVar> &nets)
+{
+  std::string values;
+  if(getConstValues(lexer.peek(), values))
+  {
+    lexer.next();
+    for(const auto &valueAndValueX: values)
+    {
+      RefVar net;
+      net.valueAndValueX = valueAndValueX;
+      nets.push_back(net);
+    }
+    return;
+  }
+  auto it = scope.portDefIndexs.find(lexer.peek());
+  if(it == scope.portDefIndexs.end())
+    lexer.error("unknown net");
+  lexer.next();
+  const auto &port = scope.oneMod.ports[it->second];
+  RefVar net;
+  net.refVarDefIndex = it->second;
+  uint32_t msb = port.bitWidth - 1;
+  uint32_t lsb = 0;
+  if(lexer.peek() == "[")
+  {
+    lexer.next();
+    msb = lsb = readNumber(lexer);
+    if(lexer.peek() == ":")
+    {
+      lexer.next();
+      lsb = readNumber(lexer);
+    }
+    lexer.expect("]");
+    if(!port.isVector || std::max(msb, lsb) >= port.bitWidth)
+      lexer.error("wrong select of " + port.portDefName);
+  }
+  for(int64_t bitIndex = msb;
+      msb >= lsb ? bitIndex >= int64_t(lsb) : bitIndex <= int64_t(lsb);
+      bitIndex += msb >= lsb ? -1 : 1)
+  {
+    net.bitIndex = bitIndex;
+    nets.push_back(net);
+  }
+}
+
+// The nets of a pin or of one side of an assign statement from the highest
+// bit, a concatenation has one or more runs.
+std::vector<RefVar> readNets(NetlistLexer &lexer, const ModuleScope &scope)
+{
+  std::vector<RefVar> nets;
+  if(lexer.peek() != "{")
+  {
+    readNetRun(lexer, scope, nets);
+    return nets;
+  }
+  lexer.next();
+  while(true)
+  {
+    readNetRun(lexer, scope, nets);
+    if(lexer.peek() == "}")
+      break;
+    lexer.expect(",");
+  }
+  lexer.next();
+  return nets;
+}
+
+// An instance whose module and pins are resolved after all modules are read
+struct ReadInstance
+{
+    std::string subModDefName;
+    uint32_t line;
+    // Port names and nets from the lowest bit
+    std::vector<std::pair<std::string, std::vector<RefVar>>> pins;
+};
+
+// Read one module from its name to endmodule. Ports and wires are defined
+// before they are used, like NetlistWriter writes them.
+void readModule(NetlistLexer &lexer, Module &oneMod,
+                std::vector<ReadInstance> &readInss)
+{
+  oneMod.moduleDefName = lexer.next();
+  // The header only lists the ports, which are defined again below.
+  while(lexer.next() != ";")
+    ;
+  const std::string portTypeNames[] = { "input", "output", "inout", "wire" };
+  std::vector<PortDefinition> portsOfTypes[4];
+  NameIndexs portDefIndexs;
+  bool hasPorts = false;
+  // Inputs, inouts, outputs and then wires, like genHierNet.
+  auto setPorts = [&]()
+  {
+    for(const auto &portType: { PortType::INPUT, PortType::INOUT,
+                                PortType::OUTPUT, PortType::WIRE })
+    {
+      const auto &ports = portsOfTypes[static_cast<int>(portType)];
+      oneMod.ports.insert(oneMod.ports.end(), ports.begin(), ports.end());
+      if(portType == PortType::INPUT)
+        oneMod.totalInputs = oneMod.ports.size();
+      else if(portType == PortType::INOUT)
+        oneMod.totalInputsAndInouts = oneMod.ports.size();
+      else if(portType == PortType::OUTPUT)
+        oneMod.totalPortsExcludingWires = oneMod.ports.size();
+    }
+    for(uint32_t portDefIndex = 0; portDefIndex < oneMod.ports.size();
+        portDefIndex++)
+    {
+      if(!portDefIndexs.emplace(oneMod.ports[portDefIndex].portDefName,
+                                portDefIndex)
+            .second)
+        lexer.error(oneMod.ports[portDefIndex].portDefName +
+                    " is defined twice in " + oneMod.moduleDefName);
+    }
+    hasPorts = true;
+  };
+  const ModuleScope scope = { oneMod, portDefIndexs };
+  while(lexer.peek() != "endmodule")
+  {
+    const auto portTypeName = std::find(std::begin(portTypeNames),
+                                        std::end(portTypeNames), lexer.peek());
+    if(portTypeName != std::end(portTypeNames))
+    {
+      if(hasPorts)
+        lexer.error("definition after instances or assign statements");
+      lexer.next();
+      PortDefinition port;
+      port.portType =
+        static_cast<PortType>(portTypeName - std::begin(portTypeNames));
+      if(lexer.peek() == "[")
+      {
+        lexer.next();
+        port.isVector = true;
+        port.bitWidth = readNumber(lexer) + 1;
+        lexer.expect(":");
+        if(readNumber(lexer) != 0)
+          lexer.error("only [msb:0] is supported");
+        lexer.expect("]");
+      }
+      while(true)
+      {
+        port.portDefName = lexer.next();
+        portsOfTypes[static_cast<int>(port.portType)].push_back(port);
+        if(lexer.peek() == ";")
+          break;
+        lexer.expect(",");
+      }
+      lexer.next();
+      continue;
+    }
+    if(!hasPorts)
+      setPorts();
+    if(lexer.peek() == "assign")
+    {
+      lexer.next();
+      const auto lNets = readNets(lexer, scope);
+      lexer.expect("=");
+      const auto rNets = readNets(lexer, scope);
+      if(lNets.size() != rNets.size())
+        lexer.error("both sides of assign have different widths");
+      for(uint32_t netIndex = 0; netIndex < lNets.size(); netIndex++)
+      {
+        if(lNets[netIndex].refVarDefIndex == UINT32_MAX)
+          lexer.error("assign to a const value");
+        BitSlicedAssignStatement oneAssign;
+        oneAssign.lValue = lNets[netIndex];
+        oneAssign.rValue = rNets[netIndex];
+        oneMod.assigns.push_back(oneAssign);
+      }
+      lexer.expect(";");
+      continue;
+    }
+    // INV_X1_LVT i_0_0 (.A(a), .ZN(n_0_0)); or INV_X1_LVT i_0_0); without
+    // pins.
+    ReadInstance readIns;
+    readIns.line = lexer.getLine();
+    readIns.subModDefName = lexer.next();
+    oneMod.subModuleInstanceNames.push_back(lexer.next());
+    if(lexer.peek() == "(")
+    {
+      lexer.next();
+      while(lexer.peek() == ".")
+      {
+        lexer.next();
+        std::string portDefName = lexer.next();
+        lexer.expect("(");
+        std::vector<RefVar> nets;
+        if(lexer.peek() != ")")
+          nets = readNets(lexer, scope);
+        lexer.expect(")");
+        std::reverse(nets.begin(), nets.end());
+        readIns.pins.emplace_back(std::move(portDefName), std::move(nets));
+        if(lexer.peek() != ")")
+          lexer.expect(",");
+      }
+    }
+    lexer.expect(")");
+    lexer.expect(";");
+    readInss.push_back(std::move(readIns));
+  }
+  lexer.next();
+  if(!hasPorts)
+    setPorts();
+}
+
+} // namespace
+
+LoadedNetlist readNetlistVerilog(const std::string &fileName,
+                                 const std::vector<Module> &libNetlist,
+                                 const uint32_t &libTotalUsedBlackBoxes)
+{
+  NetlistLexer lexer(fileName);
+  std::vector<Module> definedMods;
+  std::vector<std::vector<ReadInstance>> readInssOfMods;
+  NameIndexs definedModIndexs;
+  while(!lexer.isEnd())
+  {
+    lexer.expect("module");
+    const uint32_t line = lexer.getLine();
+    definedMods.emplace_back();
+    readInssOfMods.emplace_back();
+    readModule(lexer, definedMods.back(), readInssOfMods.back());
+    if(!definedModIndexs
+          .emplace(definedMods.back().moduleDefName, definedMods.size() - 1)
+          .second)
+      throwReadError(fileName, line,
+                     definedMods.back().moduleDefName + " is defined twice");
+  }
+
+  // Std cells are the modules which are instanced but not defined, in the
+  // order of their first instances.
+  NameIndexs libModIndexs;
+  for(uint32_t modDefIndex = 0; modDefIndex < libTotalUsedBlackBoxes;
+      modDefIndex++)
+    libModIndexs.emplace(libNetlist[modDefIndex].moduleDefName, modDefIndex);
+  LoadedNetlist loadedNetlist;
+  auto &netlist = loadedNetlist.netlist;
+  NameIndexs stdCellIndexs;
+  std::vector<bool> isGuessed;
+  for(const auto &readInss: readInssOfMods)
+  {
+    for(const auto &readIns: readInss)
+    {
+      if(definedModIndexs.count(readIns.subModDefName))
+        continue;
+      auto it = stdCellIndexs.find(readIns.subModDefName);
+      if(it == stdCellIndexs.end())
+      {
+        it = stdCellIndexs.emplace(readIns.subModDefName, netlist.size())
+               .first;
+        auto libIt = libModIndexs.find(readIns.subModDefName);
+        isGuessed.push_back(libIt == libModIndexs.end());
+        if(isGuessed.back())
+        {
+          netlist.emplace_back();
+          netlist.back().moduleDefName = readIns.subModDefName;
+        }
+        else
+          netlist.push_back(libNetlist[libIt->second]);
+      }
+      if(!isGuessed[it->second])
+        continue;
+      auto &stdCell = netlist[it->second];
+      for(const auto &pin: readIns.pins)
+      {
+        if(std::any_of(stdCell.ports.begin(), stdCell.ports.end(),
+                       [&pin](const PortDefinition &port)
+                       { return port.portDefName == pin.first; }))
+          continue;
+        PortDefinition port;
+        port.portDefName = pin.first;
+        port.portType = PortType::INPUT;
+        port.bitWidth = std::max<uint32_t>(pin.second.size(), 1);
+        port.isVector = port.bitWidth > 1;
+        stdCell.ports.push_back(port);
+      }
+      stdCell.totalInputs = stdCell.totalInputsAndInouts =
+        stdCell.totalPortsExcludingWires = stdCell.ports.size();
+    }
+  }
+  loadedNetlist.totalUsedStdCells = netlist.size();
+
+  // Levels of modules, the modules which aren't instanced are 1.
+  const uint32_t totalDefinedMods = definedMods.size();
+  auto isBlackBox = [&](const uint32_t &definedModIndex)
+  {
+    return readInssOfMods[definedModIndex].empty() &&
+           definedMods[definedModIndex].assigns.empty();
+  };
+  std::vector<uint32_t> totalParents(totalDefinedMods, 0);
+  auto forEachSubMod = [&](const uint32_t &definedModIndex, auto &&oneSubMod)
+  {
+    for(const auto &readIns: readInssOfMods[definedModIndex])
+    {
+      auto it = definedModIndexs.find(readIns.subModDefName);
+      if(it != definedModIndexs.end() && !isBlackBox(it->second))
+        oneSubMod(it->second);
+    }
+  };
+  for(uint32_t definedModIndex = 0; definedModIndex < totalDefinedMods;
+      definedModIndex++)
+    forEachSubMod(definedModIndex,
+                  [&](uint32_t subModIndex) { totalParents[subModIndex]++; });
+  std::vector<uint32_t> orderedMods;
+  for(uint32_t definedModIndex = 0; definedModIndex < totalDefinedMods;
+      definedModIndex++)
+  {
+    if(isBlackBox(definedModIndex))
+      netlist.push_back(std::move(definedMods[definedModIndex]));
+    else if(!totalParents[definedModIndex])
+    {
+      definedMods[definedModIndex].level = 1;
+      orderedMods.push_back(definedModIndex);
+    }
+  }
+  loadedNetlist.totalUsedBlackBoxes = netlist.size();
+  for(uint32_t order = 0; order < orderedMods.size(); order++)
+  {
+    const uint32_t &level = definedMods[orderedMods[order]].level;
+    forEachSubMod(orderedMods[order],
+                  [&](uint32_t subModIndex)
+                  {
+                    auto &subMod = definedMods[subModIndex];
+                    subMod.level = std::max(subMod.level, level + 1);
+                    if(!--totalParents[subModIndex])
+                      orderedMods.push_back(subModIndex);
+                  });
+  }
+  if(orderedMods.size() + loadedNetlist.totalUsedBlackBoxes -
+       loadedNetlist.totalUsedStdCells !=
+     totalDefinedMods)
+    throw std::runtime_error("Modules of " + fileName +
+                             " instance themselves recursively.");
+  std::stable_sort(orderedMods.begin(), orderedMods.end(),
+                   [&](const uint32_t &lIndex, const uint32_t &rIndex)
+                   {
+                     return definedMods[lIndex].level <
+                            definedMods[rIndex].level ||
+                            (definedMods[lIndex].level ==
+                               definedMods[rIndex].level &&
+                             lIndex < rIndex);
+                   });
+  for(const auto &definedModIndex: orderedMods)
+    netlist.push_back(std::move(definedMods[definedModIndex]));
+
+  // Resolve the modules and pins of instances by name.
+  NameIndexs modDefIndexs;
+  for(uint32_t modDefIndex = 0; modDefIndex < netlist.size(); modDefIndex++)
+    modDefIndexs.emplace(netlist[modDefIndex].moduleDefName, modDefIndex);
+  std::vector<NameIndexs> portDefIndexsOfMods(netlist.size());
+  for(uint32_t modDefIndex = loadedNetlist.totalUsedBlackBoxes;
+      modDefIndex < netlist.size(); modDefIndex++)
+  {
+    auto &oneMod = netlist[modDefIndex];
+    auto &readInss =
+      readInssOfMods[definedModIndexs.at(oneMod.moduleDefName)];
+    for(auto &readIns: readInss)
+    {
+      const uint32_t subModDefIndex = modDefIndexs.at(readIns.subModDefName);
+      const auto &subMod = netlist[subModDefIndex];
+      auto &portDefIndexs = portDefIndexsOfMods[subModDefIndex];
+      if(portDefIndexs.empty())
+      {
+        for(uint32_t portDefIndex = 0;
+            portDefIndex < subMod.totalPortsExcludingWires; portDefIndex++)
+          portDefIndexs.emplace(subMod.ports[portDefIndex].portDefName,
+                                portDefIndex);
+      }
+      std::vector<PortAssignment> portAssignments(
+        subMod.totalPortsExcludingWires);
+      for(auto &pin: readIns.pins)
+      {
+        auto it = portDefIndexs.find(pin.first);
+        if(it == portDefIndexs.end())
+          throwReadError(fileName, readIns.line,
+                         subMod.moduleDefName + " has no port " + pin.first);
+        portAssignments[it->second].refVars = std::move(pin.second);
+      }
+      oneMod.subModuleDefIndexs.push_back(subModDefIndex);
+      oneMod.portAssignmentsOfSubModInss.push_back(std::move(portAssignments));
+    }
+    std::vector<ReadInstance>().swap(readInss);
+  }
+  return loadedNetlist;
+}
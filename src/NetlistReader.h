@@ -0,0 +1,37 @@
+/*************************************************************************
+  > File Name: NetlistReader.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+#pragma once
+#include "OneBitNetlist.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A netlist read from a Verilog file, whose modules are ordered like
+// genHierNet does: std cells, other black boxes, then modules by level.
+struct LoadedNetlist
+{
+    uint32_t totalUsedStdCells = 0;
+    uint32_t totalUsedBlackBoxes = 0;
+    std::vector<Module> netlist;
+};
+
+// Read a netlist written by printNetlist, e.g. HierNetlist.v, FlatNetlist.v
+// or a golden file of note/misc, without the Verilog front end. Only what
+// NetlistWriter writes is read: module headers, port and wire definitions,
+// assign statements and instances with named pins, whose nets are names,
+// bit selects, part selects, const values or concatenations of them.
+//
+// Std cells aren't written into these files, so a module which is instanced
+// but not defined is copied by name from the black boxes of libNetlist, or
+// gets an input port for every pin it is connected by if it isn't there. A
+// defined module without instances and assign statements is a black box.
+//
+// A std::runtime_error is thrown with the file name and line if the file
+// can't be read or isn't a netlist.
+LoadedNetlist readNetlistVerilog(const std::string &fileName,
+                                 const std::vector<Module> &libNetlist,
+                                 const uint32_t &libTotalUsedBlackBoxes);
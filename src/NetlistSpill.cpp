@@ -0,0 +1,132 @@
+/*************************************************************************
+  > File Name: NetlistSpill.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistSpill.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+std::runtime_error getSpillError(const std::string &what,
+                                 const std::string &dirName)
+{
+  return std::runtime_error(what + " a spill file in " + dirName + ": " +
+                            std::strerror(errno));
+}
+
+} // namespace
+
+const uint64_t SpillFile::SEGMENT_BYTES;
+
+#if defined(_WIN32)
+
+// There is no mkstemp and mmap, a std::tmpfile in the temporary directory of
+// the system is used instead.
+SpillFile::SpillFile(const std::string &dirName) : _dirName(dirName)
+{
+  _file = std::tmpfile();
+  if(!_file)
+    throw getSpillError("Can't create", _dirName);
+}
+
+SpillFile::~SpillFile() { std::fclose(_file); }
+
+void SpillFile::write(const char *data, uint64_t size)
+{
+  if(std::fwrite(data, 1, size, _file) != size)
+    throw getSpillError("Can't write", _dirName);
+  _size += size;
+}
+
+void SpillFile::copyTo(std::ostream &os)
+{
+  std::rewind(_file);
+  std::vector<char> segment(std::min(_size, SEGMENT_BYTES));
+  for(uint64_t begin = 0; begin < _size; begin += segment.size())
+  {
+    const uint64_t size = std::min(_size - begin, uint64_t(segment.size()));
+    if(std::fread(segment.data(), 1, size, _file) != size)
+      throw getSpillError("Can't read", _dirName);
+    os.write(segment.data(), size);
+  }
+}
+
+#else
+
+SpillFile::SpillFile(const std::string &dirName) : _dirName(dirName)
+{
+  std::string fileName = dirName + "/VerilatorSpillXXXXXX";
+  _fd = mkstemp(&fileName[0]);
+  if(_fd < 0)
+    throw getSpillError("Can't create", _dirName);
+  unlink(fileName.c_str());
+}
+
+SpillFile::~SpillFile()
+{
+  unmapSegment();
+  close(_fd);
+}
+
+void SpillFile::unmapSegment()
+{
+  if(_segment)
+    munmap(_segment, SEGMENT_BYTES);
+  _segment = nullptr;
+}
+
+void SpillFile::write(const char *data, uint64_t size)
+{
+  while(size)
+  {
+    uint64_t offset = _size - _segmentBegin;
+    if(!_segment || offset == SEGMENT_BYTES)
+    {
+      // The written segment is left to the page cache.
+      unmapSegment();
+      _segmentBegin = _size;
+      offset = 0;
+      if(ftruncate(_fd, _segmentBegin + SEGMENT_BYTES))
+        throw getSpillError("Can't write", _dirName);
+      void *segment = mmap(nullptr, SEGMENT_BYTES, PROT_READ | PROT_WRITE,
+                           MAP_SHARED, _fd, _segmentBegin);
+      if(segment == MAP_FAILED)
+        throw getSpillError("Can't map", _dirName);
+      _segment = static_cast<char *>(segment);
+    }
+    const uint64_t copiedSize = std::min(size, SEGMENT_BYTES - offset);
+    std::memcpy(_segment + offset, data, copiedSize);
+    data += copiedSize;
+    size -= copiedSize;
+    _size += copiedSize;
+  }
+}
+
+void SpillFile::copyTo(std::ostream &os)
+{
+  unmapSegment();
+  for(uint64_t begin = 0; begin < _size; begin += SEGMENT_BYTES)
+  {
+    const uint64_t size = std::min(_size - begin, SEGMENT_BYTES);
+    void *segment = mmap(nullptr, size, PROT_READ, MAP_SHARED, _fd, begin);
+    if(segment == MAP_FAILED)
+      throw getSpillError("Can't map", _dirName);
+    madvise(segment, size, MADV_SEQUENTIAL);
+    os.write(static_cast<const char *>(segment), size);
+    munmap(segment, size);
+  }
+}
+
+#endif
@@ -0,0 +1,44 @@
+/*************************************************************************
+  > File Name: NetlistSpill.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <string>
+
+// A temporary file in dirName, which is written at its end and then read
+// from its beginning. The file grows in segments of SEGMENT_BYTES, and only
+// the segment being written or read is mapped into memory, so the written
+// bytes don't stay in RAM. The file is removed when it is created, so it is
+// gone with the process. A std::runtime_error is thrown if it can't be
+// created or written.
+class SpillFile final
+{
+  private:
+    std::string _dirName;
+#if defined(_WIN32)
+    FILE *_file = nullptr;
+#else
+    int _fd = -1;
+    char *_segment = nullptr; // The mapped segment being written
+    uint64_t _segmentBegin = 0;
+    void unmapSegment();
+#endif
+    uint64_t _size = 0;
+
+  public:
+    static const uint64_t SEGMENT_BYTES = 16 << 20;
+    explicit SpillFile(const std::string &dirName);
+    ~SpillFile();
+    SpillFile(const SpillFile &) = delete;
+    SpillFile &operator=(const SpillFile &) = delete;
+    void write(const char *data, uint64_t size);
+    void write(const std::string &str) { write(str.data(), str.size()); };
+    uint64_t size() const { return _size; };
+    // Append all written bytes to os, one segment at a time.
+    void copyTo(std::ostream &os);
+};
@@ -0,0 +1,541 @@
+/*************************************************************************
+  > File Name: NetlistWriter.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistWriter.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+
+const uint32_t maxCharsEveryLine = 80;
+
+// If there are too many kinds of keywords(more than 14) will be used in port
+// name, instance name, module name, variable name and so on, use a set.
+bool hasVerilogKeyWordOrOperator(const std::string &name)
+{
+  return name == "run" || name == "signed" ||
+         name.find_first_of("[.]") != std::string::npos;
+}
+
+// 0 has no digit, which is kept for the same line breaks as before.
+uint32_t getDecimalNumberLength(uint32_t number)
+{
+  uint32_t length = 0;
+  while(number)
+  {
+    number /= 10;
+    length++;
+  }
+  return length;
+}
+
+const char *getValueString(const char &valueAndValueX)
+{
+  switch(valueAndValueX)
+  {
+  case CHAR_ONE:
+    return "1'b1";
+  case CHAR_ZERO:
+    return "1'b0";
+  case CHAR_X:
+    return "1'bx";
+  case CHAR_Z:
+    return "1'bz";
+  default:
+    return "1'be"; // e = error valuex
+  }
+}
+
+bool isPrefixAndDigits(const std::string &name, const std::string &prefix)
+{
+  return name.size() > prefix.size() &&
+         !name.compare(0, prefix.size(), prefix) &&
+         name.find_first_not_of("0123456789", prefix.size()) ==
+           std::string::npos;
+}
+
+// e.g. 1'b0, 8'h0, 5'h1f, 4'bx or 3'b0x1, values are from the highest bit
+// to the lowest bit.
+std::string getValuesString(const std::string &values)
+{
+  if(values.size() == 1)
+    return getValueString(values[0]);
+  std::string valuesString = std::to_string(values.size());
+  if(values.find_first_not_of(CHAR_X) == std::string::npos)
+    return valuesString + "'bx";
+  if(values.find_first_not_of(CHAR_Z) == std::string::npos)
+    return valuesString + "'bz";
+  const bool isBinary =
+    values.find_first_not_of(std::string{ CHAR_ZERO, CHAR_ONE }) ==
+    std::string::npos;
+  if(!isBinary)
+  {
+    valuesString += "'b";
+    for(const auto &valueAndValueX: values)
+      valuesString += getValueString(valueAndValueX)[3];
+    return valuesString;
+  }
+  // Every hex digit has four bits from the lowest bit.
+  std::string hexDigits((values.size() + 3) / 4, '0');
+  for(uint32_t digitIndex = 0; digitIndex < hexDigits.size(); digitIndex++)
+  {
+    uint32_t digit = 0;
+    for(uint32_t bitIndex = digitIndex * 4;
+        bitIndex < std::min<uint32_t>(values.size(), digitIndex * 4 + 4);
+        bitIndex++)
+    {
+      if(values[values.size() - 1 - bitIndex] == CHAR_ONE)
+        digit |= 1u << (bitIndex % 4);
+    }
+    hexDigits[hexDigits.size() - 1 - digitIndex] = "0123456789abcdef"[digit];
+  }
+  const auto firstDigit = hexDigits.find_first_not_of('0');
+  return valuesString + "'h" +
+         (firstDigit == std::string::npos ? "0" : hexDigits.substr(firstDigit));
+}
+
+} // namespace
+
+bool NetRun::isFollowedBy(const PrintedNet &net, const int &nextStep) const
+{
+  if(!size)
+    return true;
+  if(step && step != nextStep)
+    return false;
+  if(!net.name)
+    return name.empty();
+  return isVector && net.isVector && *net.name == name &&
+         int64_t(net.bitIndex) == int64_t(lastBit) + nextStep;
+}
+
+void NetRun::append(const PrintedNet &net, const int &nextStep)
+{
+  if(!size)
+  {
+    name = net.name ? *net.name : "";
+    isVector = net.isVector;
+    bitWidth = net.bitWidth;
+    firstBit = net.bitIndex;
+  }
+  else
+    step = nextStep;
+  lastBit = net.bitIndex;
+  if(!net.name)
+    values += net.valueAndValueX;
+  size++;
+}
+
+void NetRun::clear()
+{
+  name.clear();
+  step = 0;
+  values.clear();
+  size = 0;
+}
+
+std::string NetRun::getText() const
+{
+  if(name.empty())
+  {
+    // The first net is the lowest bit if step is 1.
+    if(step > 0)
+      return getValuesString(std::string(values.rbegin(), values.rend()));
+    return getValuesString(values);
+  }
+  std::string text = name;
+  if(hasVerilogKeyWordOrOperator(name))
+    text = '\\' + name + ' ';
+  if(!isVector)
+    return text;
+  const uint32_t msb = std::max(firstBit, lastBit);
+  const uint32_t lsb = std::min(firstBit, lastBit);
+  if(size > 1 && lsb == 0 && msb + 1 == bitWidth)
+    return text;
+  text += '[' + std::to_string(msb);
+  if(msb != lsb)
+    text += ':' + std::to_string(lsb);
+  return text + ']';
+}
+
+CompactNames::CompactNames(const Module &oneMod, const uint64_t &firstNameId)
+  : firstId(firstNameId)
+{
+  for(uint32_t portDefIndex = 0;
+      portDefIndex < oneMod.totalPortsExcludingWires; portDefIndex++)
+  {
+    const auto &portDefName = oneMod.ports[portDefIndex].portDefName;
+    while(isPrefixAndDigits(portDefName, wirePrefix))
+      wirePrefix += '_';
+    while(isPrefixAndDigits(portDefName, insPrefix))
+      insPrefix += '_';
+  }
+}
+
+// An escaped name ends with a space.
+void NetlistWriter::writeName(const std::string &name)
+{
+  if(hasVerilogKeyWordOrOperator(name))
+  {
+    _buffer += '\\';
+    _buffer += name;
+    _buffer += ' ';
+    _totalCharsEveryLine += name.size() + 2;
+  }
+  else
+  {
+    _buffer += name;
+    _totalCharsEveryLine += name.size();
+  }
+}
+
+void NetlistWriter::breakLineIfLonger(const uint64_t &totalChars)
+{
+  if(totalChars > maxCharsEveryLine)
+  {
+    _buffer += "\n      ";
+    _totalCharsEveryLine = 6;
+  }
+}
+
+void NetlistWriter::flush(std::ostream &os)
+{
+  endAssignRun();
+  os.write(_buffer.data(), _buffer.size());
+  _buffer.clear();
+}
+
+void NetlistWriter::writeModuleBegin(const Module &oneMod)
+{
+  endAssignRun();
+  _buffer += "module ";
+  _buffer += oneMod.moduleDefName;
+  _buffer += '(';
+  _totalCharsEveryLine = 7 + oneMod.moduleDefName.size() + 1;
+  for(const auto &port: oneMod.ports)
+  {
+    if(port.portType != PortType::WIRE &&
+       port.portType != PortType::LAST_PORT_TYPE)
+    {
+      breakLineIfLonger(_totalCharsEveryLine + port.portDefName.size());
+      writeName(port.portDefName);
+      _buffer += ',';
+      _totalCharsEveryLine++;
+    }
+  }
+  _buffer.pop_back(); // delete one ","
+  _buffer += ");\n";
+  flushIfFull();
+}
+
+void NetlistWriter::writePortDef(const PortDefinition &port)
+{
+  writePortDef(port, port.portDefName);
+}
+
+void NetlistWriter::writePortDef(const PortDefinition &port,
+                                 const std::string &portDefName)
+{
+  endAssignRun();
+  switch(port.portType)
+  {
+  case PortType::INPUT:
+    _buffer += "   input ";
+    break;
+  case PortType::OUTPUT:
+    _buffer += "   output ";
+    break;
+  case PortType::INOUT:
+    _buffer += "   inout ";
+    break;
+  case PortType::WIRE:
+    _buffer += "   wire ";
+    break;
+  default:
+    break;
+  }
+  if(port.isVector)
+  {
+    _buffer += '[';
+    _buffer += std::to_string(port.bitWidth - 1);
+    _buffer += ":0]";
+  }
+  writeName(portDefName);
+  _buffer += ";\n";
+  flushIfFull();
+}
+
+// Every assign statement only has one bit data.
+void NetlistWriter::writeAssign(const PrintedNet &lNet, const PrintedNet &rNet)
+{
+  if(!lNet.name)
+    throw std::runtime_error(
+      "Assign left value can not be const value or x or z.");
+  if(_isGroupingBuses)
+  {
+    // Both sides have to follow their runs in the same direction.
+    int nextStep = 0;
+    if(_assignLRun.size)
+    {
+      const int64_t bitDistance =
+        int64_t(lNet.bitIndex) - int64_t(_assignLRun.lastBit);
+      if(bitDistance == 1 || bitDistance == -1)
+        nextStep = bitDistance;
+    }
+    if(!nextStep || !_assignLRun.isFollowedBy(lNet, nextStep) ||
+       !_assignRRun.isFollowedBy(rNet, nextStep))
+    {
+      endAssignRun();
+      nextStep = 0;
+    }
+    _assignLRun.append(lNet, nextStep);
+    _assignRRun.append(rNet, nextStep);
+    return;
+  }
+  _buffer += "  assign ";
+  writeName(*lNet.name);
+  if(lNet.isVector)
+  {
+    _buffer += '[';
+    _buffer += std::to_string(lNet.bitIndex);
+    _buffer += ']';
+  }
+  _buffer += " = ";
+  // rValue is a consta value or x or z
+  if(!rNet.name)
+    _buffer += getValueString(rNet.valueAndValueX);
+  else
+  {
+    writeName(*rNet.name);
+    if(rNet.isVector)
+    {
+      _buffer += '[';
+      _buffer += std::to_string(rNet.bitIndex);
+      _buffer += ']';
+    }
+  }
+  _buffer += ";\n";
+  flushIfFull();
+}
+
+void NetlistWriter::endAssignRun()
+{
+  if(!_assignLRun.size)
+    return;
+  _buffer += "  assign ";
+  _buffer += _assignLRun.getText();
+  _buffer += " = ";
+  _buffer += _assignRRun.getText();
+  _buffer += ";\n";
+  _assignLRun.clear();
+  _assignRRun.clear();
+  flushIfFull();
+}
+
+void NetlistWriter::writeInsBegin(const std::string &subModDefName,
+                                  const std::string &subModInsName)
+{
+  endAssignRun();
+  _totalCharsEveryLine = 0;
+  _buffer += "  ";
+  _buffer += subModDefName;
+  _buffer += ' ';
+  if(hasVerilogKeyWordOrOperator(subModInsName))
+  {
+    _buffer += '\\';
+    _totalCharsEveryLine++;
+  }
+  _buffer += subModInsName;
+  _buffer += " (";
+  _totalCharsEveryLine += 5 + subModDefName.size() + subModInsName.size();
+}
+
+void NetlistWriter::writePinBegin(const std::string &portDefName,
+                                  const uint32_t &totalNets)
+{
+  breakLineIfLonger(_totalCharsEveryLine + 1 + portDefName.size());
+  _buffer += '.';
+  if(hasVerilogKeyWordOrOperator(portDefName))
+  {
+    _buffer += '\\';
+    _buffer += portDefName;
+    _buffer += ' ';
+    _totalCharsEveryLine += 2;
+  }
+  else
+    _buffer += portDefName;
+  _buffer += '(';
+  _totalCharsEveryLine += 2 + portDefName.size();
+  // Braces are written by writePinEnd if the pin has more than one run.
+  if(totalNets > 1 && !_isGroupingBuses)
+  {
+    _buffer += '{';
+    _totalCharsEveryLine++;
+  }
+}
+
+void NetlistWriter::writePinNet(const PrintedNet &net)
+{
+  if(_isGroupingBuses)
+  {
+    if(!_pinRun.isFollowedBy(net, -1))
+    {
+      _pinTexts.push_back(_pinRun.getText());
+      _pinRun.clear();
+    }
+    _pinRun.append(net, -1);
+    return;
+  }
+  if(!net.name)
+  {
+    breakLineIfLonger(_totalCharsEveryLine + 4);
+    _buffer += getValueString(net.valueAndValueX);
+    _totalCharsEveryLine += 4;
+  }
+  else
+  {
+    if(net.isVector)
+      breakLineIfLonger(_totalCharsEveryLine + net.name->size() + 2 +
+                        getDecimalNumberLength(net.bitIndex));
+    else
+      breakLineIfLonger(_totalCharsEveryLine + net.name->size());
+    writeName(*net.name);
+    if(net.isVector)
+    {
+      _buffer += '[';
+      _buffer += std::to_string(net.bitIndex);
+      _buffer += ']';
+      _totalCharsEveryLine += 2 + getDecimalNumberLength(net.bitIndex);
+    }
+  }
+  _buffer += ',';
+  _totalCharsEveryLine++;
+}
+
+void NetlistWriter::writePinEnd(const uint32_t &totalNets)
+{
+  if(_isGroupingBuses)
+  {
+    if(_pinRun.size)
+      _pinTexts.push_back(_pinRun.getText());
+    _pinRun.clear();
+    if(_pinTexts.size() > 1)
+    {
+      _buffer += '{';
+      _totalCharsEveryLine++;
+    }
+    for(const auto &pinText: _pinTexts)
+    {
+      breakLineIfLonger(_totalCharsEveryLine + pinText.size());
+      _buffer += pinText;
+      _buffer += ',';
+      _totalCharsEveryLine += pinText.size() + 1;
+    }
+    if(!_pinTexts.empty())
+    {
+      _buffer.pop_back(); // delete one ","
+      _totalCharsEveryLine--;
+    }
+    if(_pinTexts.size() > 1)
+    {
+      _buffer += '}';
+      _totalCharsEveryLine++;
+    }
+    _buffer += "), ";
+    _totalCharsEveryLine += 3;
+    _pinTexts.clear();
+    return;
+  }
+  if(totalNets >= 1)
+  {
+    _buffer.pop_back(); // delete one ","
+    _totalCharsEveryLine--;
+  }
+  if(totalNets > 1)
+  {
+    _buffer += '}';
+    _totalCharsEveryLine++;
+  }
+  _buffer += "), ";
+  _totalCharsEveryLine += 3;
+}
+
+void NetlistWriter::writeInsEnd()
+{
+  _buffer.pop_back(); // delete one " "
+  _buffer.pop_back(); // delete one ","
+  _buffer += ");\n";
+  flushIfFull();
+}
+
+void NetlistWriter::writeModuleEnd()
+{
+  endAssignRun();
+  _buffer += "endmodule\n\n";
+  flushIfFull();
+}
+
+void NetlistWriter::writeModule(const std::vector<Module> &netlist,
+                                const Module &oneMod,
+                                const CompactNames *compactNames)
+{
+  const uint32_t totalPorts = oneMod.totalPortsExcludingWires;
+  // The printed net of a refVar, whose compact name is kept in name.
+  auto getNet = [&](const RefVar &refVar, std::string &name)
+  {
+    PrintedNet net = getPrintedNet(oneMod, refVar);
+    if(compactNames && net.name && refVar.refVarDefIndex >= totalPorts)
+    {
+      name = compactNames->getWireName(oneMod, refVar.refVarDefIndex);
+      net.name = &name;
+    }
+    return net;
+  };
+  std::string lName, rName;
+  writeModuleBegin(oneMod);
+  // Every time print one port definition
+  for(uint32_t portDefIndex = 0; portDefIndex < oneMod.ports.size();
+      portDefIndex++)
+  {
+    const auto &port = oneMod.ports[portDefIndex];
+    if(compactNames && portDefIndex >= totalPorts)
+      writePortDef(port, compactNames->getWireName(oneMod, portDefIndex));
+    else
+      writePortDef(port);
+  }
+  // Every time print one assign statement
+  for(const auto &oneAssign: oneMod.assigns)
+    writeAssign(getNet(oneAssign.lValue, lName),
+                getNet(oneAssign.rValue, rName));
+  // Every time print one submodule instance
+  for(uint32_t subModInsIndex = 0;
+      subModInsIndex < oneMod.subModuleInstanceNames.size(); subModInsIndex++)
+  {
+    const auto &subMod = netlist[oneMod.subModuleDefIndexs[subModInsIndex]];
+    if(compactNames)
+      writeInsBegin(subMod.moduleDefName,
+                    compactNames->getInsName(oneMod, subModInsIndex));
+    else
+      writeInsBegin(subMod.moduleDefName,
+                    oneMod.subModuleInstanceNames[subModInsIndex]);
+    const auto &portAssignments =
+      oneMod.portAssignmentsOfSubModInss[subModInsIndex];
+    // Every time print one port assignment
+    for(uint32_t portDefIndex = 0; portDefIndex < portAssignments.size();
+        portDefIndex++)
+    {
+      const auto &refVars = portAssignments[portDefIndex].refVars;
+      writePinBegin(subMod.ports[portDefIndex].portDefName, refVars.size());
+      for(uint32_t refVarIndex = refVars.size(); refVarIndex > 0;
+          refVarIndex--)
+        writePinNet(getNet(refVars[refVarIndex - 1], lName));
+      writePinEnd(refVars.size());
+    }
+    writeInsEnd();
+  }
+  writeModuleEnd();
+}
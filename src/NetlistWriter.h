@@ -0,0 +1,169 @@
+/*************************************************************************
+  > File Name: NetlistWriter.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+#pragma once
+#include "OneBitNetlist.h"
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// The buffer of a NetlistWriter is moved to a file when it is this big.
+const uint32_t NETLIST_WRITER_BUFFER_BYTES = 1 << 20;
+
+// A net which is printed in a port assignment or an assign statement, e.g.
+// C[1], ci or 1'b0.
+struct PrintedNet
+{
+    // nullptr for a const value, X or Z
+    const std::string *name = nullptr;
+    bool isVector = false;
+    uint32_t bitWidth = 1;
+    uint32_t bitIndex = 0;
+    char valueAndValueX = CHAR_X;
+};
+
+// Consecutive nets which are printed as one part select or one const value
+// if buses are grouped, e.g. a[7:4] or 4'hf. The nets of a part select are
+// the bits of one vector from firstBit to lastBit in the direction of step.
+struct NetRun
+{
+    // Empty for a run of const values
+    std::string name;
+    bool isVector = false;
+    uint32_t bitWidth = 1;
+    uint32_t firstBit = 0;
+    uint32_t lastBit = 0;
+    // -1, 1, or 0 if the run has only one net
+    int step = 0;
+    // Const values from the first net to the last net
+    std::string values;
+    uint32_t size = 0;
+    // Whether net can be the next net of the run in the direction of
+    // nextStep, which has to be step unless the run has only one net.
+    bool isFollowedBy(const PrintedNet &net, const int &nextStep) const;
+    void append(const PrintedNet &net, const int &nextStep);
+    void clear();
+    // e.g. a, a[3], a[7:4], \a.b [7:4], 1'b0 or 4'hf
+    std::string getText() const;
+};
+
+// Compact names of the wires and instances of a module, see --flatten-name-map.
+// Wires are numbered from firstId in the order of ports, then instances.
+struct CompactNames
+{
+    std::string wirePrefix = "n";
+    std::string insPrefix = "i";
+    uint64_t firstId = 1;
+    // Prefixes are extended with "_" until no port name of oneMod is a prefix
+    // followed by digits.
+    CompactNames(const Module &oneMod, const uint64_t &firstNameId);
+    std::string getWireName(const Module &oneMod,
+                            const uint32_t &portDefIndex) const
+    {
+      return wirePrefix +
+             std::to_string(firstId + portDefIndex -
+                            oneMod.totalPortsExcludingWires);
+    };
+    std::string getInsName(const Module &oneMod, const uint32_t &insIndex) const
+    {
+      return insPrefix +
+             std::to_string(firstId + oneMod.ports.size() -
+                            oneMod.totalPortsExcludingWires + insIndex);
+    };
+    // The id after the last one of oneMod
+    uint64_t getEndId(const Module &oneMod) const
+    {
+      return firstId + oneMod.ports.size() - oneMod.totalPortsExcludingWires +
+             oneMod.subModuleInstanceNames.size();
+    };
+};
+
+// Formats modules in the style of HierNetlist.v and FlatNetlist.v into a
+// buffer, lines are broken at 80 characters. A module can be written at
+// once, or piece by piece if its nets aren't in a Module, see
+// printFlatNetOutOfCore. The buffer is moved to os at the end of a line when
+// it is big enough, or by the caller if os is nullptr.
+class NetlistWriter final
+{
+  private:
+    std::string _buffer;
+    std::ostream *_os;
+    uint32_t _totalCharsEveryLine = 0;
+    bool _isGroupingBuses = false;
+    // The nets of the pin being written, whose finished runs are in
+    // _pinTexts.
+    NetRun _pinRun;
+    std::vector<std::string> _pinTexts;
+    // The assign statements being grouped, which are written when the next
+    // one doesn't follow them.
+    NetRun _assignLRun;
+    NetRun _assignRRun;
+    void writeName(const std::string &name);
+    void breakLineIfLonger(const uint64_t &totalChars);
+    void endAssignRun();
+    void flushIfFull()
+    {
+      if(_os && _buffer.size() >= NETLIST_WRITER_BUFFER_BYTES)
+        flush(*_os);
+    };
+
+  public:
+    explicit NetlistWriter(std::ostream *os = nullptr) : _os(os){};
+    // Grouped assign statements not written yet are written first.
+    std::string &getBuffer()
+    {
+      endAssignRun();
+      return _buffer;
+    };
+    // Print the runs of the nets of a pin and of assign statements as part
+    // selects and const values, see --netlist-group-buses.
+    void setGroupingBuses(const bool &isGroupingBuses)
+    {
+      _isGroupingBuses = isGroupingBuses;
+    };
+    // Append the buffer to os and clear it.
+    void flush(std::ostream &os);
+    // module full_adder(a,b,ci,co,sum);
+    void writeModuleBegin(const Module &oneMod);
+    // input [3:0]A;
+    void writePortDef(const PortDefinition &port);
+    void writePortDef(const PortDefinition &port,
+                      const std::string &portDefName);
+    // assign co = n_0_0;
+    void writeAssign(const PrintedNet &lNet, const PrintedNet &rNet);
+    // INV_X1_LVT i_0_0 (.A(a), .ZN(n_0_0));
+    void writeInsBegin(const std::string &subModDefName,
+                       const std::string &subModInsName);
+    void writePinBegin(const std::string &portDefName,
+                       const uint32_t &totalNets);
+    // Nets of a pin are written from the highest bit to the lowest bit.
+    void writePinNet(const PrintedNet &net);
+    void writePinEnd(const uint32_t &totalNets);
+    void writeInsEnd();
+    void writeModuleEnd();
+    // The whole module, whose nets are its ports. Wires and instances are
+    // written as compact names if compactNames isn't nullptr.
+    void writeModule(const std::vector<Module> &netlist, const Module &oneMod,
+                     const CompactNames *compactNames = nullptr);
+};
+
+// The printed net of a RefVar in oneMod
+inline PrintedNet getPrintedNet(const Module &oneMod, const RefVar &refVar)
+{
+  PrintedNet net;
+  if(refVar.refVarDefIndex == UINT32_MAX)
+    net.valueAndValueX = refVar.valueAndValueX;
+  else
+  {
+    const auto &port = oneMod.ports[refVar.refVarDefIndex];
+    net.name = &port.portDefName;
+    net.isVector = port.isVector;
+    net.bitWidth = port.bitWidth;
+    net.bitIndex = refVar.bitIndex;
+  }
+  return net;
+}
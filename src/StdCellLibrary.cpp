@@ -0,0 +1,441 @@
+/*************************************************************************
+  > File Name: StdCellLibrary.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "StdCellLibrary.h"
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+// Cell families of LibBlackbox.v
+const char *const builtInLibrary[] = {
+  "AND2 comb ZN=A1&A2",
+  "AND3 comb ZN=A1&A2&A3",
+  "AND4 comb ZN=A1&A2&A3&A4",
+  "NAND2 comb ZN=!(A1&A2)",
+  "NAND3 comb ZN=!(A1&A2&A3)",
+  "NAND4 comb ZN=!(A1&A2&A3&A4)",
+  "OR2 comb ZN=A1|A2",
+  "OR3 comb ZN=A1|A2|A3",
+  "OR4 comb ZN=A1|A2|A3|A4",
+  "NOR2 comb ZN=!(A1|A2)",
+  "NOR3 comb ZN=!(A1|A2|A3)",
+  "NOR4 comb ZN=!(A1|A2|A3|A4)",
+  "AOI21 comb ZN=!(A|B1&B2)",
+  "AOI22 comb ZN=!(A1&A2|B1&B2)",
+  "AOI211 comb ZN=!(A|B|C1&C2)",
+  "AOI221 comb ZN=!(A|B1&B2|C1&C2)",
+  "AOI222 comb ZN=!(A1&A2|B1&B2|C1&C2)",
+  "OAI21 comb ZN=!(A&(B1|B2))",
+  "OAI22 comb ZN=!((A1|A2)&(B1|B2))",
+  "OAI33 comb ZN=!((A1|A2|A3)&(B1|B2|B3))",
+  "OAI211 comb ZN=!(A&B&(C1|C2))",
+  "OAI211OAI211 comb ZN=!(A&B&(C1|C2))",
+  "OAI221 comb ZN=!(A&(B1|B2)&(C1|C2))",
+  "OAI222 comb ZN=!((A1|A2)&(B1|B2)&(C1|C2))",
+  "XOR2 comb Z=A^B",
+  "XNOR2 comb ZN=!(A^B)",
+  "MUX2 comb Z=A&!S|B&S",
+  "FA comb CO=A&B|CI&(A|B) S=A^B^CI",
+  "HA comb CO=A&B S=A^B",
+  "BUF comb Z=A",
+  "INV comb ZN=!A",
+  "CLKBUF comb Z=A",
+  "TBUF tristate A:data EN:enable",
+  "TINV tristate I:data EN:enable",
+  "LOGIC0 tie Z=0",
+  "LOGIC1 tie Z=1",
+  "DFF flop CK:clock D:data Q:q QN:qn",
+  "DFFR flop CK:clock D:data RN:reset_n Q:q QN:qn",
+  "DFFS flop CK:clock D:data SN:set_n Q:q QN:qn",
+  "DFFRS flop CK:clock D:data RN:reset_n SN:set_n Q:q QN:qn",
+  "SDFF flop CK:clock D:data SE:scan_enable SI:scan_in Q:q QN:qn",
+  "SDFFR flop CK:clock D:data RN:reset_n SE:scan_enable SI:scan_in Q:q "
+  "QN:qn",
+  "SDFFS flop CK:clock D:data SN:set_n SE:scan_enable SI:scan_in Q:q QN:qn",
+  "SDFFRS flop CK:clock D:data RN:reset_n SN:set_n SE:scan_enable "
+  "SI:scan_in Q:q QN:qn",
+  "DLH latch G:clock D:data Q:q",
+  "DLL latch GN:clock_n D:data Q:q",
+  "TLAT latch G:clock D:data OE:enable Q:q",
+  "CLKGATE clock_gate CK:clock E:enable GCK:clock_out",
+  "CLKGATETST clock_gate CK:clock E:enable SE:test_enable GCK:clock_out",
+  "FILLCELL physical",
+  "ANTENNA physical",
+  "AON_BUF power Z=A",
+  "AON_INV power Z=!A",
+  "LS_HL power Z=A",
+  "LS_LH power Z=A",
+  "LS_HLEN power",
+  "LS_LHEN power",
+  "ISO_FENCE0 power",
+  "ISO_FENCE0N power",
+  "ISO_FENCE1 power",
+  "ISO_FENCE1N power",
+  "HEADER power",
+  "HEADER_OE power",
+  "PADBID pad",
+  "PADCLK pad PAD:clock C:clock_out",
+  "PLL macro REF:clock RESET:reset PLLOUT:clock_out",
+  "MemGen_16_10 macro clock:clock"
+};
+
+const std::unordered_map<std::string, StdCellKind> kindNames = {
+  { "comb", StdCellKind::COMBINATIONAL },
+  { "tristate", StdCellKind::TRISTATE },
+  { "flop", StdCellKind::FLIP_FLOP },
+  { "latch", StdCellKind::LATCH },
+  { "clock_gate", StdCellKind::CLOCK_GATE },
+  { "tie", StdCellKind::TIE },
+  { "physical", StdCellKind::PHYSICAL },
+  { "power", StdCellKind::POWER },
+  { "pad", StdCellKind::PAD },
+  { "macro", StdCellKind::MACRO }
+};
+
+const std::unordered_map<std::string, PinRole> roleNames = {
+  { "data", PinRole::DATA },
+  { "clock", PinRole::CLOCK },
+  { "clock_n", PinRole::CLOCK_N },
+  { "reset", PinRole::RESET },
+  { "reset_n", PinRole::RESET_N },
+  { "set", PinRole::SET },
+  { "set_n", PinRole::SET_N },
+  { "scan_in", PinRole::SCAN_IN },
+  { "scan_enable", PinRole::SCAN_ENABLE },
+  { "enable", PinRole::ENABLE },
+  { "test_enable", PinRole::TEST_ENABLE },
+  { "q", PinRole::Q },
+  { "qn", PinRole::QN },
+  { "clock_out", PinRole::CLOCK_OUT }
+};
+
+// Recursive descent parser of
+//   or  := xor ('|' xor)*      '+' is the same as '|'
+//   xor := and ('^' and)*
+//   and := not ('&' not)*      '*' is the same as '&'
+//   not := '!' not | '(' or ')' | 0 | 1 | pin
+class ExpressionParser final
+{
+  private:
+    const std::string &_expression;
+    const Module &_stdCell;
+    size_t _pos = 0;
+    std::vector<CellFunction::Token> &_tokens;
+
+    char peek()
+    {
+      while(_pos < _expression.size() && isspace(_expression[_pos]))
+        _pos++;
+      return _pos < _expression.size() ? _expression[_pos] : '\0';
+    }
+    void error(const std::string &message)
+    {
+      throw std::runtime_error(message + " at position " +
+                               std::to_string(_pos) + " of \"" + _expression +
+                               "\" of " + _stdCell.moduleDefName);
+    }
+    void parseOr()
+    {
+      parseXor();
+      while(peek() == '|' || peek() == '+')
+      {
+        _pos++;
+        parseXor();
+        _tokens.push_back({ CellFunction::Op::OR, 0 });
+      }
+    }
+    void parseXor()
+    {
+      parseAnd();
+      while(peek() == '^')
+      {
+        _pos++;
+        parseAnd();
+        _tokens.push_back({ CellFunction::Op::XOR, 0 });
+      }
+    }
+    void parseAnd()
+    {
+      parseNot();
+      while(peek() == '&' || peek() == '*')
+      {
+        _pos++;
+        parseNot();
+        _tokens.push_back({ CellFunction::Op::AND, 0 });
+      }
+    }
+    void parseNot()
+    {
+      const char c = peek();
+      if(c == '!')
+      {
+        _pos++;
+        parseNot();
+        _tokens.push_back({ CellFunction::Op::NOT, 0 });
+      }
+      else if(c == '(')
+      {
+        _pos++;
+        parseOr();
+        if(peek() != ')')
+          error("Missing )");
+        _pos++;
+      }
+      else if(c == '0' || c == '1')
+      {
+        _pos++;
+        _tokens.push_back(
+          { c == '0' ? CellFunction::Op::CONST0 : CellFunction::Op::CONST1,
+            0 });
+      }
+      else if(isalpha(c) || c == '_')
+      {
+        const size_t start = _pos;
+        while(_pos < _expression.size() &&
+              (isalnum(_expression[_pos]) || _expression[_pos] == '_'))
+          _pos++;
+        const std::string pinName = _expression.substr(start, _pos - start);
+        for(uint32_t portDefIndex = 0; portDefIndex < _stdCell.totalInputs;
+            portDefIndex++)
+        {
+          if(_stdCell.ports[portDefIndex].portDefName == pinName)
+          {
+            _tokens.push_back({ CellFunction::Op::INPUT, portDefIndex });
+            return;
+          }
+        }
+        error("Unknown input pin " + pinName);
+      }
+      else
+        error("Unexpected character");
+    }
+
+  public:
+    ExpressionParser(const std::string &expression, const Module &stdCell,
+                     std::vector<CellFunction::Token> &tokens)
+      : _expression(expression), _stdCell(stdCell), _tokens(tokens)
+    {
+    }
+    void parse()
+    {
+      parseOr();
+      if(peek() != '\0')
+        error("Unexpected character");
+    }
+};
+
+// Remove drive strength and threshold voltage, NAND2_X1_LVT becomes NAND2.
+std::string getFamilyName(const std::string &cellName)
+{
+  size_t pos = cellName.find("_X");
+  while(pos != std::string::npos)
+  {
+    if(pos + 2 < cellName.size() && isdigit(cellName[pos + 2]))
+      return cellName.substr(0, pos);
+    pos = cellName.find("_X", pos + 1);
+  }
+  return cellName;
+}
+
+} // namespace
+
+void CellFunction::compile(const std::string &expression,
+                           const Module &stdCell)
+{
+  _tokens.clear();
+  ExpressionParser(expression, stdCell, _tokens).parse();
+}
+
+char CellFunction::evalConst(const std::vector<char> &portValues) const
+{
+  std::vector<char> stack;
+  stack.reserve(_tokens.size());
+  for(const auto &token: _tokens)
+  {
+    switch(token.op)
+    {
+    case Op::INPUT:
+      stack.push_back(portValues[token.portDefIndex]);
+      break;
+    case Op::CONST0:
+      stack.push_back(CHAR_ZERO);
+      break;
+    case Op::CONST1:
+      stack.push_back(CHAR_ONE);
+      break;
+    case Op::NOT:
+      if(stack.back() != CHAR_X)
+        stack.back() = stack.back() == CHAR_ZERO ? CHAR_ONE : CHAR_ZERO;
+      break;
+    default:
+    {
+      const char b = stack.back();
+      stack.pop_back();
+      char &a = stack.back();
+      if(token.op == Op::AND)
+        a = (a == CHAR_ZERO || b == CHAR_ZERO)  ? CHAR_ZERO
+            : (a == CHAR_ONE && b == CHAR_ONE) ? CHAR_ONE
+                                               : CHAR_X;
+      else if(token.op == Op::OR)
+        a = (a == CHAR_ONE || b == CHAR_ONE)     ? CHAR_ONE
+            : (a == CHAR_ZERO && b == CHAR_ZERO) ? CHAR_ZERO
+                                                 : CHAR_X;
+      else
+        a = (a == CHAR_X || b == CHAR_X) ? CHAR_X
+            : a == b                     ? CHAR_ZERO
+                                         : CHAR_ONE;
+    }
+    }
+  }
+  return stack.back();
+}
+
+StdCellLibrary::StdCellLibrary()
+{
+  for(const auto &line: builtInLibrary) addLine(line, "built-in library");
+}
+
+void StdCellLibrary::addLine(const std::string &line, const std::string &where)
+{
+  std::istringstream iss(line.substr(0, line.find('#')));
+  std::string cellName, kindName, field;
+  if(!(iss >> cellName))
+    return;
+  StdCellInfo cellInfo;
+  if(!(iss >> kindName) || !kindNames.count(kindName))
+    throw std::runtime_error(where + ": unknown kind of cell " + cellName);
+  cellInfo.kind = kindNames.at(kindName);
+  while(iss >> field)
+  {
+    const size_t equalPos = field.find('=');
+    const size_t colonPos = field.find(':');
+    if(!field.compare(0, 5, "area=") || !field.compare(0, 6, "delay="))
+    {
+      const std::string name = field.substr(0, equalPos);
+      char *end = nullptr;
+      const double value = strtod(field.c_str() + equalPos + 1, &end);
+      if(*end || end == field.c_str() + equalPos + 1 || value < 0)
+        throw std::runtime_error(where + ": wrong " + name + " " + field +
+                                 " of cell " + cellName);
+      if(name == "area")
+        cellInfo.area = value;
+      else
+        cellInfo.delay = value;
+    }
+    else if(equalPos != std::string::npos)
+    {
+      // The expression may have spaces, it ends at the next PIN= or PIN:.
+      std::string expression = field.substr(equalPos + 1);
+      while(iss >> std::ws && iss.peek() != EOF)
+      {
+        const std::streampos fieldPos = iss.tellg();
+        std::string next;
+        iss >> next;
+        if(next.find_first_of("=:") != std::string::npos)
+        {
+          iss.seekg(fieldPos);
+          break;
+        }
+        expression += " " + next;
+      }
+      cellInfo.functions.emplace_back(field.substr(0, equalPos), expression);
+    }
+    else if(colonPos != std::string::npos &&
+            roleNames.count(field.substr(colonPos + 1)))
+      cellInfo.pinRoles.emplace_back(field.substr(0, colonPos),
+                                     roleNames.at(field.substr(colonPos + 1)));
+    else
+      throw std::runtime_error(where + ": wrong field " + field + " of cell " +
+                               cellName);
+  }
+  _cells[cellName] = cellInfo;
+}
+
+void StdCellLibrary::readFile(const std::string &fileName)
+{
+  std::ifstream ifs(fileName);
+  if(!ifs)
+    throw std::runtime_error("Can not open std cell library " + fileName);
+  std::string line;
+  uint32_t lineNo = 0;
+  while(std::getline(ifs, line))
+  {
+    lineNo++;
+    addLine(line, fileName + ":" + std::to_string(lineNo));
+  }
+}
+
+const StdCellInfo *StdCellLibrary::findCell(const std::string &cellName) const
+{
+  auto it = _cells.find(cellName);
+  if(it == _cells.end())
+    it = _cells.find(getFamilyName(cellName));
+  return it == _cells.end() ? nullptr : &it->second;
+}
+
+std::vector<UsedStdCell>
+StdCellLibrary::bindNetlist(const std::vector<Module> &netlist,
+                            const uint32_t &totalUsedBlackBoxes) const
+{
+  std::vector<UsedStdCell> usedStdCells(netlist.size());
+  // Modules kept by partial flattening are hard macros.
+  for(uint32_t modDefIndex = totalUsedBlackBoxes; modDefIndex < netlist.size();
+      modDefIndex++)
+  {
+    const auto &hardMacro = netlist[modDefIndex];
+    usedStdCells[modDefIndex].kind = StdCellKind::MACRO;
+    usedStdCells[modDefIndex].pinRoles.resize(
+      hardMacro.totalPortsExcludingWires, PinRole::NONE);
+    usedStdCells[modDefIndex].functions.resize(
+      hardMacro.totalPortsExcludingWires);
+  }
+  for(uint32_t blackBoxDefIndex = 0; blackBoxDefIndex < totalUsedBlackBoxes;
+      blackBoxDefIndex++)
+  {
+    const auto &blackBox = netlist[blackBoxDefIndex];
+    auto &usedStdCell = usedStdCells[blackBoxDefIndex];
+    usedStdCell.pinRoles.resize(blackBox.totalPortsExcludingWires,
+                                PinRole::NONE);
+    usedStdCell.functions.resize(blackBox.totalPortsExcludingWires);
+    const StdCellInfo *cellInfo = findCell(blackBox.moduleDefName);
+    if(!cellInfo)
+      continue;
+    usedStdCell.kind = cellInfo->kind;
+    usedStdCell.area = cellInfo->area;
+    usedStdCell.delay = cellInfo->delay;
+    auto findPort = [&blackBox](const std::string &pinName)
+    {
+      for(uint32_t portDefIndex = 0;
+          portDefIndex < blackBox.totalPortsExcludingWires; portDefIndex++)
+      {
+        if(blackBox.ports[portDefIndex].portDefName == pinName)
+          return portDefIndex;
+      }
+      return UINT32_MAX;
+    };
+    // Pins which are not in the cell are skipped, a family may have
+    // different pins in another library.
+    for(const auto &pinRole: cellInfo->pinRoles)
+    {
+      const uint32_t portDefIndex = findPort(pinRole.first);
+      if(portDefIndex != UINT32_MAX)
+        usedStdCell.pinRoles[portDefIndex] = pinRole.second;
+    }
+    for(const auto &function: cellInfo->functions)
+    {
+      const uint32_t portDefIndex = findPort(function.first);
+      if(portDefIndex >= blackBox.totalInputsAndInouts &&
+         portDefIndex != UINT32_MAX)
+        usedStdCell.functions[portDefIndex].compile(function.second, blackBox);
+    }
+  }
+  return usedStdCells;
+}
@@ -0,0 +1,131 @@
+/*************************************************************************
+  > File Name: StdCellLibrary.h
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+#pragma once
+#include "OneBitNetlist.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// LibBlackbox.v only has port lists of std cells. What a std cell does is
+// described by a small library, one line per cell family, for example,
+//   NAND2 comb ZN=!(A1&A2)
+//   DFFR flop CK:clock D:data RN:reset_n Q:q QN:qn
+// A family is the cell name without drive strength, NAND2_X1_LVT belongs to
+// NAND2. "PIN=expression" is the function of an output pin, "PIN:role" is
+// the role of a pin, "area=number" is the area of the cell and "delay=number"
+// is the delay from any input to any output of the cell. The built-in
+// library covers LibBlackbox.v, a file given by --std-cell-lib adds or
+// replaces families.
+enum class StdCellKind
+{
+  COMBINATIONAL, // comb
+  TRISTATE,      // tristate
+  FLIP_FLOP,     // flop
+  LATCH,         // latch
+  CLOCK_GATE,    // clock_gate
+  TIE,           // tie, LOGIC0 and LOGIC1
+  PHYSICAL,      // physical, filler and antenna
+  POWER,         // power, isolation, level shifter and power switch
+  PAD,           // pad
+  MACRO,         // macro, PLL and memory
+  UNKNOWN        // not in library
+};
+
+enum class PinRole
+{
+  NONE,
+  DATA,        // data
+  CLOCK,       // clock
+  CLOCK_N,     // clock_n, active low clock of latch
+  RESET,       // reset
+  RESET_N,     // reset_n
+  SET,         // set
+  SET_N,       // set_n
+  SCAN_IN,     // scan_in
+  SCAN_ENABLE, // scan_enable
+  ENABLE,      // enable
+  TEST_ENABLE, // test_enable
+  Q,           // q
+  QN,          // qn
+  CLOCK_OUT    // clock_out, generated or gated clock
+};
+
+// One line of library
+struct StdCellInfo
+{
+    StdCellKind kind = StdCellKind::UNKNOWN;
+    std::vector<std::pair<std::string, PinRole>> pinRoles;
+    std::vector<std::pair<std::string, std::string>> functions;
+    double area = 0;  // 0 if unknown
+    double delay = 1; // unit delay if unknown
+};
+
+// Boolean function of an output pin in reverse polish notation, whose inputs
+// are referenced by portDefIndex of the std cell.
+class CellFunction final
+{
+  public:
+    enum class Op : uint8_t
+    {
+      INPUT,
+      CONST0,
+      CONST1,
+      NOT,
+      AND,
+      OR,
+      XOR
+    };
+    struct Token
+    {
+        Op op;
+        uint32_t portDefIndex;
+    };
+
+  private:
+    std::vector<Token> _tokens;
+
+  public:
+    // Throw std::runtime_error if expression is wrong or uses an unknown pin.
+    void compile(const std::string &expression, const Module &stdCell);
+    bool empty() const { return _tokens.empty(); };
+    const std::vector<Token> &getTokens() const { return _tokens; };
+    // portValues[portDefIndex] is CHAR_ZERO, CHAR_ONE or CHAR_X, the result
+    // is CHAR_X unless the inputs decide it.
+    char evalConst(const std::vector<char> &portValues) const;
+};
+
+// Library information of a used black box of a netlist, indexed by
+// portDefIndex.
+struct UsedStdCell
+{
+    StdCellKind kind = StdCellKind::UNKNOWN;
+    std::vector<PinRole> pinRoles;
+    std::vector<CellFunction> functions;
+    double area = 0;  // 0 if unknown
+    double delay = 1; // unit delay if unknown
+};
+
+class StdCellLibrary final
+{
+  private:
+    std::unordered_map<std::string, StdCellInfo> _cells;
+    void addLine(const std::string &line, const std::string &where);
+
+  public:
+    // Load the built-in library.
+    StdCellLibrary();
+    void readFile(const std::string &fileName);
+    // Look up the whole cell name first, then its family.
+    const StdCellInfo *findCell(const std::string &cellName) const;
+    // usedStdCells[modDefIndex], pins unknown to the library have
+    // PinRole::NONE and no function, other modules are MACRO.
+    std::vector<UsedStdCell>
+    bindNetlist(const std::vector<Module> &netlist,
+                const uint32_t &totalUsedBlackBoxes) const;
+};
@@ -22,6 +22,7 @@
 #include "V3Os.h"
 #include "V3String.h"
 #include "V3Ast.h"
+#include "NetlistCompress.h"
 
 #include <cerrno>
 #include <cstdarg>
@@ -357,7 +358,37 @@ private:
         const int fd = open(filename.c_str(), O_RDONLY);
         if (fd < 0) return false;
         m_readEof = false;
-        readBlocks(fd, -1, outl);
+        // The magic number tells whether the file is compressed
+        StrList blocks;
+        readBlocks(fd, 4, blocks);
+        const string head = listString(blocks);
+        if (!isCompressedNetlist(head)) {
+            readBlocks(fd, -1, blocks);
+            close(fd);
+            outl.splice(outl.end(), blocks);
+            return true;
+        }
+        // A gzip or zstd netlist, e.g. from --netlist-compress, which is
+        // decompressed block by block as it is read
+        try {
+            NetlistDecompressor decompressor(head);
+            string text;
+            decompressor.decompress(head.data(), head.size(), text);
+            while (!m_readEof) {
+                outl.push_back(text);
+                text.clear();
+                StrList compressedBlocks;
+                readBlocks(fd, INFILTER_IPC_BUFSIZ, compressedBlocks);
+                for (const string& block : compressedBlocks) {
+                    decompressor.decompress(block.data(), block.size(), text);
+                }
+            }
+            outl.push_back(text);
+            decompressor.finish();
+        } catch (const std::runtime_error& error) {
+            close(fd);
+            v3fatal(filename << ": " << error.what());
+        }
         close(fd);
         return true;
     }
@@ -26,6 +26,8 @@
 #include "V3File.h"
 #include "V3PreShell.h"
 #include "V3String.h"
+#include "NetlistCompress.h"
+#include "VerilogNetlist.h"
 
 // clang-format off
 #include <sys/types.h>
@@ -880,6 +882,31 @@ void V3Options::parseOpts(FileLine* fl, int argc, char** argv) {
 
     // Find files in makedir
     addIncDirFallback(makeDir());
+
+    // Netlist options which conflict or need another option
+    if (!m_flattenSpillDir.empty()) {
+        // Out-of-core flattening never keeps the flattened netlist in memory
+        string optionNames;
+        if (m_collapseAssigns) optionNames += ", --collapse-assigns";
+        if (!m_netlistCache.empty()) optionNames += ", --netlist-cache";
+        for (const auto& pass : VerilogNetlist::getFlatNetPasses()) {
+            if (pass.isEnabled) optionNames += string(", ") + pass.optionNames;
+        }
+        if (!optionNames.empty()) {
+            fl->v3fatal("--flatten-spill-dir can't be used with "
+                        << optionNames.substr(2)
+                        << ", which need the whole flattened netlist in memory");
+        }
+    }
+    if (!m_flattenSpillDir.empty() && !m_flattenNameMap.empty()) {
+        fl->v3fatal("--flatten-name-map can't be used with --flatten-spill-dir");
+    }
+    if (m_strashRegs && !m_strash) {
+        fl->v3fatal("--strash-regs needs --strash or --strash-merge");
+    }
+    if (!m_netlistPowerActivity.empty() && !m_netlistPower) {
+        fl->v3fatal("--netlist-power-activity needs --netlist-power");
+    }
 }
 
 //======================================================================
@@ -992,6 +1019,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc, char
     DECL_OPTION("-cdc", OnOff, &m_cdc);
     DECL_OPTION("-clk", CbVal, callStrSetter(&V3Options::addClocker));
     DECL_OPTION("-no-clk", CbVal, callStrSetter(&V3Options::addNoClocker));
+    DECL_OPTION("-collapse-assigns", OnOff, &m_collapseAssigns);
     DECL_OPTION("-comp-limit-blocks", Set, &m_compLimitBlocks).undocumented();
     DECL_OPTION("-comp-limit-members", Set,
                 &m_compLimitMembers)
@@ -1074,6 +1102,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc, char
         parseOptsFile(fl, parseFileArg(optdir, valp), false);
     });
     DECL_OPTION("-flatten", OnOff, &m_flatten);
+    DECL_OPTION("-flatten-depth", Set, &m_flattenDepth);
+    DECL_OPTION("-flatten-keep", CbVal, [this](const char* valp) { m_flattenKeeps.insert(valp); });
+    DECL_OPTION("-flatten-name-map", Set, &m_flattenNameMap);
+    DECL_OPTION("-flatten-spill-dir", Set, &m_flattenSpillDir);
 
     DECL_OPTION("-G", CbPartialMatch, [this](const char* optp) { addParameter(optp, false); });
     DECL_OPTION("-gate-stmts", Set, &m_gateStmts);
@@ -1146,6 +1178,51 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc, char
     DECL_OPTION("-max-num-width", Set, &m_maxNumWidth);
     DECL_OPTION("-merge-const-pool", OnOff, &m_mergeConstPool);
     DECL_OPTION("-mod-prefix", Set, &m_modPrefix);
+    DECL_OPTION("-netlist-aiger", Set, &m_netlistAiger);
+    DECL_OPTION("-netlist-blif", Set, &m_netlistBlif);
+    DECL_OPTION("-netlist-cache", Set, &m_netlistCache);
+    DECL_OPTION("-netlist-clocks", OnOff, &m_netlistClocks);
+    DECL_OPTION("-netlist-cone-depth", CbVal, [this, fl](const char* valp) {
+        m_netlistConeDepth = std::atoi(valp);
+        if (m_netlistConeDepth < 0) fl->v3fatal("--netlist-cone-depth must be >= 0: " << valp);
+    });
+    DECL_OPTION("-netlist-compress", CbVal, [this, fl](const char* valp) {
+        try {
+            getNetlistCompression(valp);
+        } catch (const std::runtime_error& error) {
+            fl->v3fatal("Bad setting for --netlist-compress: '"
+                        << valp << "': " << error.what() << "\n"
+                        << fl->warnMore() << "... Suggest 'gzip' or 'zstd'");
+        }
+        m_netlistCompress = valp;
+    });
+    DECL_OPTION("-netlist-diff", Set, &m_netlistDiff);
+    DECL_OPTION("-netlist-diff-flat", Set, &m_netlistDiffFlat);
+    DECL_OPTION("-netlist-diff-hier", Set, &m_netlistDiffHier);
+    DECL_OPTION("-netlist-fanin-cone", CbVal, [this](const char* valp) { m_netlistFaninCones.insert(valp); });
+    DECL_OPTION("-netlist-fanout-cone", CbVal, [this](const char* valp) { m_netlistFanoutCones.insert(valp); });
+    DECL_OPTION("-netlist-group-buses", OnOff, &m_netlistGroupBuses);
+    DECL_OPTION("-netlist-hgr", Set, &m_netlistHgr);
+    DECL_OPTION("-netlist-hgr-csr", Set, &m_netlistHgrCsr);
+    DECL_OPTION("-netlist-json", OnOff, &m_netlistJson);
+    DECL_OPTION("-netlist-partition", CbVal, [this, fl](const char* valp) {
+        m_netlistPartition = std::atoi(valp);
+        if (m_netlistPartition < 0) fl->v3fatal("--netlist-partition must be >= 0: " << valp);
+    });
+    DECL_OPTION("-netlist-power", OnOff, &m_netlistPower);
+    DECL_OPTION("-netlist-power-activity", Set, &m_netlistPowerActivity);
+    DECL_OPTION("-netlist-profile", Set, &m_netlistProfile);
+    DECL_OPTION("-netlist-save", Set, &m_netlistSave);
+    DECL_OPTION("-netlist-scan-chains", Set, &m_netlistScanChains);
+    DECL_OPTION("-netlist-stats", OnOff, &m_netlistStats);
+    DECL_OPTION("-netlist-threads", CbVal, [this, fl](const char* valp) {
+        m_netlistThreads = std::atoi(valp);
+        if (m_netlistThreads < 0) fl->v3fatal("--netlist-threads must be >= 0: " << valp);
+    });
+    DECL_OPTION("-netlist-timing", CbVal, [this, fl](const char* valp) {
+        m_netlistTiming = std::atoi(valp);
+        if (m_netlistTiming < 0) fl->v3fatal("--netlist-timing must be >= 0: " << valp);
+    });
 
     DECL_OPTION("-O", CbPartialMatch, [this](const char* optp) {
         // Optimization
@@ -1270,7 +1347,15 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc, char
         m_statsVars = flag;
         m_stats |= flag;
     });
+    DECL_OPTION("-std-cell-lib", Set, &m_stdCellLib);
+    DECL_OPTION("-strash", OnOff, &m_strash);
+    DECL_OPTION("-strash-merge", CbOnOff, [this](bool flag) {
+        m_strashMerge = flag;
+        m_strash |= flag;
+    });
+    DECL_OPTION("-strash-regs", OnOff, &m_strashRegs);
     DECL_OPTION("-structs-unpacked", OnOff, &m_structsPacked);
+    DECL_OPTION("-sweep", OnOff, &m_sweep);
     DECL_OPTION("-sv", CbCall, [this]() { m_defaultLanguage = V3LangCode::L1800_2017; });
 
     DECL_OPTION("-threads-coarsen", OnOff, &m_threadsCoarsen).undocumented();  // Debug
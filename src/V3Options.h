@@ -201,6 +201,9 @@ private:
     V3StringSet m_libraryFiles; // argument: Verilog -v files
     V3StringSet m_clockers;     // argument: Verilog -clk signals
     V3StringSet m_noClockers;   // argument: Verilog -noclk signals
+    V3StringSet m_flattenKeeps; // argument: --flatten-keep modules
+    V3StringSet m_netlistFaninCones; // argument: --netlist-fanin-cone names
+    V3StringSet m_netlistFanoutCones; // argument: --netlist-fanout-cone names
     V3StringList m_vFiles;      // argument: Verilog files to read
     V3StringList m_forceIncs;   // argument: -FI
     DebugSrcMap m_debugSrcs;    // argument: --debugi-<srcfile>=<level>
@@ -218,6 +221,7 @@ private:
     bool m_build = false;           // main switch: --build
     bool m_cdc = false;             // main switch: --cdc
     bool m_cmake = false;           // main switch: --make cmake
+    bool m_collapseAssigns = false;  // main switch: --collapse-assigns
     bool m_context = true;          // main switch: --Wcontext
     bool m_coverageLine = false;    // main switch: --coverage-block
     bool m_coverageToggle = false;  // main switch: --coverage-toggle
@@ -246,6 +250,11 @@ private:
     bool m_gmake = false;           // main switch: --make gmake
     bool m_main = false;            // main swithc: --main
     bool m_mergeConstPool = true;   // main switch: --merge-const-pool
+    bool m_netlistGroupBuses = false; // main switch: --netlist-group-buses
+    bool m_netlistClocks = false;   // main switch: --netlist-clocks
+    bool m_netlistJson = false;     // main switch: --netlist-json
+    bool m_netlistPower = false;    // main switch: --netlist-power
+    bool m_netlistStats = false;    // main switch: --netlist-stats
     bool m_orderClockDly = true;    // main switch: --order-clock-delay
     bool m_outFormatOk = false;     // main switch: --cc, --sc or --sp was specified
     bool m_pedantic = false;        // main switch: --Wpedantic
@@ -267,6 +276,10 @@ private:
     bool m_systemC = false;         // main switch: --sc: System C instead of simple C++
     bool m_stats = false;           // main switch: --stats
     bool m_statsVars = false;       // main switch: --stats-vars
+    bool m_sweep = false;           // main switch: --sweep
+    bool m_strash = false;          // main switch: --strash
+    bool m_strashMerge = false;     // main switch: --strash-merge
+    bool m_strashRegs = false;      // main switch: --strash-regs
     bool m_threadsCoarsen = true;   // main switch: --threads-coarsen
     bool m_threadsDpiPure = true;   // main switch: --threads-dpi all/pure
     bool m_threadsDpiUnpure = false;  // main switch: --threads-dpi all
@@ -286,6 +299,7 @@ private:
     int         m_coverageMaxWidth = 256; // main switch: --coverage-max-width
     int         m_dumpTree = 0;     // main switch: --dump-tree
     int         m_expandLimit = 64;  // main switch: --expand-limit
+    int         m_flattenDepth = -1;  // main switch: --flatten-depth (-1 == unlimited)
     int         m_gateStmts = 100;    // main switch: --gate-stmts
     int         m_ifDepth = 0;      // main switch: --if-depth
     int         m_inlineMult = 2000;   // main switch: --inline-mult
@@ -293,6 +307,10 @@ private:
     VOptionBool m_makeDepend;  // main switch: -MMD
     int         m_maxNumWidth = 65536;  // main switch: --max-num-width
     int         m_moduleRecursion = 100;  // main switch: --module-recursion-depth
+    int         m_netlistConeDepth = 0;  // main switch: --netlist-cone-depth (0 == no limit)
+    int         m_netlistPartition = 0;  // main switch: --netlist-partition (0 == off)
+    int         m_netlistTiming = 0;  // main switch: --netlist-timing (0 == off)
+    int         m_netlistThreads = 1;  // main switch: --netlist-threads (0 == all hardware threads)
     int         m_outputSplit = 20000;  // main switch: --output-split
     int         m_outputSplitCFuncs = -1;  // main switch: --output-split-cfuncs
     int         m_outputSplitCTrace = -1;  // main switch: --output-split-ctrace
@@ -320,13 +338,29 @@ private:
     string      m_bin;          // main switch: --bin {binary}
     string      m_exeName;      // main switch: -o {name}
     string      m_flags;        // main switch: -f {name}
+    string      m_flattenNameMap; // main switch: --flatten-name-map {filename}
+    string      m_flattenSpillDir; // main switch: --flatten-spill-dir {dirname}
     string      m_l2Name;       // main switch: --l2name; "" for top-module's name
     string      m_libCreate;    // main switch: --lib-create {lib_name}
     string      m_makeDir;      // main switch: -Mdir
     string      m_modPrefix;    // main switch: --mod-prefix
+    string      m_netlistAiger; // main switch: --netlist-aiger {filename}
+    string      m_netlistBlif;  // main switch: --netlist-blif {filename}
+    string      m_netlistCache; // main switch: --netlist-cache {filename}
+    string      m_netlistCompress; // main switch: --netlist-compress {gzip|zstd}
+    string      m_netlistDiff;  // main switch: --netlist-diff {filename}
+    string      m_netlistDiffFlat;  // main switch: --netlist-diff-flat {filename}
+    string      m_netlistDiffHier;  // main switch: --netlist-diff-hier {filename}
+    string      m_netlistHgr;   // main switch: --netlist-hgr {filename}
+    string      m_netlistHgrCsr; // main switch: --netlist-hgr-csr {filename}
+    string      m_netlistPowerActivity; // main switch: --netlist-power-activity {filename}
+    string      m_netlistProfile; // main switch: --netlist-profile {filename}
+    string      m_netlistSave;  // main switch: --netlist-save {filename}
+    string      m_netlistScanChains; // main switch: --netlist-scan-chains {dirname}
     string      m_pipeFilter;   // main switch: --pipe-filter
     string      m_prefix;       // main switch: --prefix
     string      m_protectKey;   // main switch: --protect-key
+    string      m_stdCellLib;   // main switch: --std-cell-lib
     string      m_topModule;    // main switch: --top-module
     string      m_unusedRegexp; // main switch: --unused-regexp
     string      m_waiverOutput;  // main switch: --waiver-output {filename}
@@ -418,6 +452,10 @@ public:
     bool savable() const { return m_savable; }
     bool stats() const { return m_stats; }
     bool statsVars() const { return m_statsVars; }
+    bool sweep() const { return m_sweep; }
+    bool strash() const { return m_strash; }
+    bool strashMerge() const { return m_strashMerge; }
+    bool strashRegs() const { return m_strashRegs; }
     bool structsPacked() const { return m_structsPacked; }
     bool assertOn() const { return m_assert; }  // assertOn as __FILE__ may be defined
     bool autoflush() const { return m_autoflush; }
@@ -425,6 +463,7 @@ public:
     bool bboxUnsup() const { return m_bboxUnsup; }
     bool build() const { return m_build; }
     bool cdc() const { return m_cdc; }
+    bool collapseAssigns() const { return m_collapseAssigns; }
     bool cmake() const { return m_cmake; }
     bool context() const { return m_context; }
     bool coverage() const { return m_coverageLine || m_coverageToggle || m_coverageUser; }
@@ -447,6 +486,9 @@ public:
     bool dumpDefines() const { return m_dumpDefines; }
     bool exe() const { return m_exe; }
     bool flatten() const { return m_flatten; }
+    int flattenDepth() const { return m_flattenDepth; }
+    string flattenNameMap() const { return m_flattenNameMap; }
+    string flattenSpillDir() const { return m_flattenSpillDir; }
     bool gmake() const { return m_gmake; }
     bool threadsDpiPure() const { return m_threadsDpiPure; }
     bool threadsDpiUnpure() const { return m_threadsDpiUnpure; }
@@ -458,6 +500,15 @@ public:
     bool traceUnderscore() const { return m_traceUnderscore; }
     bool main() const { return m_main; }
     bool mergeConstPool() const { return m_mergeConstPool; }
+    bool netlistGroupBuses() const { return m_netlistGroupBuses; }
+    bool netlistClocks() const { return m_netlistClocks; }
+    bool netlistJson() const { return m_netlistJson; }
+    bool netlistPower() const { return m_netlistPower; }
+    bool netlistStats() const { return m_netlistStats; }
+    int netlistConeDepth() const { return m_netlistConeDepth; }
+    int netlistPartition() const { return m_netlistPartition; }
+    int netlistTiming() const { return m_netlistTiming; }
+    int netlistThreads() const { return m_netlistThreads; }
     bool orderClockDly() const { return m_orderClockDly; }
     bool outFormatOk() const { return m_outFormatOk; }
     bool keepTempFiles() const { return (V3Error::debugDefault() != 0); }
@@ -538,11 +589,25 @@ public:
     }
     string makeDir() const { return m_makeDir; }
     string modPrefix() const { return m_modPrefix; }
+    string netlistAiger() const { return m_netlistAiger; }
+    string netlistBlif() const { return m_netlistBlif; }
+    string netlistCache() const { return m_netlistCache; }
+    string netlistCompress() const { return m_netlistCompress; }
+    string netlistDiff() const { return m_netlistDiff; }
+    string netlistDiffFlat() const { return m_netlistDiffFlat; }
+    string netlistDiffHier() const { return m_netlistDiffHier; }
+    string netlistHgr() const { return m_netlistHgr; }
+    string netlistHgrCsr() const { return m_netlistHgrCsr; }
+    string netlistPowerActivity() const { return m_netlistPowerActivity; }
+    string netlistProfile() const { return m_netlistProfile; }
+    string netlistSave() const { return m_netlistSave; }
+    string netlistScanChains() const { return m_netlistScanChains; }
     string pipeFilter() const { return m_pipeFilter; }
     string prefix() const { return m_prefix; }
     // Not just called protectKey() to avoid bugs of not using protectKeyDefaulted()
     bool protectKeyProvided() const { return !m_protectKey.empty(); }
     string protectKeyDefaulted();  // Set default key if not set by user
+    string stdCellLib() const { return m_stdCellLib; }
     string topModule() const { return m_topModule; }
     string unusedRegexp() const { return m_unusedRegexp; }
     string waiverOutput() const { return m_waiverOutput; }
@@ -556,6 +621,9 @@ public:
     const V3StringList& ldLibs() const { return m_ldLibs; }
     const V3StringList& makeFlags() const { return m_makeFlags; }
     const V3StringSet& libraryFiles() const { return m_libraryFiles; }
+    const V3StringSet& flattenKeeps() const { return m_flattenKeeps; }
+    const V3StringSet& netlistFaninCones() const { return m_netlistFaninCones; }
+    const V3StringSet& netlistFanoutCones() const { return m_netlistFanoutCones; }
     const V3StringList& vFiles() const { return m_vFiles; }
     const V3StringList& forceIncs() const { return m_forceIncs; }
 
@@ -13,6 +13,7 @@
 // SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
 //
 //*************************************************************************
+#include "V3Stats.h"
 #include "VerilogNetlist.h"
 int main(int argc, char **argv, char **env)
 {
@@ -21,10 +22,27 @@ int main(int argc, char **argv, char **env)
   verilogNetlist.parseHierNet(argc, argv, env);
   // 2,Print a hierarchical netlist to a verilog file.
   verilogNetlist.printHierNet();
+  NetlistProfiler::endStage("printHierNet", verilogNetlist.getHierNet());
   // 3,Flatten a hierarchical netlist
   verilogNetlist.callFlattenHierNet();
+  NetlistProfiler::endStage("flattenHierNet", verilogNetlist.getFlatNet());
   // verilogNetlist.sortInsOrderInTop();
-  // 4,Print a flattened netlist to a verilog file.
+  // 4,Run the passes over the flattened netlist whose options are given,
+  // like sweeping, exporting, analyzing, comparing and saving it.
+  for(const auto &pass: verilogNetlist.getFlatNetPasses())
+  {
+    if(!pass.isEnabled)
+      continue;
+    (verilogNetlist.*pass.call)();
+    NetlistProfiler::endStage(pass.stageName, verilogNetlist.getFlatNet());
+  }
+  // 5,Print a flattened netlist to a verilog file.
   verilogNetlist.printFlatNet();
+  NetlistProfiler::endStage("printFlatNet", verilogNetlist.getFlatNet());
+  // 6,Write the time and memory of every stage.
+  if(!v3Global.opt.netlistProfile().empty())
+    NetlistProfiler::writeJson(v3Global.opt.netlistProfile());
+  if(v3Global.opt.stats())
+    V3Stats::statsReport();
   return 0;
 }
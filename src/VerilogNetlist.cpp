@@ -5,6 +5,8 @@
   > Created Time: Sun 01 May 2022 04:09:26 PM CST
  ************************************************************************/
 
+#include "NetlistParallel.h"
+#include "NetlistWriter.h"
 #include "VerilogNetlist.h"
 #include <climits>
 #include <cstdint>
@@ -28,379 +30,171 @@ void VerilogNetlist::printNetlist(const std::vector<Module> &hierNetlist,
                                   const uint32_t &totalUsedStdCells,
                                   const uint32_t &totalUsedBlackBoxes,
                                   std::string fileName,
-                                  const uint32_t maxHierLevel)
+                                  const std::vector<bool> &isPrinted,
+                                  const std::string &nameMapFileName)
 {
-  std::ofstream ofs(fileName);
-  bool shouldHaveEscapeChar;
-  uint32_t totalCharsEveryLine;
-  auto getDecimalNumberLength = [](uint32_t number)
+  auto os = openNetlistOutput(fileName);
+  NetlistWriter writer(os.get());
+  writer.setGroupingBuses(v3Global.opt.netlistGroupBuses());
+  std::ofstream nameMapOfs;
+  uint64_t nameId = 1;
+  if(!nameMapFileName.empty())
   {
-    uint32_t length = 0;
-    while(number)
-    {
-      number /= 10;
-      length++;
-    }
-    return length;
-  };
-  auto hasVerilogKeyWordOrOperator = [](const string &name)
-  {
-    // If there are too many kinds of keywords(more than 14) will be used in
-    // port name, instance name, module name, variable name and so on, use map
-    // to replace vector.
-    std::vector<std::string> verilogKeyWord = { "run", "signed" };
-    std::vector<std::string> verilogOperator = { "[", ".", "]" };
-    for(auto vKW: verilogKeyWord)
-    {
-      if(vKW.size() == name.size() && name.find(vKW) < name.size())
-        return true;
-    }
-    for(auto vO: verilogOperator)
-    {
-      if(name.find(vO) < name.size())
-        return true;
-    }
-    return false;
-  };
-  const uint32_t maxCharsEveryLine = 80;
-  uint32_t modIndex = totalUsedStdCells;
+    nameMapOfs.open(nameMapFileName);
+    if(!nameMapOfs)
+      throw std::runtime_error("Can't open " + nameMapFileName + ".");
+    nameMapOfs << "*NAME_MAP\n";
+  }
   // Every time print one module defintion
   for(uint32_t modIndex = totalUsedStdCells; modIndex < hierNetlist.size();
       modIndex++)
   {
     const auto &oneMod = hierNetlist[modIndex];
-    totalCharsEveryLine = 0;
-    if(oneMod.level <= maxHierLevel || modIndex < totalUsedBlackBoxes)
-    { // Print one module declaration
-      ofs << "module " << oneMod.moduleDefName << "(";
-      totalCharsEveryLine =
-        totalCharsEveryLine + 7 + oneMod.moduleDefName.size() + 1;
-      for(const auto &port: oneMod.ports)
+    if(!isPrinted.empty() && !isPrinted[modIndex] &&
+       modIndex >= totalUsedBlackBoxes)
+      continue;
+    if(nameMapFileName.empty() || modIndex < totalUsedBlackBoxes)
+    {
+      writer.writeModule(hierNetlist, oneMod);
+      continue;
+    }
+    // Black boxes and ports keep their names.
+    CompactNames compactNames(oneMod, nameId);
+    writer.writeModule(hierNetlist, oneMod, &compactNames);
+    nameMapOfs << "// module " << oneMod.moduleDefName << '\n';
+    for(uint32_t portDefIndex = oneMod.totalPortsExcludingWires;
+        portDefIndex < oneMod.ports.size(); portDefIndex++)
+      nameMapOfs << '*' << nameId++ << ' '
+                 << oneMod.ports[portDefIndex].portDefName << '\n';
+    for(const auto &subModInsName: oneMod.subModuleInstanceNames)
+      nameMapOfs << '*' << nameId++ << ' ' << subModInsName << '\n';
+  }
+  writer.flush(*os);
+}
+
+namespace
+{
+
+struct RefVarPosition
+{
+    // An instance index or an assign statement index
+    uint32_t index;
+    uint32_t portDefIndex;
+    // An index in refVars, or 0 for lValue and 1 for rValue
+    uint32_t refVarIndex;
+};
+
+// Where the wires and ports of a flattened module are referenced. When the
+// module is inlined into its parents, instances and assign statements are
+// copied at once, and only these positions are changed, wires by an offset
+// and ports by the nets connected to the instance.
+struct FlatModTemplate
+{
+    std::vector<RefVarPosition> wirePins;
+    std::vector<RefVarPosition> portPins;
+    std::vector<RefVarPosition> wireAssignSides;
+    std::vector<RefVarPosition> portAssignSides;
+    FlatModTemplate() = default;
+    explicit FlatModTemplate(const Module &flatMod)
+    {
+      const uint32_t totalPorts = flatMod.totalPortsExcludingWires;
+      for(uint32_t insIndex = 0;
+          insIndex < flatMod.portAssignmentsOfSubModInss.size(); insIndex++)
       {
-        if(port.portType != PortType::WIRE &&
-           port.portType != PortType::LAST_PORT_TYPE)
+        const auto &portAssignments =
+          flatMod.portAssignmentsOfSubModInss[insIndex];
+        for(uint32_t portDefIndex = 0; portDefIndex < portAssignments.size();
+            portDefIndex++)
         {
-          if(totalCharsEveryLine + port.portDefName.size() > maxCharsEveryLine)
-          {
-            ofs << std::endl << "      ";
-            totalCharsEveryLine = 6;
-          }
-          totalCharsEveryLine = port.portDefName.size() + totalCharsEveryLine;
-          if(hasVerilogKeyWordOrOperator(port.portDefName))
+          const auto &refVars = portAssignments[portDefIndex].refVars;
+          for(uint32_t refVarIndex = 0; refVarIndex < refVars.size();
+              refVarIndex++)
           {
-            shouldHaveEscapeChar = true;
-            ofs << "\\";
-            totalCharsEveryLine++;
+            const auto &oneRefVar = refVars[refVarIndex];
+            if(oneRefVar.refVarDefIndex == UINT32_MAX)
+              continue;
+            (oneRefVar.refVarDefIndex >= totalPorts ? wirePins : portPins)
+              .push_back({ insIndex, portDefIndex, refVarIndex });
           }
-          ofs << port.portDefName;
-          if(shouldHaveEscapeChar)
-          {
-            ofs << " ";
-            totalCharsEveryLine++;
-            shouldHaveEscapeChar = false;
-          }
-          ofs << ",";
-          totalCharsEveryLine++;
         }
       }
-      ofs.seekp(ofs.tellp() - std::streampos(1)); // delete one ","
-      ofs << ");" << std::endl;
-      // Every time print one port definition
-      for(const auto &port: oneMod.ports)
+      for(uint32_t assignIndex = 0; assignIndex < flatMod.assigns.size();
+          assignIndex++)
       {
-        switch(port.portType)
-        {
-        case PortType::INPUT:
-          ofs << "   input ";
-          break;
-        case PortType::OUTPUT:
-          ofs << "   output ";
-          break;
-        case PortType::INOUT:
-          ofs << "   inout ";
-          break;
-        case PortType::WIRE:
-          ofs << "   wire ";
-          break;
-        }
-        if(port.isVector)
-        {
-          ofs << "[" << port.bitWidth - 1 << ":0]";
-        }
-        if(hasVerilogKeyWordOrOperator(port.portDefName))
+        const auto &oneAssign = flatMod.assigns[assignIndex];
+        const RefVar *sides[2] = { &oneAssign.lValue, &oneAssign.rValue };
+        for(uint32_t side = 0; side < 2; side++)
         {
-          shouldHaveEscapeChar = true;
-          ofs << "\\";
+          if(sides[side]->refVarDefIndex == UINT32_MAX)
+            continue;
+          (sides[side]->refVarDefIndex >= totalPorts ? wireAssignSides
+                                                     : portAssignSides)
+            .push_back({ assignIndex, 0, side });
         }
-        ofs << port.portDefName;
-        if(shouldHaveEscapeChar)
-        {
-          ofs << " ";
-          shouldHaveEscapeChar = false;
-        }
-        ofs << ";" << std::endl;
       }
+    };
+};
 
-      // Every time print one assign statement, every assign statement only has
-      // one bit data;
-      for(auto oneAssign: oneMod.assigns)
-      {
-        ofs << "  assign ";
-        if(hasVerilogKeyWordOrOperator(
-             oneMod.ports[oneAssign.lValue.refVarDefIndex].portDefName))
-        {
-          shouldHaveEscapeChar = true;
-          ofs << "\\";
-        }
-        ofs << oneMod.ports[oneAssign.lValue.refVarDefIndex].portDefName;
-        if(shouldHaveEscapeChar)
-        {
-          ofs << " ";
-          shouldHaveEscapeChar = false;
-        }
-        if(oneAssign.lValue.refVarDefIndex != UINT32_MAX)
-        {
-          if(oneMod.ports[oneAssign.lValue.refVarDefIndex].isVector)
-            ofs << "[" << oneAssign.lValue.bitIndex << "]";
-        }
-        else
-        {
-          throw std::runtime_error(
-            "Assign left value can not be const value or x or z.");
-        }
-        ofs << " = ";
-        // rValue is a consta value or x or z
-        if(oneAssign.rValue.refVarDefIndex == UINT32_MAX)
-        {
-          switch(oneAssign.rValue.valueAndValueX)
-          {
-          case CHAR_ONE:
-            ofs << "1'b1";
-            break;
-          case CHAR_ZERO:
-            ofs << "1'b0";
-            break;
-          case CHAR_X:
-            ofs << "1'bx";
-            break;
-          case CHAR_Z:
-            ofs << "1'bz";
-            break;
-          default:
-            ofs << "1'be"; // e = error valuex
-            break;
-          }
-        }
-        else
-        {
-          if(hasVerilogKeyWordOrOperator(
-               oneMod.ports[oneAssign.rValue.refVarDefIndex].portDefName))
-          {
-            shouldHaveEscapeChar = true;
-            ofs << "\\";
-          }
-          ofs << oneMod.ports[oneAssign.rValue.refVarDefIndex].portDefName;
-          if(shouldHaveEscapeChar)
-          {
-            ofs << " ";
-            shouldHaveEscapeChar = false;
-          }
-          if(oneMod.ports[oneAssign.rValue.refVarDefIndex].isVector)
-            ofs << "[" << oneAssign.rValue.bitIndex << "]";
-        }
-        ofs << ";" << std::endl;
-      }
+} // namespace
 
-      // Every time print one submodule instance
-      uint32_t subModInsIndex = 0;
-      for(const auto &onesubModInsName: oneMod.subModuleInstanceNames)
-      {
-        totalCharsEveryLine = 0;
-        ofs << "  "
-            << hierNetlist[oneMod.subModuleDefIndexs[subModInsIndex]]
-                 .moduleDefName
-            << " ";
-        if(hasVerilogKeyWordOrOperator(onesubModInsName))
-        {
-          ofs << "\\";
-          totalCharsEveryLine++;
-        }
-        ofs << onesubModInsName << " "
-            << "(";
-        totalCharsEveryLine =
-          totalCharsEveryLine + 5 +
-          hierNetlist[oneMod.subModuleDefIndexs[subModInsIndex]]
-            .moduleDefName.size() +
-          onesubModInsName.size();
-        // Every time print one port assignment
-        uint32_t portDefIndex = 0;
-        for(const auto &onePortAssignment:
-            oneMod.portAssignmentsOfSubModInss[subModInsIndex])
-        {
-          if(totalCharsEveryLine + 1 +
-               hierNetlist[oneMod.subModuleDefIndexs[subModInsIndex]]
-                 .ports[portDefIndex]
-                 .portDefName.size() >
-             maxCharsEveryLine)
-          {
-            ofs << std::endl << "      ";
-            totalCharsEveryLine = 6;
-          }
-          ofs << ".";
-          if(hasVerilogKeyWordOrOperator(
-               hierNetlist[oneMod.subModuleDefIndexs[subModInsIndex]]
-                 .ports[portDefIndex]
-                 .portDefName))
-          {
-            shouldHaveEscapeChar = true;
-            ofs << "\\";
-            totalCharsEveryLine++;
-          }
-          ofs << hierNetlist[oneMod.subModuleDefIndexs[subModInsIndex]]
-                   .ports[portDefIndex]
-                   .portDefName;
-          if(shouldHaveEscapeChar)
-          {
-            ofs << " ";
-            totalCharsEveryLine++;
-            shouldHaveEscapeChar = false;
-          }
-          ofs << "(";
-          totalCharsEveryLine =
-            totalCharsEveryLine + 2 +
-            hierNetlist[oneMod.subModuleDefIndexs[subModInsIndex]]
-              .ports[portDefIndex]
-              .portDefName.size();
-          if(onePortAssignment.refVars.size() > 1)
-          {
-            ofs << "{";
-            totalCharsEveryLine++;
-          }
-          for(uint32_t indexOfRefVars = onePortAssignment.refVars.size();
-              indexOfRefVars > 0; indexOfRefVars--)
-          {
-            auto &refVar = onePortAssignment.refVars[indexOfRefVars - 1];
-            if(refVar.refVarDefIndex == UINT32_MAX)
-            {
-              if(totalCharsEveryLine + 4 > maxCharsEveryLine)
-              {
-                ofs << std::endl << "      ";
-                totalCharsEveryLine = 6;
-              }
-              switch(refVar.valueAndValueX)
-              {
-              case CHAR_ONE:
-                ofs << "1'b1";
-                break;
-              case CHAR_ZERO:
-                ofs << "1'b0";
-                break;
-              case CHAR_X:
-                ofs << "1'bx";
-                break;
-              case CHAR_Z:
-                ofs << "1'bz";
-                break;
-              default:
-                ofs << "1'be"; // e = error valuex
-                break;
-              }
-              totalCharsEveryLine = totalCharsEveryLine + 4;
-            }
-            else
-            {
-              if(oneMod.ports[refVar.refVarDefIndex].isVector)
-              {
-                if(totalCharsEveryLine +
-                     oneMod.ports[refVar.refVarDefIndex].portDefName.size() +
-                     2 + getDecimalNumberLength(refVar.bitIndex) >
-                   maxCharsEveryLine)
-                {
-                  ofs << std::endl << "      ";
-                  totalCharsEveryLine = 6;
-                }
-              }
-              else
-              {
-                if(totalCharsEveryLine +
-                     oneMod.ports[refVar.refVarDefIndex].portDefName.size() >
-                   maxCharsEveryLine)
-                {
-                  ofs << std::endl << "      ";
-                  totalCharsEveryLine = 6;
-                }
-              }
-              if(hasVerilogKeyWordOrOperator(
-                   oneMod.ports[refVar.refVarDefIndex].portDefName))
-              {
-                shouldHaveEscapeChar = true;
-                ofs << "\\";
-                totalCharsEveryLine++;
-              }
-              ofs << oneMod.ports[refVar.refVarDefIndex].portDefName;
-              totalCharsEveryLine =
-                totalCharsEveryLine +
-                oneMod.ports[refVar.refVarDefIndex].portDefName.size();
-              if(shouldHaveEscapeChar)
-              {
-                ofs << " ";
-                totalCharsEveryLine++;
-                shouldHaveEscapeChar = false;
-              }
-              if(oneMod.ports[refVar.refVarDefIndex].isVector)
-              {
-                ofs << "[" << refVar.bitIndex << "]";
-                totalCharsEveryLine = totalCharsEveryLine + 2 +
-                                      getDecimalNumberLength(refVar.bitIndex);
-              }
-            }
-            ofs << ",";
-            totalCharsEveryLine++;
-          }
-          if(onePortAssignment.refVars.size() >= 1)
-          {
-            ofs.seekp(ofs.tellp() - std::streampos(1)); // delete one ","
-            totalCharsEveryLine--;
-          }
-          if(onePortAssignment.refVars.size() > 1)
-          {
-            ofs << "}";
-            totalCharsEveryLine++;
-          }
-          ofs << ")";
-          ofs << ", ";
-          totalCharsEveryLine = totalCharsEveryLine + 3;
-          portDefIndex++;
-        }
-        ofs.seekp(ofs.tellp() - std::streampos(1)); // delete one ","
-        ofs.seekp(ofs.tellp() - std::streampos(1)); // delete one " "
-        ofs << ");";
-        ofs << std::endl;
-        subModInsIndex++;
-      }
-      ofs << "endmodule" << std::endl << std::endl;
-    }
-  }
-  ofs.close();
+bool VerilogNetlist::isHardMacro(const std::vector<Module> &hierNetlist,
+                                 const uint32_t &totalUsedBlackBoxes,
+                                 const int &flattenDepth,
+                                 const V3StringSet &keptModDefNames,
+                                 const uint32_t &modDefIndex,
+                                 const uint32_t &subModDefIndex)
+{
+  auto isDeeperThanFlattenDepth = [&](const uint32_t &oneModDefIndex)
+  {
+    return flattenDepth >= 0 &&
+           hierNetlist[oneModDefIndex].level -
+               hierNetlist[totalUsedBlackBoxes].level >
+             static_cast<uint32_t>(flattenDepth);
+  };
+  return keptModDefNames.count(hierNetlist[subModDefIndex].moduleDefName) ||
+         (isDeeperThanFlattenDepth(subModDefIndex) &&
+          !isDeeperThanFlattenDepth(modDefIndex));
 }
 
 // Use case2 as a example to demonstrate.
+// A module instance is kept as a hard macro, if its module is in
+// keptModDefNames, or if its module is deeper than flattenDepth while its
+// parent isn't. The depth of a module is its level, the depth of its deepest
+// instance, since every module is flattened only once. A macro is flattened
+// itself, so every module from the top to flattenDepth is inlined into its
+// parent, and so is every module below it.
 void VerilogNetlist::flattenHierNet(const std::vector<Module> &hierNetlist,
                                     std::vector<Module> &flatNetlist,
-                                    const uint32_t &totalUsedBlackBoxes)
+                                    const uint32_t &totalUsedBlackBoxes,
+                                    const bool &shouldCollapseAssigns,
+                                    const int &flattenDepth,
+                                    const V3StringSet &keptModDefNames,
+                                    const uint32_t &totalThreads,
+                                    std::vector<Module> *reusedFlatMods)
 {
   flatNetlist = hierNetlist;
   // Use to not flatten such module which only have black boxes or assign
   // statement; Sometimes, totalUsedBlackBoxes = 0.
   auto &theMostDepthLevelExcludingBlackBoxes = hierNetlist.back().level;
-  for(uint32_t modDefIndex = hierNetlist.size() - 1;
-      modDefIndex >= totalUsedBlackBoxes && modDefIndex != UINT32_MAX;
-      modDefIndex--)
+  auto isHardMacro = [&](const uint32_t &modDefIndex,
+                         const uint32_t &subModDefIndex)
+  {
+    return VerilogNetlist::isHardMacro(hierNetlist, totalUsedBlackBoxes,
+                                       flattenDepth, keptModDefNames,
+                                       modDefIndex, subModDefIndex);
+  };
+  // flatModTemplates[modDefIndex] is built once the module is flattened.
+  std::vector<FlatModTemplate> flatModTemplates(hierNetlist.size());
+  auto flattenOneMod = [&](const uint32_t &modDefIndex)
   {
     // full_adder definition
     const auto &oneModH = hierNetlist[modDefIndex];
     auto &oneModF = flatNetlist[modDefIndex];
-    if(oneModH.level < theMostDepthLevelExcludingBlackBoxes)
+    const bool isReused =
+      reusedFlatMods && !(*reusedFlatMods)[modDefIndex].moduleDefName.empty();
+    if(isReused)
+      oneModF = std::move((*reusedFlatMods)[modDefIndex]);
+    else if(oneModH.level < theMostDepthLevelExcludingBlackBoxes)
     {
       oneModF.subModuleInstanceNames.clear();
       oneModF.subModuleDefIndexs.clear();
@@ -409,8 +203,9 @@ void VerilogNetlist::flattenHierNet(const std::vector<Module> &hierNetlist,
       // full_adder_co U1 (.co(co), .a(a), .b(b), .ci(ci));
       for(auto &subModDefIndex: oneModH.subModuleDefIndexs)
       {
-        // subModule is a stdCell or an other black box
-        if(subModDefIndex < totalUsedBlackBoxes)
+        // subModule is a stdCell, an other black box or a hard macro
+        if(subModDefIndex < totalUsedBlackBoxes ||
+           isHardMacro(modDefIndex, subModDefIndex))
         {
           oneModF.subModuleInstanceNames.push_back(
             oneModH.subModuleInstanceNames[subModInsIndex]);
@@ -426,139 +221,113 @@ void VerilogNetlist::flattenHierNet(const std::vector<Module> &hierNetlist,
           const auto &portAssignmentsOfSubModIns =
             oneModH.portAssignmentsOfSubModInss[subModInsIndex];
           // full_adder_co definition
-          auto &oneSubMod = flatNetlist[subModDefIndex];
-          uint32_t oneModFPortsNum = oneModF.ports.size();
-          uint32_t oneSubModWirePos = oneSubMod.totalPortsExcludingWires;
-          oneModF.ports.resize(oneModFPortsNum + oneSubMod.ports.size() -
-                               oneSubModWirePos);
-          // full_adder_co wires,n_0_0 become U1_n_0_0
+          const auto &oneSubMod = flatNetlist[subModDefIndex];
+          const auto &subModTemplate = flatModTemplates[subModDefIndex];
+          const uint32_t oneModFPortsNum = oneModF.ports.size();
+          const uint32_t wireOffset =
+            oneModFPortsNum - oneSubMod.totalPortsExcludingWires;
+          // full_adder_co wires,n_0_0 become U1/n_0_0
+          oneModF.ports.insert(oneModF.ports.end(),
+                               oneSubMod.ports.begin() +
+                                 oneSubMod.totalPortsExcludingWires,
+                               oneSubMod.ports.end());
           for(uint32_t i = oneModFPortsNum; i < oneModF.ports.size(); i++)
-          {
-            oneModF.ports[i] = oneSubMod.ports[oneSubModWirePos];
-            oneModF.ports[i].portDefName.insert(0, "/");
-            oneModF.ports[i].portDefName.insert(0, subModInsName);
-            oneSubModWirePos++;
-          }
+            oneModF.ports[i].portDefName =
+              subModInsName + "/" + oneModF.ports[i].portDefName;
+          // INV_X1_LVT i_0_0 (.A(a), .ZN(n_0_0)); i_0_0 becomes U1/i_0_0
+          for(const auto &blackBoxInsName: oneSubMod.subModuleInstanceNames)
+            oneModF.subModuleInstanceNames.push_back(subModInsName + "/" +
+                                                     blackBoxInsName);
           oneModF.subModuleDefIndexs.insert(
             oneModF.subModuleDefIndexs.end(),
             oneSubMod.subModuleDefIndexs.begin(),
             oneSubMod.subModuleDefIndexs.end());
-          uint32_t blackBoxInsNameIndex = 0;
-          uint32_t portAssignmentsIndex =
-            oneModF.portAssignmentsOfSubModInss.size();
-          oneModF.portAssignmentsOfSubModInss.resize(
-            portAssignmentsIndex +
-            oneSubMod.portAssignmentsOfSubModInss.size());
-          // INV_X1_LVT i_0_0 (.A(a), .ZN(n_0_0));
-          for(auto oneBlackBoxIns: oneSubMod.portAssignmentsOfSubModInss)
+          const uint32_t insOffset = oneModF.portAssignmentsOfSubModInss.size();
+          oneModF.portAssignmentsOfSubModInss.insert(
+            oneModF.portAssignmentsOfSubModInss.end(),
+            oneSubMod.portAssignmentsOfSubModInss.begin(),
+            oneSubMod.portAssignmentsOfSubModInss.end());
+          auto getPin = [&](const RefVarPosition &refVarPos) -> PortAssignment &
+          {
+            return oneModF.portAssignmentsOfSubModInss
+              [insOffset + refVarPos.index][refVarPos.portDefIndex];
+          };
+          // .A(n_0_0) becomes .A(U1/n_0_0)
+          for(const auto &refVarPos: subModTemplate.wirePins)
+            getPin(refVarPos).refVars[refVarPos.refVarIndex].refVarDefIndex +=
+              wireOffset;
+          // .A(a) becomes .A(A[0]), or the pin is unconnected if the port of
+          // full_adder_co instance is empty.
+          for(const auto &refVarPos: subModTemplate.portPins)
           {
-            // blackBoxInsName i_0_0 becomes U1_i_0_0
-            oneModF.subModuleInstanceNames.push_back(
-              oneSubMod.subModuleInstanceNames[blackBoxInsNameIndex]);
-            blackBoxInsNameIndex++;
-            oneModF.subModuleInstanceNames.back().insert(0, "/");
-            oneModF.subModuleInstanceNames.back().insert(0, subModInsName);
-            // .A(a)
-            for(auto &portAssignmentOfBlackBox: oneBlackBoxIns)
-            {
-              for(auto &oneRefVar: portAssignmentOfBlackBox.refVars)
-              {
-                // Now, oneRefVar is a wire
-                if(oneRefVar.refVarDefIndex >=
-                     oneSubMod.totalPortsExcludingWires &&
-                   oneRefVar.refVarDefIndex < UINT32_MAX)
-                {
-                  oneRefVar.refVarDefIndex =
-                    oneRefVar.refVarDefIndex -
-                    oneSubMod.totalPortsExcludingWires + oneModFPortsNum;
-                }
-                // Now,oneRefVar is a input, output or inout
-                else if(oneRefVar.refVarDefIndex <
-                        oneSubMod.totalPortsExcludingWires)
-                { // If the port of full_adder_co instance is empty.
-                  if(portAssignmentsOfSubModIns[oneRefVar.refVarDefIndex]
-                       .refVars.empty())
-                  {
-                    portAssignmentOfBlackBox.refVars.clear();
-                    break;
-                  }
-                  else
-                    oneRefVar =
-                      portAssignmentsOfSubModIns[oneRefVar.refVarDefIndex]
-                        .refVars[oneRefVar.bitIndex];
-                }
-                // Now,oneRefVar is a const value or x or z
-                // else{}
-              }
-            }
-            oneModF.portAssignmentsOfSubModInss[portAssignmentsIndex] =
-              oneBlackBoxIns;
-            portAssignmentsIndex++;
+            auto &refVars = getPin(refVarPos).refVars;
+            if(refVars.empty())
+              continue;
+            auto &oneRefVar = refVars[refVarPos.refVarIndex];
+            const auto &upperRefVars =
+              portAssignmentsOfSubModIns[oneRefVar.refVarDefIndex].refVars;
+            if(upperRefVars.empty())
+              refVars.clear();
+            else
+              oneRefVar = upperRefVars[oneRefVar.bitIndex];
           }
-          uint32_t assignsIndex = oneModF.assigns.size();
-          uint32_t totalAssigns = assignsIndex + oneSubMod.assigns.size();
-          oneModF.assigns.resize(totalAssigns);
-          for(auto oneAssign: oneSubMod.assigns)
+          const uint32_t assignOffset = oneModF.assigns.size();
+          oneModF.assigns.insert(oneModF.assigns.end(),
+                                 oneSubMod.assigns.begin(),
+                                 oneSubMod.assigns.end());
+          auto getAssignSide = [&](const RefVarPosition &refVarPos) -> RefVar &
           {
-            bool _curAssignConnectToEmptySignal = false;
-            // lValue is a wire
-            if(oneAssign.lValue.refVarDefIndex >=
-                 oneSubMod.totalPortsExcludingWires &&
-               oneAssign.lValue.refVarDefIndex < UINT32_MAX)
-            {
-              oneAssign.lValue.refVarDefIndex =
-                oneAssign.lValue.refVarDefIndex -
-                oneSubMod.totalPortsExcludingWires + oneModFPortsNum;
-            }
-            // lValue is a inout or output
-            else if(oneAssign.lValue.refVarDefIndex <
-                    oneSubMod.totalPortsExcludingWires)
-            {
-              if(portAssignmentsOfSubModIns[oneAssign.lValue.refVarDefIndex]
-                   .refVars.empty())
-                _curAssignConnectToEmptySignal = true;
-              else
-                oneAssign.lValue =
-                  portAssignmentsOfSubModIns[oneAssign.lValue.refVarDefIndex]
-                    .refVars[oneAssign.lValue.bitIndex];
-            }
-            // rValue is a wire
-            if(oneAssign.rValue.refVarDefIndex >=
-                 oneSubMod.totalPortsExcludingWires &&
-               oneAssign.rValue.refVarDefIndex < UINT32_MAX)
-            {
-              oneAssign.rValue.refVarDefIndex =
-                oneAssign.rValue.refVarDefIndex -
-                oneSubMod.totalPortsExcludingWires + oneModFPortsNum;
-            }
-            // rValue is a input, inout or output
-            else if(oneAssign.rValue.refVarDefIndex <
-                    oneSubMod.totalPortsExcludingWires)
-            {
-              if(portAssignmentsOfSubModIns[oneAssign.rValue.refVarDefIndex]
-                   .refVars.empty())
-                _curAssignConnectToEmptySignal = true;
-              else
-                oneAssign.rValue =
-                  portAssignmentsOfSubModIns[oneAssign.rValue.refVarDefIndex]
-                    .refVars[oneAssign.rValue.bitIndex];
-            }
-            if(_curAssignConnectToEmptySignal)
-            {
-              _curAssignConnectToEmptySignal = false;
-              totalAssigns--;
-            }
+            auto &oneAssign = oneModF.assigns[assignOffset + refVarPos.index];
+            return refVarPos.refVarIndex ? oneAssign.rValue : oneAssign.lValue;
+          };
+          for(const auto &refVarPos: subModTemplate.wireAssignSides)
+            getAssignSide(refVarPos).refVarDefIndex += wireOffset;
+          // An assign statement connected to an empty port is removed.
+          std::vector<bool> isConnectedToEmptyPort(oneSubMod.assigns.size(),
+                                                   false);
+          for(const auto &refVarPos: subModTemplate.portAssignSides)
+          {
+            auto &oneRefVar = getAssignSide(refVarPos);
+            const auto &upperRefVars =
+              portAssignmentsOfSubModIns[oneRefVar.refVarDefIndex].refVars;
+            if(upperRefVars.empty())
+              isConnectedToEmptyPort[refVarPos.index] = true;
             else
-            {
-              oneModF.assigns[assignsIndex] = oneAssign;
-              assignsIndex++;
-            }
+              oneRefVar = upperRefVars[oneRefVar.bitIndex];
+          }
+          uint32_t assignsIndex = assignOffset;
+          for(uint32_t i = 0; i < oneSubMod.assigns.size(); i++)
+          {
+            if(!isConnectedToEmptyPort[i])
+              oneModF.assigns[assignsIndex++] =
+                oneModF.assigns[assignOffset + i];
           }
-          oneModF.assigns.resize(totalAssigns);
+          oneModF.assigns.resize(assignsIndex);
         }
         subModInsIndex++;
       }
     }
+    // Collapse a module before its parents copy it, so they copy less.
+    // A reused module has been collapsed.
+    if(shouldCollapseAssigns && !isReused)
+      collapseAssigns(flatNetlist, modDefIndex);
+    // Top modules are never inlined.
+    if(oneModH.level > hierNetlist[totalUsedBlackBoxes].level)
+      flatModTemplates[modDefIndex] = FlatModTemplate(oneModF);
+  };
+  // Modules are sorted by level, and a module only copies modules whose
+  // level is bigger. So modules of one level are flattened concurrently,
+  // from the deepest level to the top. Every module is only written by one
+  // thread, so FlatNetlist.v doesn't depend on totalThreads.
+  uint32_t levelEnd = hierNetlist.size();
+  while(levelEnd > totalUsedBlackBoxes)
+  {
+    uint32_t levelBegin = levelEnd - 1;
+    while(levelBegin > totalUsedBlackBoxes &&
+          hierNetlist[levelBegin - 1].level == hierNetlist[levelEnd - 1].level)
+      levelBegin--;
+    parallelFor(levelBegin, levelEnd, totalThreads, flattenOneMod);
+    levelEnd = levelBegin;
   }
 }
 
@@ -6,7 +6,10 @@
  ************************************************************************/
 
 #pragma once
+#include "NetlistCompress.h"
+#include "NetlistProfiler.h"
 #include "OneBitHierNetlist.h"
+#include "StdCellLibrary.h"
 #include <cstdint>
 
 class VerilogNetlist final
@@ -24,6 +27,56 @@ class VerilogNetlist final
     uint32_t _totalUsedNotEmptyInsInTop;
     std::vector<Module> _hierNetlist;
     std::vector<Module> _flatNetlist;
+    // _isInFlatNet[modDefIndex] : the module is written into FlatNetlist.v
+    std::vector<bool> _isInFlatNet;
+    // _usedStdCells[modDefIndex] : the library cell of a black box or a hard
+    // macro of _flatNetlist, see bindUsedStdCells.
+    std::vector<UsedStdCell> _usedStdCells;
+
+  private:
+    // The top modules of a flattened netlist, whose level is the same as the
+    // first module after all black boxes, and the hard macros they instance.
+    bool isInFlatNet(const uint32_t &modDefIndex) const
+    {
+      return modDefIndex >= _totalUsedBlackBoxes && _isInFlatNet[modDefIndex];
+    };
+    // A sub module always has a bigger index than its parent, so one pass
+    // finds all hard macros.
+    void markModsInFlatNet()
+    {
+      _isInFlatNet.assign(_flatNetlist.size(), false);
+      for(uint32_t modDefIndex = _totalUsedBlackBoxes;
+          modDefIndex < _flatNetlist.size(); modDefIndex++)
+      {
+        const auto &oneMod = _flatNetlist[modDefIndex];
+        if(oneMod.level == _flatNetlist[_totalUsedBlackBoxes].level)
+          _isInFlatNet[modDefIndex] = true;
+        if(!_isInFlatNet[modDefIndex])
+          continue;
+        for(const auto &subModDefIndex: oneMod.subModuleDefIndexs)
+          _isInFlatNet[subModDefIndex] = true;
+      }
+    };
+    // Bind the built-in library and --std-cell-lib to used black boxes and
+    // hard macros of the flattened netlist once, for all passes.
+    void bindUsedStdCells()
+    {
+      StdCellLibrary stdCellLibrary;
+      if(!v3Global.opt.stdCellLib().empty())
+        stdCellLibrary.readFile(v3Global.opt.stdCellLib());
+      _usedStdCells =
+        stdCellLibrary.bindNetlist(_flatNetlist, _totalUsedBlackBoxes);
+    };
+    // An output netlist file, which is compressed by --netlist-compress with
+    // --netlist-threads threads and whose name gets ".gz" or ".zst".
+    std::unique_ptr<std::ostream> openNetlistOutput(std::string fileName) const
+    {
+      const auto compression =
+        getNetlistCompression(v3Global.opt.netlistCompress());
+      fileName += getNetlistCompressionSuffix(compression);
+      return openNetlistFile(fileName, compression,
+                             v3Global.opt.netlistThreads());
+    };
 
   public:
     const std::vector<Module> &getHierNet() const { return _hierNetlist; };
@@ -40,9 +93,153 @@ class VerilogNetlist final
     {
       return _totalUsedBlackBoxes;
     };
+    // A pass over the whole flattened netlist in memory, which is run by
+    // main() after flattening if one of its options is given.
+    struct FlatNetPass
+    {
+        const char *stageName;
+        const char *optionNames;
+        bool isEnabled;
+        void (VerilogNetlist::*call)();
+    };
+    // Every pass in the order it runs. A new pass is added here, so it is
+    // run and rejected with --flatten-spill-dir by V3Options like the others.
+    static std::vector<FlatNetPass> getFlatNetPasses()
+    {
+      const auto &opt = v3Global.opt;
+      return {
+        { "sweepFlatNet", "--sweep", opt.sweep(),
+          &VerilogNetlist::callSweepFlatNet },
+        { "strashFlatNet", "--strash/--strash-merge",
+          opt.strash() || opt.strashMerge(),
+          &VerilogNetlist::callStrashFlatNet },
+        { "statNetlist", "--netlist-stats", opt.netlistStats(),
+          &VerilogNetlist::callStatNetlist },
+        { "writeJson", "--netlist-json", opt.netlistJson(),
+          &VerilogNetlist::callWriteJson },
+        { "writeBlif", "--netlist-blif", !opt.netlistBlif().empty(),
+          &VerilogNetlist::callWriteBlif },
+        { "writeAiger", "--netlist-aiger", !opt.netlistAiger().empty(),
+          &VerilogNetlist::callWriteAiger },
+        { "writeHypergraph", "--netlist-hgr/--netlist-hgr-csr",
+          !opt.netlistHgr().empty() || !opt.netlistHgrCsr().empty(),
+          &VerilogNetlist::callWriteHypergraph },
+        { "partitionFlatNet", "--netlist-partition",
+          opt.netlistPartition() != 0,
+          &VerilogNetlist::callPartitionFlatNet },
+        { "analyzeTiming", "--netlist-timing", opt.netlistTiming() != 0,
+          &VerilogNetlist::callAnalyzeTiming },
+        { "extractClockTrees", "--netlist-clocks", opt.netlistClocks(),
+          &VerilogNetlist::callExtractClockTrees },
+        { "traceScanChains", "--netlist-scan-chains",
+          !opt.netlistScanChains().empty(),
+          &VerilogNetlist::callTraceScanChains },
+        { "extractCones", "--netlist-fanin-cone/--netlist-fanout-cone",
+          !opt.netlistFaninCones().empty() ||
+            !opt.netlistFanoutCones().empty(),
+          &VerilogNetlist::callExtractCones },
+        { "estimateActivity", "--netlist-power", opt.netlistPower(),
+          &VerilogNetlist::callEstimateActivity },
+        // The same file may be given to --netlist-diff and --netlist-save,
+        // so the old netlists are compared before they are overwritten.
+        { "diffNetlist",
+          "--netlist-diff/--netlist-diff-hier/--netlist-diff-flat",
+          !opt.netlistDiff().empty() || !opt.netlistDiffHier().empty() ||
+            !opt.netlistDiffFlat().empty(),
+          &VerilogNetlist::callDiffNetlist },
+        { "saveNetlist", "--netlist-save", !opt.netlistSave().empty(),
+          &VerilogNetlist::callSaveNetlist }
+      };
+    };
     void callFlattenHierNet()
     {
-      flattenHierNet(_hierNetlist, _flatNetlist, _totalUsedBlackBoxes);
+      // Flattened while it is printed, see printFlatNetOutOfCore. The passes
+      // which need the whole flattened netlist are rejected by V3Options.
+      if(!v3Global.opt.flattenSpillDir().empty())
+        return;
+      if(v3Global.opt.netlistCache().empty())
+        flattenHierNet(_hierNetlist, _flatNetlist, _totalUsedBlackBoxes,
+                       v3Global.opt.collapseAssigns(),
+                       v3Global.opt.flattenDepth(),
+                       v3Global.opt.flattenKeeps(),
+                       v3Global.opt.netlistThreads());
+      else
+        flattenHierNetIncrementally(v3Global.opt.netlistCache());
+      markModsInFlatNet();
+      bindUsedStdCells();
+    };
+    void callSweepFlatNet()
+    {
+      sweepFlatNet(_flatNetlist, _usedStdCells);
+    };
+    void callStrashFlatNet()
+    {
+      strashFlatNet(_flatNetlist, _usedStdCells, v3Global.opt.strashMerge(),
+                    v3Global.opt.strashRegs());
+    };
+    void callStatNetlist()
+    {
+      statNetlist(_hierNetlist, _flatNetlist);
+    };
+    void callWriteBlif()
+    {
+      writeBlif(_flatNetlist, v3Global.opt.netlistBlif());
+    };
+    void callWriteJson()
+    {
+      writeJson(_hierNetlist, {}, "HierNetlist.json");
+      writeJson(_flatNetlist, _isInFlatNet, "FlatNetlist.json");
+    };
+    void callWriteAiger()
+    {
+      writeAiger(_flatNetlist, _usedStdCells, v3Global.opt.netlistAiger());
+    };
+    void callWriteHypergraph()
+    {
+      writeHypergraph(_flatNetlist, _usedStdCells,
+                      v3Global.opt.netlistHgr(), v3Global.opt.netlistHgrCsr());
+    };
+    void callPartitionFlatNet()
+    {
+      partitionFlatNet(_flatNetlist, _usedStdCells,
+                       v3Global.opt.netlistPartition(),
+                       v3Global.opt.netlistThreads());
+    };
+    void callAnalyzeTiming()
+    {
+      analyzeTiming(_flatNetlist, _usedStdCells, v3Global.opt.netlistTiming(),
+                    v3Global.opt.netlistThreads());
+    };
+    void callExtractClockTrees()
+    {
+      extractClockTrees(_flatNetlist, _usedStdCells);
+    };
+    void callTraceScanChains()
+    {
+      traceScanChains(_flatNetlist, _usedStdCells,
+                      v3Global.opt.netlistScanChains(),
+                      v3Global.opt.netlistThreads());
+    };
+    void callExtractCones()
+    {
+      extractCones(_flatNetlist, _usedStdCells,
+                   v3Global.opt.netlistFaninCones(),
+                   v3Global.opt.netlistFanoutCones(),
+                   v3Global.opt.netlistConeDepth());
+    };
+    void callEstimateActivity()
+    {
+      estimateActivity(_hierNetlist, _flatNetlist, _usedStdCells,
+                       v3Global.opt.flattenDepth(),
+                       v3Global.opt.flattenKeeps(),
+                       v3Global.opt.netlistPowerActivity(),
+                       v3Global.opt.netlistThreads());
+    };
+    void callSaveNetlist() { saveNetlist(v3Global.opt.netlistSave()); };
+    void callDiffNetlist()
+    {
+      diffNetlist(v3Global.opt.netlistDiff(), v3Global.opt.netlistDiffHier(),
+                  v3Global.opt.netlistDiffFlat());
     };
     void printHierNet()
     {
@@ -50,22 +247,167 @@ class VerilogNetlist final
     };
     void printFlatNet()
     {
-      printNetlist(_flatNetlist, _totalUsedStdCells, _totalUsedBlackBoxes,
-                   "FlatNetlist.v", _hierNetlist[_totalUsedBlackBoxes].level);
+      if(!v3Global.opt.flattenSpillDir().empty())
+        printFlatNetOutOfCore(v3Global.opt.flattenSpillDir(),
+                              v3Global.opt.flattenDepth(),
+                              v3Global.opt.flattenKeeps(),
+                              v3Global.opt.netlistThreads());
+      else
+        printNetlist(_flatNetlist, _totalUsedStdCells, _totalUsedBlackBoxes,
+                     "FlatNetlist.v", _isInFlatNet,
+                     v3Global.opt.flattenNameMap());
     };
     // Get a hierarchical netlist from ast
     void genHierNet(std::unordered_set<std::string> emptyStdCellsInJson = {
                       "MemGen_16_10", "PLL" });
-    // Print a Netlist
+    // Print a Netlist. If nameMapFileName isn't empty, wires and instances
+    // of the modules which aren't black boxes are printed as compact numeric
+    // names, whose original names are written into nameMapFileName in the
+    // style of the NAME_MAP of SPEF.
     void printNetlist(const std::vector<Module> &hierNetlist,
                       const uint32_t &totalUsedStdCells,
                       const uint32_t &totalUsedBlackBoxes,
                       std::string fileName = "HierNetlist.v",
-                      const uint32_t maxHierLevel = UINT32_MAX);
-    // Flatten Hierarchical netlist
+                      const std::vector<bool> &isPrinted = {},
+                      const std::string &nameMapFileName = "");
+    // Flatten Hierarchical netlist, flattenDepth < 0 means no limit and
+    // totalThreads = 0 means all hardware threads. If the name of
+    // (*reusedFlatMods)[modDefIndex] isn't empty, it is a flattened module of
+    // the last run, which is moved into flatNetlist instead of flattening the
+    // module again.
     void flattenHierNet(const std::vector<Module> &hierNetlist,
                         std::vector<Module> &flatNetlist,
-                        const uint32_t &totalUsedBlackBoxes);
+                        const uint32_t &totalUsedBlackBoxes,
+                        const bool &shouldCollapseAssigns = false,
+                        const int &flattenDepth = -1,
+                        const V3StringSet &keptModDefNames = {},
+                        const uint32_t &totalThreads = 1,
+                        std::vector<Module> *reusedFlatMods = nullptr);
+    // Whether an instance of subModDefIndex in modDefIndex is kept as a hard
+    // macro when flattening, see flattenHierNet.
+    static bool isHardMacro(const std::vector<Module> &hierNetlist,
+                            const uint32_t &totalUsedBlackBoxes,
+                            const int &flattenDepth,
+                            const V3StringSet &keptModDefNames,
+                            const uint32_t &modDefIndex,
+                            const uint32_t &subModDefIndex);
+    // Print the flattened netlist of _hierNetlist without keeping it in
+    // memory. Threads flatten parts of a top module into spill files in
+    // spillDirName, which are then copied to fileName in order, so the
+    // output is the same as flattenHierNet and printNetlist.
+    void printFlatNetOutOfCore(const std::string &spillDirName,
+                               const int &flattenDepth = -1,
+                               const V3StringSet &keptModDefNames = {},
+                               const uint32_t &totalThreads = 1,
+                               std::string fileName = "FlatNetlist.v");
+    // Reuse the flattened modules in cacheFileName whose sub trees aren't
+    // changed, flatten the others, and save the cache for the next run.
+    void flattenHierNetIncrementally(const std::string &cacheFileName);
+    // Replace every net set connected by assign statements with one net.
+    void collapseAssigns(std::vector<Module> &netlist,
+                         const uint32_t &modDefIndex);
+    // Propagate constants and remove dead logic of a flattened netlist.
+    void sweepFlatNet(std::vector<Module> &flatNetlist,
+                      const std::vector<UsedStdCell> &usedStdCells,
+                      std::string reportName = "SweepReport.txt");
+    // Find and merge structurally identical std cell instances of a
+    // flattened netlist, flip flops, latches and clock gates of usedStdCells
+    // only if shouldMergeRegs is true.
+    void strashFlatNet(std::vector<Module> &flatNetlist,
+                       const std::vector<UsedStdCell> &usedStdCells,
+                       const bool &shouldMerge,
+                       const bool &shouldMergeRegs = false,
+                       std::string reportName = "StrashReport.txt");
+    // Write cell usage and pin statistics of both netlists to
+    // fileName.json and fileName.csv.
+    void statNetlist(const std::vector<Module> &hierNetlist,
+                     const std::vector<Module> &flatNetlist,
+                     std::string fileName = "NetlistStats");
+    // Write the flattened modules as BLIF models whose std cells are .subckt
+    // of .blackbox models, for logic synthesis tools like ABC and yosys.
+    void writeBlif(const std::vector<Module> &flatNetlist,
+                   std::string fileName);
+    // Write the modules whose isWritten[modDefIndex] is true, or all modules
+    // if isWritten is empty, and all black boxes in the JSON layout of
+    // write_json of yosys.
+    void writeJson(const std::vector<Module> &netlist,
+                   const std::vector<bool> &isWritten, std::string fileName);
+    // Write the first flattened top module as a binary AIGER file, whose
+    // logic is built from the functions of std cells in usedStdCells.
+    void writeAiger(const std::vector<Module> &flatNetlist,
+                    const std::vector<UsedStdCell> &usedStdCells,
+                    std::string fileName);
+    // Write the first flattened top module as a hypergraph of instances and
+    // nets, into hgrFileName in the hMETIS format and into csrFileName in a
+    // binary format, see NetlistHypergraph.h. An empty name is skipped.
+    void writeHypergraph(const std::vector<Module> &flatNetlist,
+                         const std::vector<UsedStdCell> &usedStdCells,
+                         const std::string &hgrFileName,
+                         const std::string &csrFileName);
+    // Split the instances of the first flattened top module into totalBlocks
+    // balanced blocks with few cut nets, see partitionHypergraph, and write
+    // the block of every instance to reportName.
+    void partitionFlatNet(const std::vector<Module> &flatNetlist,
+                          const std::vector<UsedStdCell> &usedStdCells,
+                          const uint32_t &totalBlocks,
+                          const uint32_t &totalThreads = 1,
+                          std::string reportName = "PartitionReport.txt");
+    // Find the latest arrival at every endpoint of the flattened modules
+    // with the delays of std cells in usedStdCells, and write the totalPaths
+    // latest paths of every module to reportName.
+    void analyzeTiming(const std::vector<Module> &flatNetlist,
+                       const std::vector<UsedStdCell> &usedStdCells,
+                       const uint32_t &totalPaths,
+                       const uint32_t &totalThreads = 1,
+                       std::string reportName = "TimingReport.txt");
+    // Trace the clock and reset pins of sequential instances of the
+    // flattened modules back to their roots, and write clock domains, reset
+    // roots and the nodes of their trees to reportName.
+    void extractClockTrees(const std::vector<Module> &flatNetlist,
+                           const std::vector<UsedStdCell> &usedStdCells,
+                           std::string reportName = "ClockReport.txt");
+    // Follow the scan_in pins of scan flops of the flattened modules back to
+    // the flops before them, and write every scan chain in shift order to a
+    // file in dirName, with a summary in dirName/ScanChains.txt.
+    void traceScanChains(const std::vector<Module> &flatNetlist,
+                         const std::vector<UsedStdCell> &usedStdCells,
+                         const std::string &dirName,
+                         const uint32_t &totalThreads = 1);
+    // Extract the fanin cones of the instances or nets in faninNames and the
+    // fanout cones of the ones in fanoutNames from the flattened modules,
+    // which end at sequential cells or after coneDepth cells if it isn't 0,
+    // and print every cone as a module into fileName.
+    void extractCones(const std::vector<Module> &flatNetlist,
+                      const std::vector<UsedStdCell> &usedStdCells,
+                      const V3StringSet &faninNames,
+                      const V3StringSet &fanoutNames,
+                      const uint32_t &coneDepth = 0,
+                      std::string fileName = "ConeNetlist.v");
+    // Propagate the signal probability and the transition density of every
+    // net of the flattened modules from primary inputs and other sources,
+    // whose activities are given in activityFileName or are defaults, and
+    // write them with roll-ups of switched loads to the hierarchical
+    // instances and modules of hierNetlist into reportName. The hierarchical
+    // instances are found as flattenHierNet does with flattenDepth and
+    // keptModDefNames.
+    void estimateActivity(const std::vector<Module> &hierNetlist,
+                          const std::vector<Module> &flatNetlist,
+                          const std::vector<UsedStdCell> &usedStdCells,
+                          const int &flattenDepth = -1,
+                          const V3StringSet &keptModDefNames = {},
+                          const std::string &activityFileName = "",
+                          const uint32_t &totalThreads = 1,
+                          std::string reportName = "PowerReport.txt");
+    // Save both netlists into a binary file.
+    void saveNetlist(const std::string &fileName) const;
+    // Compare both netlists with the ones saved in savedFileName, the
+    // hierarchical netlist with the Verilog file hierFileName and the
+    // flattened netlist with the Verilog file flatFileName, and write the
+    // differences to reportName. An empty file name is skipped.
+    uint64_t diffNetlist(const std::string &savedFileName,
+                         const std::string &hierFileName,
+                         const std::string &flatFileName,
+                         std::string reportName = "NetlistDiff.txt") const;
     void sortInsOrderInTop();
     void parseHierNet(int argc, char **argv, char **env);
 };
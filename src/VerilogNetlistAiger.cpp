@@ -0,0 +1,512 @@
+/*************************************************************************
+  > File Name: VerilogNetlistAiger.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include "NetlistWriter.h"
+#include "VerilogNetlist.h"
+#include <unordered_map>
+
+namespace
+{
+
+const uint32_t aigFalse = 0;
+const uint32_t aigTrue = 1;
+
+// An and-inverter graph whose literal is 2 * variable + inverted, variable 0
+// is the constant false. Variables are numbered in creation order, and are
+// renumbered as inputs, latches and ands when written.
+class AigBuilder final
+{
+  private:
+    enum class VarKind : uint8_t
+    {
+      CONST,
+      INPUT,
+      LATCH,
+      AND
+    };
+    std::vector<VarKind> _varKinds = { VarKind::CONST };
+    // _andFanins[var] is valid if var is an and.
+    std::vector<std::pair<uint32_t, uint32_t>> _andFanins = { { 0, 0 } };
+    std::unordered_map<uint64_t, uint32_t> _strashTable;
+    std::vector<uint32_t> _inputVars;
+    std::vector<std::string> _inputNames;
+    std::vector<uint32_t> _latchVars;
+    std::vector<uint32_t> _latchNexts;
+    std::vector<std::string> _latchNames;
+    std::vector<uint32_t> _outputs;
+    std::vector<std::string> _outputNames;
+    uint32_t addVar(const VarKind &kind)
+    {
+      _varKinds.push_back(kind);
+      _andFanins.emplace_back(0, 0);
+      return _varKinds.size() - 1;
+    };
+
+  public:
+    uint32_t addInput(const std::string &name)
+    {
+      _inputVars.push_back(addVar(VarKind::INPUT));
+      _inputNames.push_back(name);
+      return _inputVars.back() * 2;
+    };
+    // The latch is the getTotalLatches()-th one before it is added, and its
+    // next state is given by setLatchNext later.
+    uint32_t addLatch(const std::string &name)
+    {
+      _latchVars.push_back(addVar(VarKind::LATCH));
+      _latchNexts.push_back(aigFalse);
+      _latchNames.push_back(name);
+      return _latchVars.back() * 2;
+    };
+    void setLatchNext(const uint32_t &latchIndex, const uint32_t &next)
+    {
+      _latchNexts[latchIndex] = next;
+    };
+    void addOutput(const uint32_t &literal, const std::string &name)
+    {
+      _outputs.push_back(literal);
+      _outputNames.push_back(name);
+    };
+    uint32_t getTotalInputs() const { return _inputVars.size(); };
+    uint32_t getTotalLatches() const { return _latchVars.size(); };
+    uint32_t getTotalAnds() const
+    {
+      return _varKinds.size() - 1 - _inputVars.size() - _latchVars.size();
+    };
+    // Constants are folded and structurally identical ands are shared.
+    uint32_t makeAnd(uint32_t a, uint32_t b)
+    {
+      if(a < b)
+        std::swap(a, b);
+      if(b == aigFalse || a == (b ^ 1))
+        return aigFalse;
+      if(b == aigTrue || a == b)
+        return a;
+      const uint64_t key = (uint64_t(a) << 32) | b;
+      const auto it = _strashTable.find(key);
+      if(it != _strashTable.end())
+        return it->second;
+      const uint32_t var = addVar(VarKind::AND);
+      _andFanins[var] = { a, b };
+      _strashTable.emplace(key, var * 2);
+      return var * 2;
+    };
+    uint32_t makeOr(const uint32_t &a, const uint32_t &b)
+    {
+      return makeAnd(a ^ 1, b ^ 1) ^ 1;
+    };
+    uint32_t makeXor(const uint32_t &a, const uint32_t &b)
+    {
+      return makeOr(makeAnd(a, b ^ 1), makeAnd(a ^ 1, b));
+    };
+    // select ? a : b
+    uint32_t makeMux(const uint32_t &select, const uint32_t &a,
+                     const uint32_t &b)
+    {
+      return makeOr(makeAnd(select, a), makeAnd(select ^ 1, b));
+    };
+    // Write the binary AIGER format, see http://fmv.jku.at/aiger.
+    void write(std::ostream &os, const std::string &comment) const;
+};
+
+void AigBuilder::write(std::ostream &os, const std::string &comment) const
+{
+  std::vector<uint32_t> newVars(_varKinds.size(), 0);
+  uint32_t totalVars = 0;
+  for(const auto &var: _inputVars)
+    newVars[var] = ++totalVars;
+  for(const auto &var: _latchVars)
+    newVars[var] = ++totalVars;
+  for(uint32_t var = 1; var < _varKinds.size(); var++)
+  {
+    if(_varKinds[var] == VarKind::AND)
+      newVars[var] = ++totalVars;
+  }
+  auto getNewLiteral = [&](const uint32_t &literal)
+  { return newVars[literal / 2] * 2 + (literal & 1); };
+
+  std::string buffer;
+  auto flushIfFull = [&]()
+  {
+    if(buffer.size() < NETLIST_WRITER_BUFFER_BYTES)
+      return;
+    os.write(buffer.data(), buffer.size());
+    buffer.clear();
+  };
+  buffer += "aig " + std::to_string(totalVars) + " " +
+            std::to_string(_inputVars.size()) + " " +
+            std::to_string(_latchVars.size()) + " " +
+            std::to_string(_outputs.size()) + " " +
+            std::to_string(getTotalAnds()) + "\n";
+  for(const auto &next: _latchNexts)
+    buffer += std::to_string(getNewLiteral(next)) + "\n";
+  for(const auto &output: _outputs)
+    buffer += std::to_string(getNewLiteral(output)) + "\n";
+  // lhs > rhs0 >= rhs1, both deltas are written as 7 bits per byte with the
+  // highest bit meaning more bytes.
+  auto writeDelta = [&buffer](uint32_t delta)
+  {
+    while(delta & ~0x7fu)
+    {
+      buffer += char((delta & 0x7f) | 0x80);
+      delta >>= 7;
+    }
+    buffer += char(delta);
+  };
+  for(uint32_t var = 1; var < _varKinds.size(); var++)
+  {
+    if(_varKinds[var] != VarKind::AND)
+      continue;
+    const uint32_t lhs = newVars[var] * 2;
+    uint32_t rhs0 = getNewLiteral(_andFanins[var].first);
+    uint32_t rhs1 = getNewLiteral(_andFanins[var].second);
+    if(rhs0 < rhs1)
+      std::swap(rhs0, rhs1);
+    writeDelta(lhs - rhs0);
+    writeDelta(rhs0 - rhs1);
+    flushIfFull();
+  }
+  for(uint32_t inputIndex = 0; inputIndex < _inputNames.size(); inputIndex++)
+  {
+    buffer += "i" + std::to_string(inputIndex) + " " +
+              _inputNames[inputIndex] + "\n";
+    flushIfFull();
+  }
+  for(uint32_t latchIndex = 0; latchIndex < _latchNames.size(); latchIndex++)
+  {
+    buffer += "l" + std::to_string(latchIndex) + " " +
+              _latchNames[latchIndex] + "\n";
+    flushIfFull();
+  }
+  for(uint32_t outputIndex = 0; outputIndex < _outputNames.size();
+      outputIndex++)
+  {
+    buffer += "o" + std::to_string(outputIndex) + " " +
+              _outputNames[outputIndex] + "\n";
+    flushIfFull();
+  }
+  buffer += "c\n" + comment;
+  os.write(buffer.data(), buffer.size());
+}
+
+} // namespace
+
+// The first flattened top module is written as an AIG:
+// 1. Inputs of the module, and inouts which aren't driven inside, are
+//    inputs. Outputs and inouts are outputs, and 1'bx and 1'bz are two more
+//    inputs.
+// 2. Outputs of combinational and tie cells are built from their functions
+//    in the std cell library.
+// 3. A flip flop is a latch of AIGER, whose next state is D, or the mux of
+//    SI and D selected by SE. Clocks, resets and sets are ignored, since
+//    AIGER latches have one implicit clock.
+// 4. Other instances, like latches, clock gates, macros and cells unknown to
+//    the library, are cut: their outputs are inputs named ins/pin, and their
+//    inputs are outputs named in the same way.
+// 5. Nets without a driver are inputs, and a combinational loop is cut by
+//    an input named net$loop whose driving function is an output.
+void VerilogNetlist::writeAiger(const std::vector<Module> &flatNetlist,
+                                const std::vector<UsedStdCell> &usedStdCells,
+                                std::string fileName)
+{
+  auto os = openNetlistOutput(fileName);
+  if(!*os)
+    throw std::runtime_error("Can't open " + fileName + ".");
+  if(flatNetlist.size() <= _totalUsedBlackBoxes)
+  {
+    AigBuilder().write(*os, "no flattened module\n");
+    return;
+  }
+  const uint32_t flatModDefIndex = _totalUsedBlackBoxes;
+  const auto &flatMod = flatNetlist[flatModDefIndex];
+  const uint32_t totalInss = flatMod.subModuleDefIndexs.size();
+  FlatNetlistIndex index(flatNetlist, flatModDefIndex);
+  NetUnionFind netUnionFind(index.getTotalNets());
+  netUnionFind.uniteAssigns(index, flatMod);
+  const uint32_t totalNets = index.getTotalNets();
+  AigBuilder aig;
+
+  auto getPinRootId = [&](const RefVar &refVar)
+  { return netUnionFind.find(index.getNetId(refVar)); };
+  auto getPinName = [&](const uint32_t &insIndex, const uint32_t &portDefIndex,
+                        const uint32_t &bitIndex)
+  {
+    const auto &port =
+      flatNetlist[flatMod.subModuleDefIndexs[insIndex]].ports[portDefIndex];
+    std::string pinName =
+      flatMod.subModuleInstanceNames[insIndex] + "/" + port.portDefName;
+    if(port.isVector)
+      pinName += "[" + std::to_string(bitIndex) + "]";
+    return pinName;
+  };
+  auto isBuiltFromFunctions = [&](const uint32_t &insIndex)
+  {
+    const auto &kind = usedStdCells[flatMod.subModuleDefIndexs[insIndex]].kind;
+    return kind == StdCellKind::COMBINATIONAL || kind == StdCellKind::TIE;
+  };
+
+  // rootLiterals[netRootId] is valid if isRootDone[netRootId], otherwise
+  // the net set is built from rootDrivers[netRootId] on demand.
+  const uint32_t noLiteral = UINT32_MAX;
+  std::vector<uint32_t> rootLiterals(totalNets, noLiteral);
+  std::vector<bool> isRootDone(totalNets, false);
+  std::vector<FlatPin> rootDrivers(totalNets, { UINT32_MAX, 0, 0 });
+  auto setRootLiteral = [&](const uint32_t &netRootId, const uint32_t &literal)
+  {
+    if(isRootDone[netRootId])
+      return;
+    rootLiterals[netRootId] = literal;
+    isRootDone[netRootId] = true;
+  };
+  setRootLiteral(netUnionFind.find(index.getConstNetId(CHAR_ZERO)),
+                 aigFalse);
+  setRootLiteral(netUnionFind.find(index.getConstNetId(CHAR_ONE)),
+                 aigTrue);
+  const uint32_t xLiteral = aig.addInput("1'bx");
+  setRootLiteral(netUnionFind.find(index.getConstNetId(CHAR_X)), xLiteral);
+  setRootLiteral(netUnionFind.find(index.getConstNetId(CHAR_Z)),
+                 aig.addInput("1'bz"));
+  std::vector<uint32_t> outputNetIds;
+  for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts();
+      netId++)
+  {
+    if(!index.isPortNet(netId))
+      break;
+    const auto &portType =
+      flatMod.ports[index.getRefVar(netId).refVarDefIndex].portType;
+    if(portType == PortType::INPUT &&
+       !isRootDone[netUnionFind.find(netId)])
+      setRootLiteral(netUnionFind.find(netId),
+                     aig.addInput(index.getNetName(netId)));
+    if(portType != PortType::INPUT)
+      outputNetIds.push_back(netId);
+  }
+
+  // Latches, cut outputs and drivers of the other net sets
+  struct Flop
+  {
+      uint32_t insIndex;
+      uint32_t latchIndex;
+  };
+  std::vector<Flop> flops;
+  std::vector<uint32_t> cutInss;
+  for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+  {
+    const auto &usedStdCell =
+      usedStdCells[flatMod.subModuleDefIndexs[insIndex]];
+    const auto &stdCell = flatNetlist[flatMod.subModuleDefIndexs[insIndex]];
+    const auto &portAssignments = flatMod.portAssignmentsOfSubModInss[insIndex];
+    const bool isFlop = usedStdCell.kind == StdCellKind::FLIP_FLOP;
+    if(!isFlop && !isBuiltFromFunctions(insIndex))
+      cutInss.push_back(insIndex);
+    uint32_t latchLiteral = noLiteral;
+    for(uint32_t portDefIndex = stdCell.totalInputs;
+        portDefIndex < stdCell.totalPortsExcludingWires; portDefIndex++)
+    {
+      const auto &refVars = portAssignments[portDefIndex].refVars;
+      const auto &pinRole = usedStdCell.pinRoles[portDefIndex];
+      for(uint32_t bitIndex = 0; bitIndex < refVars.size(); bitIndex++)
+      {
+        const uint32_t netRootId = getPinRootId(refVars[bitIndex]);
+        if(isRootDone[netRootId] ||
+           rootDrivers[netRootId].insIndex != UINT32_MAX)
+          continue;
+        if(isFlop && (pinRole == PinRole::Q || pinRole == PinRole::QN))
+        {
+          if(latchLiteral == noLiteral)
+          {
+            flops.push_back({ insIndex, aig.getTotalLatches() });
+            latchLiteral =
+              aig.addLatch(flatMod.subModuleInstanceNames[insIndex]);
+          }
+          setRootLiteral(netRootId, pinRole == PinRole::Q ? latchLiteral
+                                                          : latchLiteral ^ 1);
+        }
+        else if(isBuiltFromFunctions(insIndex) &&
+                !usedStdCell.functions[portDefIndex].empty())
+          rootDrivers[netRootId] = { insIndex, portDefIndex, bitIndex };
+        else
+          setRootLiteral(netRootId, aig.addInput(getPinName(
+                                      insIndex, portDefIndex, bitIndex)));
+      }
+    }
+  }
+
+  // An inout is an input unless it is driven inside.
+  for(const auto &netId: outputNetIds)
+  {
+    const uint32_t netRootId = netUnionFind.find(netId);
+    if(flatMod.ports[index.getRefVar(netId).refVarDefIndex].portType ==
+         PortType::INOUT &&
+       !isRootDone[netRootId] && rootDrivers[netRootId].insIndex == UINT32_MAX)
+      setRootLiteral(netRootId, aig.addInput(index.getNetName(netId)));
+  }
+
+  // Build net sets by depth first search without recursion. A net set on
+  // the stack which is reached again is a combinational loop.
+  std::vector<bool> isOnStack(totalNets, false);
+  std::vector<uint32_t> loopLiterals(totalNets, noLiteral);
+  std::vector<uint32_t> loopRootIds;
+  std::vector<uint32_t> stack;
+  std::vector<uint32_t> operands;
+  // The net set of an input pin, UINT32_MAX if it is unconnected.
+  auto getInputRootId = [&](const uint32_t &insIndex,
+                            const uint32_t &portDefIndex)
+  {
+    const auto &refVars =
+      flatMod.portAssignmentsOfSubModInss[insIndex][portDefIndex].refVars;
+    return refVars.empty() ? UINT32_MAX : getPinRootId(refVars[0]);
+  };
+  auto buildRoot = [&](const uint32_t &startRootId)
+  {
+    if(startRootId == UINT32_MAX)
+      return xLiteral;
+    stack.push_back(startRootId);
+    while(!stack.empty())
+    {
+      const uint32_t netRootId = stack.back();
+      if(isRootDone[netRootId])
+      {
+        stack.pop_back();
+        continue;
+      }
+      const FlatPin &driver = rootDrivers[netRootId];
+      if(driver.insIndex == UINT32_MAX)
+      {
+        setRootLiteral(netRootId, aig.addInput(index.getNetName(netRootId)));
+        stack.pop_back();
+        continue;
+      }
+      const auto &function = usedStdCells[flatMod.subModuleDefIndexs
+                                            [driver.insIndex]]
+                               .functions[driver.portDefIndex];
+      isOnStack[netRootId] = true;
+      bool hasPushed = false;
+      for(const auto &token: function.getTokens())
+      {
+        if(token.op != CellFunction::Op::INPUT)
+          continue;
+        const uint32_t inputRootId =
+          getInputRootId(driver.insIndex, token.portDefIndex);
+        if(inputRootId != UINT32_MAX && !isRootDone[inputRootId] &&
+           !isOnStack[inputRootId])
+        {
+          stack.push_back(inputRootId);
+          hasPushed = true;
+          break;
+        }
+      }
+      if(hasPushed)
+        continue;
+      operands.clear();
+      for(const auto &token: function.getTokens())
+      {
+        switch(token.op)
+        {
+        case CellFunction::Op::INPUT:
+        {
+          const uint32_t inputRootId =
+            getInputRootId(driver.insIndex, token.portDefIndex);
+          if(inputRootId == UINT32_MAX)
+            operands.push_back(xLiteral);
+          else if(isRootDone[inputRootId])
+            operands.push_back(rootLiterals[inputRootId]);
+          else
+          {
+            if(loopLiterals[inputRootId] == noLiteral)
+            {
+              loopLiterals[inputRootId] =
+                aig.addInput(index.getNetName(inputRootId) + "$loop");
+              loopRootIds.push_back(inputRootId);
+            }
+            operands.push_back(loopLiterals[inputRootId]);
+          }
+          break;
+        }
+        case CellFunction::Op::CONST0:
+          operands.push_back(aigFalse);
+          break;
+        case CellFunction::Op::CONST1:
+          operands.push_back(aigTrue);
+          break;
+        case CellFunction::Op::NOT:
+          operands.back() ^= 1;
+          break;
+        default:
+        {
+          const uint32_t b = operands.back();
+          operands.pop_back();
+          uint32_t &a = operands.back();
+          if(token.op == CellFunction::Op::AND)
+            a = aig.makeAnd(a, b);
+          else if(token.op == CellFunction::Op::OR)
+            a = aig.makeOr(a, b);
+          else
+            a = aig.makeXor(a, b);
+        }
+        }
+      }
+      setRootLiteral(netRootId, operands.back());
+      isOnStack[netRootId] = false;
+      stack.pop_back();
+    }
+    return rootLiterals[startRootId];
+  };
+
+  for(const auto &netId: outputNetIds)
+    aig.addOutput(buildRoot(netUnionFind.find(netId)),
+                  index.getNetName(netId));
+  for(const auto &flop: flops)
+  {
+    const auto &usedStdCell =
+      usedStdCells[flatMod.subModuleDefIndexs[flop.insIndex]];
+    uint32_t dataRootId = UINT32_MAX;
+    uint32_t scanInRootId = UINT32_MAX;
+    uint32_t scanEnableRootId = UINT32_MAX;
+    for(uint32_t portDefIndex = 0; portDefIndex < usedStdCell.pinRoles.size();
+        portDefIndex++)
+    {
+      const auto &pinRole = usedStdCell.pinRoles[portDefIndex];
+      if(pinRole == PinRole::DATA)
+        dataRootId = getInputRootId(flop.insIndex, portDefIndex);
+      else if(pinRole == PinRole::SCAN_IN)
+        scanInRootId = getInputRootId(flop.insIndex, portDefIndex);
+      else if(pinRole == PinRole::SCAN_ENABLE)
+        scanEnableRootId = getInputRootId(flop.insIndex, portDefIndex);
+    }
+    uint32_t next = buildRoot(dataRootId);
+    if(scanEnableRootId != UINT32_MAX)
+    {
+      const uint32_t scanEnable = buildRoot(scanEnableRootId);
+      next = aig.makeMux(scanEnable, buildRoot(scanInRootId), next);
+    }
+    aig.setLatchNext(flop.latchIndex, next);
+  }
+  for(const auto &insIndex: cutInss)
+  {
+    const auto &stdCell = flatNetlist[flatMod.subModuleDefIndexs[insIndex]];
+    const auto &portAssignments = flatMod.portAssignmentsOfSubModInss[insIndex];
+    for(uint32_t portDefIndex = 0; portDefIndex < stdCell.totalInputsAndInouts;
+        portDefIndex++)
+    {
+      const auto &refVars = portAssignments[portDefIndex].refVars;
+      for(uint32_t bitIndex = 0; bitIndex < refVars.size(); bitIndex++)
+        aig.addOutput(buildRoot(getPinRootId(refVars[bitIndex])),
+                      getPinName(insIndex, portDefIndex, bitIndex));
+    }
+  }
+  // A loop found here adds another one to loopRootIds.
+  for(uint32_t loopIndex = 0; loopIndex < loopRootIds.size(); loopIndex++)
+    aig.addOutput(buildRoot(loopRootIds[loopIndex]),
+                  index.getNetName(loopRootIds[loopIndex]) + "$loop");
+
+  aig.write(*os, "module " + flatMod.moduleDefName + ", " +
+                      std::to_string(flops.size()) + " flip flops, " +
+                      std::to_string(cutInss.size()) + " cut instances, " +
+                      std::to_string(loopRootIds.size()) + " loops\n");
+}
@@ -0,0 +1,167 @@
+/*************************************************************************
+  > File Name: VerilogNetlistBlif.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include "NetlistWriter.h"
+#include "VerilogNetlist.h"
+#include <cstring>
+
+namespace
+{
+
+// 1'b0, 1'b1, 1'bx and 1'bz are driven by .names of these nets, x and z are
+// regarded as 0.
+const char *constNetNames[4] = { "$false", "$true", "$undef", "$undef" };
+
+// A formal name of a .subckt or a name in .inputs of a model, e.g. A or D[3]
+std::string getPinName(const PortDefinition &port, const uint32_t &bitIndex)
+{
+  if(port.isVector)
+    return port.portDefName + "[" + std::to_string(bitIndex) + "]";
+  return port.portDefName;
+}
+
+class BlifWriter final
+{
+  private:
+    std::ostream &_os;
+    std::string _buffer;
+    uint32_t _totalCharsEveryLine = 0;
+
+  public:
+    explicit BlifWriter(std::ostream &os) : _os(os){};
+    ~BlifWriter() { flush(); };
+    void flush()
+    {
+      _os.write(_buffer.data(), _buffer.size());
+      _buffer.clear();
+    };
+    // A line longer than 80 chars is continued by " \" at its end.
+    void writeWord(const std::string &word)
+    {
+      if(_totalCharsEveryLine + word.size() + 3 > 80)
+      {
+        _buffer += " \\\n ";
+        _totalCharsEveryLine = 1;
+      }
+      _buffer += ' ';
+      _buffer += word;
+      _totalCharsEveryLine += word.size() + 1;
+    };
+    void writeLineBegin(const char *keyword)
+    {
+      _buffer += keyword;
+      _totalCharsEveryLine = strlen(keyword);
+    };
+    void writeLineEnd()
+    {
+      _buffer += '\n';
+      if(_buffer.size() >= NETLIST_WRITER_BUFFER_BYTES)
+        flush();
+    };
+    void writeLine(const std::string &line)
+    {
+      _buffer += line;
+      writeLineEnd();
+    };
+};
+
+} // namespace
+
+// Black boxes are .blackbox models, inouts are regarded as inputs since
+// BLIF has no inout. Every flattened module is a model whose instances are
+// .subckt of black boxes or hard macros, and an assign statement is a buffer
+// written by .names.
+void VerilogNetlist::writeBlif(const std::vector<Module> &flatNetlist,
+                               std::string fileName)
+{
+  auto os = openNetlistOutput(fileName);
+  if(!*os)
+    throw std::runtime_error("Can't open " + fileName + ".");
+  BlifWriter writer(*os);
+  auto writeModelBegin = [&](const Module &oneMod)
+  {
+    writer.writeLine(".model " + oneMod.moduleDefName);
+    writer.writeLineBegin(".inputs");
+    for(uint32_t portDefIndex = 0; portDefIndex < oneMod.totalInputsAndInouts;
+        portDefIndex++)
+    {
+      const auto &port = oneMod.ports[portDefIndex];
+      for(uint32_t bitIndex = 0; bitIndex < port.bitWidth; bitIndex++)
+        writer.writeWord(getPinName(port, bitIndex));
+    }
+    writer.writeLineEnd();
+    writer.writeLineBegin(".outputs");
+    for(uint32_t portDefIndex = oneMod.totalInputsAndInouts;
+        portDefIndex < oneMod.totalPortsExcludingWires; portDefIndex++)
+    {
+      const auto &port = oneMod.ports[portDefIndex];
+      for(uint32_t bitIndex = 0; bitIndex < port.bitWidth; bitIndex++)
+        writer.writeWord(getPinName(port, bitIndex));
+    }
+    writer.writeLineEnd();
+  };
+
+  for(uint32_t flatModDefIndex = _totalUsedBlackBoxes;
+      flatModDefIndex < flatNetlist.size(); flatModDefIndex++)
+  {
+    if(!isInFlatNet(flatModDefIndex))
+      continue;
+    const auto &flatMod = flatNetlist[flatModDefIndex];
+    FlatNetlistIndex index(flatNetlist, flatModDefIndex);
+    auto getNetName = [&](const RefVar &refVar)
+    {
+      const uint32_t netId = index.getNetId(refVar);
+      if(index.isConstNet(netId))
+        return std::string(
+          constNetNames[netId - index.getTotalNetsExcludingConsts()]);
+      return index.getNetName(netId);
+    };
+    writeModelBegin(flatMod);
+    writer.writeLine(".names $false");
+    writer.writeLine(".names $true");
+    writer.writeLine("1");
+    writer.writeLine(".names $undef");
+    for(const auto &oneAssign: flatMod.assigns)
+    {
+      writer.writeLine(".names " + getNetName(oneAssign.rValue) + " " +
+                       getNetName(oneAssign.lValue));
+      writer.writeLine("1 1");
+    }
+    // Unconnected pins are left out.
+    for(uint32_t insIndex = 0; insIndex < flatMod.subModuleDefIndexs.size();
+        insIndex++)
+    {
+      const auto &subMod = flatNetlist[flatMod.subModuleDefIndexs[insIndex]];
+      const auto &portAssignments =
+        flatMod.portAssignmentsOfSubModInss[insIndex];
+      writer.writeLineBegin(".subckt");
+      writer.writeWord(subMod.moduleDefName);
+      for(uint32_t portDefIndex = 0; portDefIndex < portAssignments.size();
+          portDefIndex++)
+      {
+        const auto &refVars = portAssignments[portDefIndex].refVars;
+        for(uint32_t bitIndex = 0; bitIndex < refVars.size(); bitIndex++)
+          writer.writeWord(getPinName(subMod.ports[portDefIndex], bitIndex) +
+                           "=" + getNetName(refVars[bitIndex]));
+      }
+      writer.writeLineEnd();
+    }
+    writer.writeLine(".end");
+    writer.writeLine("");
+  }
+
+  for(uint32_t modDefIndex = 0; modDefIndex < _totalUsedBlackBoxes;
+      modDefIndex++)
+  {
+    writeModelBegin(flatNetlist[modDefIndex]);
+    writer.writeLine(".blackbox");
+    writer.writeLine(".end");
+    writer.writeLine("");
+  }
+  writer.flush();
+}
@@ -0,0 +1,406 @@
+/*************************************************************************
+  > File Name: VerilogNetlistClockTree.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include "VerilogNetlist.h"
+#include <fstream>
+
+namespace
+{
+
+// A net set which is driven by more than one pin is the root of a tree.
+const uint8_t manyDrivers = 2;
+
+// Trees of net sets which are traced backward from clock or reset pins. A
+// net set driven by a buffer or an inverter, or by the clock_out pin of a
+// clock gate or a clock pad if throughClockCells is true, is a node whose
+// parent is the input of this cell; other net sets are roots. Every net set
+// is traced once, so tracing all pins is linear.
+class NetTrees final
+{
+  private:
+    const Module &_flatMod;
+    const std::vector<Module> &_flatNetlist;
+    const std::vector<UsedStdCell> &_usedStdCells;
+    const FlatNetlistIndex &_index;
+    NetUnionFind &_netUnionFind;
+    const std::vector<FlatPin> &_rootDriverPins;
+    const std::vector<uint8_t> &_rootTotalDrivers;
+    const bool _throughClockCells;
+    // 0 for unknown, 1 while it is traced and 2 for done
+    std::vector<uint8_t> _states;
+    std::vector<uint32_t> _parents;
+    std::vector<bool> _isInvertedToParents;
+
+  public:
+    std::vector<uint32_t> treeRoots;
+    std::vector<bool> isInvertedToRoots;
+    std::vector<uint32_t> depths;
+    // Traced net sets, a parent is always before its children.
+    std::vector<uint32_t> nodes;
+
+  private:
+    // The net set of the input which passes through the driver of
+    // netRootId, or UINT32_MAX if netRootId is a root.
+    uint32_t findParent(const uint32_t &netRootId, bool &isInverted) const;
+
+  public:
+    NetTrees(const Module &flatMod, const std::vector<Module> &flatNetlist,
+             const std::vector<UsedStdCell> &usedStdCells,
+             const FlatNetlistIndex &index, NetUnionFind &netUnionFind,
+             const std::vector<FlatPin> &rootDriverPins,
+             const std::vector<uint8_t> &rootTotalDrivers,
+             const bool &throughClockCells)
+      : _flatMod(flatMod), _flatNetlist(flatNetlist),
+        _usedStdCells(usedStdCells), _index(index),
+        _netUnionFind(netUnionFind), _rootDriverPins(rootDriverPins),
+        _rootTotalDrivers(rootTotalDrivers),
+        _throughClockCells(throughClockCells),
+        _states(index.getTotalNets(), 0),
+        _parents(index.getTotalNets(), UINT32_MAX),
+        _isInvertedToParents(index.getTotalNets(), false),
+        treeRoots(index.getTotalNets(), UINT32_MAX),
+        isInvertedToRoots(index.getTotalNets(), false),
+        depths(index.getTotalNets(), 0)
+    {
+    }
+    const uint32_t &getParent(const uint32_t &netRootId) const
+    {
+      return _parents[netRootId];
+    };
+    void trace(uint32_t netRootId);
+};
+
+uint32_t NetTrees::findParent(const uint32_t &netRootId,
+                              bool &isInverted) const
+{
+  isInverted = false;
+  const FlatPin &driverPin = _rootDriverPins[netRootId];
+  if(_index.isConstNet(netRootId) || _rootTotalDrivers[netRootId] != 1 ||
+     driverPin.insIndex == UINT32_MAX)
+    return UINT32_MAX;
+  const uint32_t subModDefIndex =
+    _flatMod.subModuleDefIndexs[driverPin.insIndex];
+  const auto &usedStdCell = _usedStdCells[subModDefIndex];
+  const auto &portAssignments =
+    _flatMod.portAssignmentsOfSubModInss[driverPin.insIndex];
+  uint32_t inputPortDefIndex = UINT32_MAX;
+  if(usedStdCell.kind == StdCellKind::COMBINATIONAL ||
+     usedStdCell.kind == StdCellKind::POWER)
+  {
+    // A buffer is Z=A and an inverter is ZN=!A.
+    const auto &tokens =
+      usedStdCell.functions[driverPin.portDefIndex].getTokens();
+    if(tokens.empty() || tokens.size() > 2 ||
+       tokens[0].op != CellFunction::Op::INPUT ||
+       (tokens.size() == 2 && tokens[1].op != CellFunction::Op::NOT))
+      return UINT32_MAX;
+    inputPortDefIndex = tokens[0].portDefIndex;
+    isInverted = tokens.size() == 2;
+  }
+  else if(_throughClockCells &&
+          (usedStdCell.kind == StdCellKind::CLOCK_GATE ||
+           usedStdCell.kind == StdCellKind::PAD) &&
+          usedStdCell.pinRoles[driverPin.portDefIndex] == PinRole::CLOCK_OUT)
+  {
+    const auto &stdCell = _flatNetlist[subModDefIndex];
+    for(uint32_t portDefIndex = 0;
+        portDefIndex < stdCell.totalInputsAndInouts; portDefIndex++)
+    {
+      if(usedStdCell.pinRoles[portDefIndex] == PinRole::CLOCK)
+        inputPortDefIndex = portDefIndex;
+    }
+  }
+  if(inputPortDefIndex == UINT32_MAX ||
+     portAssignments[inputPortDefIndex].refVars.empty())
+    return UINT32_MAX;
+  // Cells driving one bit from one bit, a bus of buffers keeps the bit.
+  const auto &refVars = portAssignments[inputPortDefIndex].refVars;
+  const RefVar &refVar =
+    refVars[driverPin.bitIndex < refVars.size() ? driverPin.bitIndex : 0];
+  return _netUnionFind.find(_index.getNetId(refVar));
+}
+
+// Go up until a traced net set or a root, a net set which is being traced
+// closes a loop of buffers and becomes a root. Then go down again.
+void NetTrees::trace(uint32_t netRootId)
+{
+  std::vector<uint32_t> path;
+  while(_states[netRootId] == 0)
+  {
+    _states[netRootId] = 1;
+    bool isInverted;
+    const uint32_t parentRootId = findParent(netRootId, isInverted);
+    if(parentRootId == UINT32_MAX || _states[parentRootId] == 1)
+    {
+      _states[netRootId] = 2;
+      treeRoots[netRootId] = netRootId;
+      nodes.push_back(netRootId);
+      break;
+    }
+    path.push_back(netRootId);
+    _parents[netRootId] = parentRootId;
+    _isInvertedToParents[netRootId] = isInverted;
+    netRootId = parentRootId;
+  }
+  while(!path.empty())
+  {
+    const uint32_t childRootId = path.back();
+    const uint32_t parentRootId = _parents[childRootId];
+    path.pop_back();
+    _states[childRootId] = 2;
+    treeRoots[childRootId] = treeRoots[parentRootId];
+    isInvertedToRoots[childRootId] =
+      isInvertedToRoots[parentRootId] != _isInvertedToParents[childRootId];
+    depths[childRootId] = depths[parentRootId] + 1;
+    nodes.push_back(childRootId);
+  }
+}
+
+} // namespace
+
+// Clock pins and reset pins of flip flops, latches and macros are sinks,
+// which are named by the library, see StdCellLibrary.h. Clock trees pass
+// buffers, inverters, clock gates and clock pads, reset trees only pass
+// buffers and inverters. A clock domain is a root with the edge of the root
+// seen by its sinks.
+void VerilogNetlist::extractClockTrees(
+  const std::vector<Module> &flatNetlist,
+  const std::vector<UsedStdCell> &usedStdCells, std::string reportName)
+{
+  std::ofstream ofs(reportName);
+  for(uint32_t flatModDefIndex = _totalUsedBlackBoxes;
+      flatModDefIndex < flatNetlist.size(); flatModDefIndex++)
+  {
+    if(!isInFlatNet(flatModDefIndex))
+      continue;
+    const auto &flatMod = flatNetlist[flatModDefIndex];
+    const uint32_t totalInss = flatMod.subModuleDefIndexs.size();
+    FlatNetlistIndex index(flatNetlist, flatModDefIndex);
+    NetUnionFind netUnionFind(index.getTotalNets());
+    netUnionFind.uniteAssigns(index, flatMod);
+    const uint32_t totalNets = index.getTotalNets();
+
+    // Call onePin(portDefIndex, bitIndex, netRootId) for every connected pin
+    // of an instance whose portDefIndex is in [beginPort, endPort).
+    auto forEachPin = [&](const uint32_t &insIndex, const uint32_t &beginPort,
+                          const uint32_t &endPort, auto &&onePin)
+    {
+      const auto &portAssignments =
+        flatMod.portAssignmentsOfSubModInss[insIndex];
+      for(uint32_t portDefIndex = beginPort; portDefIndex < endPort;
+          portDefIndex++)
+      {
+        const auto &refVars = portAssignments[portDefIndex].refVars;
+        for(uint32_t bitIndex = 0; bitIndex < refVars.size(); bitIndex++)
+          onePin(portDefIndex, bitIndex,
+                 netUnionFind.find(index.getNetId(refVars[bitIndex])));
+      }
+    };
+
+    // The only driver of every net set, primary inputs are drivers, too.
+    std::vector<FlatPin> rootDriverPins(totalNets,
+                                        { UINT32_MAX, UINT32_MAX, 0 });
+    std::vector<uint8_t> rootTotalDrivers(totalNets, 0);
+    std::vector<uint32_t> rootTotalLoads(totalNets, 0);
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      const auto &stdCell = flatNetlist[flatMod.subModuleDefIndexs[insIndex]];
+      forEachPin(insIndex, stdCell.totalInputs,
+                 stdCell.totalPortsExcludingWires,
+                 [&](uint32_t portDefIndex, uint32_t bitIndex,
+                     uint32_t netRootId)
+                 {
+                   if(rootTotalDrivers[netRootId]++)
+                     rootTotalDrivers[netRootId] = manyDrivers;
+                   rootDriverPins[netRootId] = { insIndex, portDefIndex,
+                                                 bitIndex };
+                 });
+      forEachPin(insIndex, 0, stdCell.totalInputsAndInouts,
+                 [&](uint32_t, uint32_t, uint32_t netRootId)
+                 { rootTotalLoads[netRootId]++; });
+    }
+    for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts();
+        netId++)
+    {
+      if(index.getRefVar(netId).refVarDefIndex >= flatMod.totalInputsAndInouts)
+        continue;
+      const uint32_t netRootId = netUnionFind.find(netId);
+      if(rootTotalDrivers[netRootId]++)
+        rootTotalDrivers[netRootId] = manyDrivers;
+      rootDriverPins[netRootId].insIndex = UINT32_MAX;
+    }
+
+    // Trace every sink. Sinks of a domain or a reset root are counted by the
+    // edge or the active level seen at the root, 0 for rising edges and
+    // active high. Instances with sinks are sequential.
+    NetTrees clockTrees(flatMod, flatNetlist, usedStdCells, index,
+                        netUnionFind, rootDriverPins, rootTotalDrivers, true);
+    NetTrees resetTrees(flatMod, flatNetlist, usedStdCells, index,
+                        netUnionFind, rootDriverPins, rootTotalDrivers, false);
+    std::vector<uint32_t> clockSinks(totalNets, 0);
+    std::vector<uint32_t> resetSinks(totalNets, 0);
+    // domainIndexs[2 * treeRootId + edge]
+    std::vector<uint32_t> domainIndexs(2 * totalNets, UINT32_MAX);
+    std::vector<uint32_t> domainRoots;
+    std::vector<uint32_t> domainTotalSinks;
+    std::vector<uint32_t> resetRoots;
+    std::vector<uint32_t> resetTotalSinks(2 * totalNets, 0);
+    // insDomainIndexs[insIndex] is the domain of its first clock pin.
+    std::vector<uint32_t> insDomainIndexs(totalInss, UINT32_MAX);
+    uint32_t totalSeqInss = 0;
+    uint32_t totalClockPins = 0;
+    uint32_t totalResetPins = 0;
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      const uint32_t subModDefIndex = flatMod.subModuleDefIndexs[insIndex];
+      const auto &usedStdCell = usedStdCells[subModDefIndex];
+      if(usedStdCell.kind != StdCellKind::FLIP_FLOP &&
+         usedStdCell.kind != StdCellKind::LATCH &&
+         usedStdCell.kind != StdCellKind::MACRO)
+        continue;
+      const auto &pinRoles = usedStdCell.pinRoles;
+      bool isSequential = false;
+      forEachPin(
+        insIndex, 0, flatNetlist[subModDefIndex].totalInputsAndInouts,
+        [&](uint32_t portDefIndex, uint32_t, uint32_t netRootId)
+        {
+          const PinRole &role = pinRoles[portDefIndex];
+          if(role == PinRole::CLOCK || role == PinRole::CLOCK_N)
+          {
+            isSequential = true;
+            clockTrees.trace(netRootId);
+            clockSinks[netRootId]++;
+            totalClockPins++;
+            const uint32_t treeRootId = clockTrees.treeRoots[netRootId];
+            const uint32_t edge = (role == PinRole::CLOCK_N) !=
+                                  clockTrees.isInvertedToRoots[netRootId];
+            uint32_t &domainIndex = domainIndexs[2 * treeRootId + edge];
+            if(domainIndex == UINT32_MAX)
+            {
+              domainIndex = domainRoots.size();
+              domainRoots.push_back(2 * treeRootId + edge);
+              domainTotalSinks.push_back(0);
+            }
+            domainTotalSinks[domainIndex]++;
+            if(insDomainIndexs[insIndex] == UINT32_MAX)
+              insDomainIndexs[insIndex] = domainIndex;
+          }
+          else if(role == PinRole::RESET || role == PinRole::RESET_N ||
+                  role == PinRole::SET || role == PinRole::SET_N)
+          {
+            isSequential = true;
+            resetTrees.trace(netRootId);
+            resetSinks[netRootId]++;
+            totalResetPins++;
+            const uint32_t treeRootId = resetTrees.treeRoots[netRootId];
+            const uint32_t level =
+              (role == PinRole::RESET_N || role == PinRole::SET_N) !=
+              resetTrees.isInvertedToRoots[netRootId];
+            if(!resetTotalSinks[2 * treeRootId] &&
+               !resetTotalSinks[2 * treeRootId + 1])
+              resetRoots.push_back(treeRootId);
+            resetTotalSinks[2 * treeRootId + level]++;
+          }
+        });
+      totalSeqInss += isSequential;
+    }
+    // Children are after their parents, so sinks are added up backward.
+    for(auto *trees: { &clockTrees, &resetTrees })
+    {
+      auto &sinks = trees == &clockTrees ? clockSinks : resetSinks;
+      for(auto node = trees->nodes.rbegin(); node != trees->nodes.rend();
+          node++)
+      {
+        if(trees->getParent(*node) != UINT32_MAX)
+          sinks[trees->getParent(*node)] += sinks[*node];
+      }
+    }
+
+    // A net set is written as its name and its driver, which is an
+    // instance/pin and its std cell, "input", "undriven", "constant" or
+    // "multiple_drivers".
+    auto writeNet = [&](const uint32_t &netRootId)
+    {
+      ofs << index.getNetName(netRootId) << " ";
+      const FlatPin &driverPin = rootDriverPins[netRootId];
+      if(index.isConstNet(netRootId))
+        ofs << "constant";
+      else if(rootTotalDrivers[netRootId] == 0)
+        ofs << "undriven";
+      else if(rootTotalDrivers[netRootId] == manyDrivers)
+        ofs << "multiple_drivers";
+      else if(driverPin.insIndex == UINT32_MAX)
+        ofs << "input";
+      else
+      {
+        const auto &stdCell =
+          flatNetlist[flatMod.subModuleDefIndexs[driverPin.insIndex]];
+        const auto &port = stdCell.ports[driverPin.portDefIndex];
+        ofs << flatMod.subModuleInstanceNames[driverPin.insIndex] << "/"
+            << port.portDefName;
+        if(port.isVector)
+          ofs << "[" << driverPin.bitIndex << "]";
+        ofs << " " << stdCell.moduleDefName;
+      }
+    };
+    auto writeTreeNodes = [&](const NetTrees &trees,
+                              const std::vector<uint32_t> &sinks)
+    {
+      for(const auto &netRootId: trees.nodes)
+      {
+        writeNet(netRootId);
+        ofs << " " << index.getNetName(trees.treeRoots[netRootId]) << " "
+            << trees.depths[netRootId] << " "
+            << (trees.isInvertedToRoots[netRootId] ? "inverted" : "same")
+            << " " << rootTotalLoads[netRootId] << " " << sinks[netRootId]
+            << std::endl;
+      }
+    };
+
+    ofs << "// Clock and reset trees of module " << flatMod.moduleDefName
+        << std::endl;
+    ofs << "// Sequential instances: " << totalSeqInss
+        << ", clock pins: " << totalClockPins
+        << ", clock domains: " << domainRoots.size()
+        << ", reset pins: " << totalResetPins
+        << ", reset roots: " << resetRoots.size() << std::endl;
+    ofs << "// Clock domain, root, driver, edge, sinks" << std::endl;
+    for(uint32_t domainIndex = 0; domainIndex < domainRoots.size();
+        domainIndex++)
+    {
+      ofs << domainIndex << " ";
+      writeNet(domainRoots[domainIndex] / 2);
+      ofs << " " << (domainRoots[domainIndex] % 2 ? "falling" : "rising")
+          << " " << domainTotalSinks[domainIndex] << std::endl;
+    }
+    ofs << "// Reset root, driver, active high sinks, active low sinks"
+        << std::endl;
+    for(const auto &treeRootId: resetRoots)
+    {
+      writeNet(treeRootId);
+      ofs << " " << resetTotalSinks[2 * treeRootId] << " "
+          << resetTotalSinks[2 * treeRootId + 1] << std::endl;
+    }
+    ofs << "// Clock tree net, driver, root, depth, polarity to root, fanout, "
+           "sinks"
+        << std::endl;
+    writeTreeNodes(clockTrees, clockSinks);
+    ofs << "// Reset tree net, driver, root, depth, polarity to root, fanout, "
+           "sinks"
+        << std::endl;
+    writeTreeNodes(resetTrees, resetSinks);
+    ofs << "// Sequential instance, clock domain" << std::endl;
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      if(insDomainIndexs[insIndex] != UINT32_MAX)
+        ofs << flatMod.subModuleInstanceNames[insIndex] << " "
+            << insDomainIndexs[insIndex] << std::endl;
+    }
+    ofs << std::endl;
+  }
+}
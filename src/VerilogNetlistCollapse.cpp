@@ -0,0 +1,106 @@
+/*************************************************************************
+  > File Name: VerilogNetlistCollapse.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include "VerilogNetlist.h"
+
+// Use case2 as a example, full_adder has
+//   assign co = n_0;  INV_X1_LVT i_0_0 (.A(a), .ZN(n_0));
+// Every net set connected by assign statements is replaced by one canonical
+// net, so it becomes
+//   INV_X1_LVT i_0_0 (.A(a), .ZN(co));
+// The canonical net is a const value, or the first input, inout, output or
+// wire in this order. Other ports of the net set are still assigned from the
+// canonical net, because ports can't be removed. A net set is not changed if
+// it has more than one const value, or if it has a const value and is driven
+// by an instance.
+void VerilogNetlist::collapseAssigns(std::vector<Module> &netlist,
+                                     const uint32_t &modDefIndex)
+{
+  auto &oneMod = netlist[modDefIndex];
+  if(oneMod.assigns.empty())
+    return;
+  FlatNetlistIndex index(netlist, modDefIndex);
+  NetUnionFind netUnionFind(index.getTotalNets());
+  netUnionFind.uniteAssigns(index, oneMod);
+  const uint32_t totalNets = index.getTotalNets();
+
+  auto getRank = [&](const uint32_t &netId) -> uint32_t
+  {
+    if(index.isConstNet(netId))
+      return 0;
+    switch(oneMod.ports[index.getRefVar(netId).refVarDefIndex].portType)
+    {
+    case PortType::INPUT:
+      return 1;
+    case PortType::INOUT:
+      return 2;
+    case PortType::OUTPUT:
+      return 3;
+    default:
+      return 4;
+    }
+  };
+  // canonicalNetIds[netRootId] = the net with the smallest rank
+  std::vector<uint32_t> canonicalNetIds(totalNets, UINT32_MAX);
+  std::vector<uint32_t> rootTotalConsts(totalNets, 0);
+  std::vector<bool> isDrivenByIns(totalNets, false);
+  for(uint32_t netId = 0; netId < totalNets; netId++)
+  {
+    const uint32_t netRootId = netUnionFind.find(netId);
+    auto &canonicalNetId = canonicalNetIds[netRootId];
+    if(canonicalNetId == UINT32_MAX ||
+       getRank(netId) < getRank(canonicalNetId))
+      canonicalNetId = netId;
+    if(index.isConstNet(netId))
+      rootTotalConsts[netRootId]++;
+    if(index.driversBegin(netId) != index.driversEnd(netId))
+      isDrivenByIns[netRootId] = true;
+  }
+  auto isCollapsed = [&](const uint32_t &netRootId)
+  {
+    return rootTotalConsts[netRootId] == 0 ||
+           (rootTotalConsts[netRootId] == 1 && !isDrivenByIns[netRootId]);
+  };
+
+  for(auto &portAssignments: oneMod.portAssignmentsOfSubModInss)
+  {
+    for(auto &portAssignment: portAssignments)
+    {
+      for(auto &refVar: portAssignment.refVars)
+      {
+        const uint32_t netRootId = netUnionFind.find(index.getNetId(refVar));
+        if(isCollapsed(netRootId))
+          refVar = index.getRefVar(canonicalNetIds[netRootId]);
+      }
+    }
+  }
+  std::vector<BitSlicedAssignStatement> keptAssigns;
+  for(const auto &oneAssign: oneMod.assigns)
+  {
+    if(!isCollapsed(netUnionFind.find(index.getNetId(oneAssign.lValue))))
+      keptAssigns.push_back(oneAssign);
+  }
+  std::vector<bool> isCollapsedWire(oneMod.ports.size(), false);
+  for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts(); netId++)
+  {
+    const uint32_t netRootId = netUnionFind.find(netId);
+    if(!isCollapsed(netRootId) || canonicalNetIds[netRootId] == netId)
+      continue;
+    if(index.isPortNet(netId))
+    {
+      BitSlicedAssignStatement oneAssign;
+      oneAssign.lValue = index.getRefVar(netId);
+      oneAssign.rValue = index.getRefVar(canonicalNetIds[netRootId]);
+      keptAssigns.push_back(oneAssign);
+    }
+    else
+      isCollapsedWire[index.getRefVar(netId).refVarDefIndex] = true;
+  }
+  oneMod.assigns = std::move(keptAssigns);
+  removeUnusedWires(oneMod, isCollapsedWire);
+}
@@ -0,0 +1,325 @@
+/*************************************************************************
+  > File Name: VerilogNetlistCone.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include "VerilogNetlist.h"
+#include <iostream>
+#include <unordered_map>
+
+namespace
+{
+
+struct ConeRequest
+{
+    std::string name; // An instance or a net of a flattened module
+    bool isFanin;
+    bool isFound = false;
+};
+
+// Cones pass these cells, other cells such as flip flops, latches, clock
+// gates, pads and macros end a cone.
+bool isConePassed(const StdCellKind &kind)
+{
+  return kind == StdCellKind::COMBINATIONAL ||
+         kind == StdCellKind::TRISTATE || kind == StdCellKind::POWER;
+}
+
+} // namespace
+
+// Every cone is found by a breadth first search from its instance or net,
+// and only the pins of instances in the cone and of their nets are visited,
+// so a cone costs its size after the index of its flattened module is
+// built. A net of the cone is an input if it is only driven outside the
+// cone, an output if it is driven in the cone and read outside, and an inout
+// if it is driven both in and outside the cone.
+void VerilogNetlist::extractCones(const std::vector<Module> &flatNetlist,
+                                  const std::vector<UsedStdCell> &usedStdCells,
+                                  const V3StringSet &faninNames,
+                                  const V3StringSet &fanoutNames,
+                                  const uint32_t &coneDepth,
+                                  std::string fileName)
+{
+  std::vector<ConeRequest> requests;
+  for(const auto &name: faninNames)
+    requests.push_back({ name, true });
+  for(const auto &name: fanoutNames)
+    requests.push_back({ name, false });
+  // Std cells and black boxes are printed with the cones, so the file is a
+  // netlist by itself.
+  std::vector<Module> coneNetlist(flatNetlist.begin(),
+                                  flatNetlist.begin() + _totalUsedBlackBoxes);
+  for(uint32_t flatModDefIndex = _totalUsedBlackBoxes;
+      flatModDefIndex < flatNetlist.size(); flatModDefIndex++)
+  {
+    if(!isInFlatNet(flatModDefIndex))
+      continue;
+    const auto &flatMod = flatNetlist[flatModDefIndex];
+    const uint32_t totalInss = flatMod.subModuleDefIndexs.size();
+    // Instances are looked up by a hash of the names left, nets by ports.
+    std::unordered_map<std::string, std::vector<uint32_t>> requestsOfNames;
+    for(uint32_t requestIndex = 0; requestIndex < requests.size();
+        requestIndex++)
+    {
+      if(!requests[requestIndex].isFound)
+        requestsOfNames[requests[requestIndex].name].push_back(requestIndex);
+    }
+    if(requestsOfNames.empty())
+      break;
+    // startInss[requestIndex] is the instance of the request, or UINT32_MAX.
+    std::vector<uint32_t> startInss(requests.size(), UINT32_MAX);
+    bool hasCones = false;
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      const auto requestsOfName =
+        requestsOfNames.find(flatMod.subModuleInstanceNames[insIndex]);
+      if(requestsOfName == requestsOfNames.end())
+        continue;
+      for(const auto &requestIndex: requestsOfName->second)
+        startInss[requestIndex] = insIndex;
+      hasCones = true;
+    }
+    FlatNetlistIndex index(flatNetlist, flatModDefIndex);
+    std::vector<uint32_t> startNets(requests.size(), UINT32_MAX);
+    for(uint32_t requestIndex = 0; requestIndex < requests.size();
+        requestIndex++)
+    {
+      if(requests[requestIndex].isFound ||
+         startInss[requestIndex] != UINT32_MAX)
+        continue;
+      startNets[requestIndex] = index.findNetId(requests[requestIndex].name);
+      hasCones |= startNets[requestIndex] != UINT32_MAX;
+    }
+    if(!hasCones)
+      continue;
+    NetUnionFind netUnionFind(index.getTotalNets());
+    netUnionFind.uniteAssigns(index, flatMod);
+    const uint32_t totalNets = index.getTotalNets();
+    // Nets of every net set in compressed sparse rows: nets of net set i are
+    // in [memberStarts[i], memberStarts[i + 1]) of members.
+    std::vector<uint32_t> memberStarts(totalNets + 1, 0);
+    for(uint32_t netId = 0; netId < totalNets; netId++)
+      memberStarts[netUnionFind.find(netId) + 1]++;
+    for(uint32_t netId = 0; netId < totalNets; netId++)
+      memberStarts[netId + 1] += memberStarts[netId];
+    std::vector<uint32_t> members(totalNets);
+    std::vector<uint32_t> memberEnds(memberStarts.begin(),
+                                     memberStarts.end() - 1);
+    for(uint32_t netId = 0; netId < totalNets; netId++)
+      members[memberEnds[netUnionFind.find(netId)]++] = netId;
+
+    // Stamps are the request index of the last cone, so they are never
+    // cleared.
+    std::vector<uint32_t> insConeStamps(totalInss, UINT32_MAX);
+    std::vector<uint32_t> rootConeStamps(totalNets, UINT32_MAX);
+    std::vector<uint32_t> rootNewPorts(totalNets, 0);
+    for(uint32_t requestIndex = 0; requestIndex < requests.size();
+        requestIndex++)
+    {
+      const uint32_t startInsIndex = startInss[requestIndex];
+      const uint32_t startNetId = startNets[requestIndex];
+      if(startInsIndex == UINT32_MAX && startNetId == UINT32_MAX)
+        continue;
+      const bool isFanin = requests[requestIndex].isFanin;
+      // (insIndex, depth) in the order they are found
+      std::vector<std::pair<uint32_t, uint32_t>> coneInss;
+      // Add the unvisited drivers of a fanin cone or loads of a fanout cone.
+      auto visitNetSet = [&](const uint32_t &netRootId, const uint32_t &depth)
+      {
+        for(uint32_t memberIndex = memberStarts[netRootId];
+            memberIndex < memberStarts[netRootId + 1]; memberIndex++)
+        {
+          const uint32_t netId = members[memberIndex];
+          const FlatPin *pinsBegin =
+            isFanin ? index.driversBegin(netId) : index.loadsBegin(netId);
+          const FlatPin *pinsEnd =
+            isFanin ? index.driversEnd(netId) : index.loadsEnd(netId);
+          for(const FlatPin *pin = pinsBegin; pin != pinsEnd; pin++)
+          {
+            if(insConeStamps[pin->insIndex] == requestIndex)
+              continue;
+            insConeStamps[pin->insIndex] = requestIndex;
+            coneInss.push_back({ pin->insIndex, depth });
+          }
+        }
+      };
+      if(startInsIndex != UINT32_MAX)
+      {
+        insConeStamps[startInsIndex] = requestIndex;
+        coneInss.push_back({ startInsIndex, 0 });
+      }
+      else
+        visitNetSet(netUnionFind.find(startNetId), 1);
+      for(uint32_t coneInsIndex = 0; coneInsIndex < coneInss.size();
+          coneInsIndex++)
+      {
+        const uint32_t insIndex = coneInss[coneInsIndex].first;
+        const uint32_t depth = coneInss[coneInsIndex].second;
+        const uint32_t subModDefIndex = flatMod.subModuleDefIndexs[insIndex];
+        if((coneDepth && depth >= coneDepth) ||
+           (insIndex != startInsIndex &&
+            !isConePassed(usedStdCells[subModDefIndex].kind)))
+          continue;
+        const auto &stdCell = flatNetlist[subModDefIndex];
+        const auto &portAssignments =
+          flatMod.portAssignmentsOfSubModInss[insIndex];
+        // Inputs and inouts of a fanin cone, outputs and inouts of a fanout
+        // cone
+        const uint32_t beginPort = isFanin ? 0 : stdCell.totalInputs;
+        const uint32_t endPort = isFanin ? stdCell.totalInputsAndInouts
+                                         : stdCell.totalPortsExcludingWires;
+        for(uint32_t portDefIndex = beginPort; portDefIndex < endPort;
+            portDefIndex++)
+        {
+          for(const auto &refVar: portAssignments[portDefIndex].refVars)
+          {
+            const uint32_t netRootId =
+              netUnionFind.find(index.getNetId(refVar));
+            if(!index.isConstNet(netRootId))
+              visitNetSet(netRootId, depth + 1);
+          }
+        }
+      }
+
+      // The net sets of the cone in the order they are found, and whether
+      // they are driven or read in and outside the cone.
+      std::vector<uint32_t> coneRoots;
+      auto addNetSet = [&](const uint32_t &netRootId)
+      {
+        if(rootConeStamps[netRootId] == requestIndex)
+          return;
+        rootConeStamps[netRootId] = requestIndex;
+        coneRoots.push_back(netRootId);
+      };
+      if(startNetId != UINT32_MAX)
+        addNetSet(netUnionFind.find(startNetId));
+      for(const auto &coneIns: coneInss)
+      {
+        for(const auto &portAssignment:
+            flatMod.portAssignmentsOfSubModInss[coneIns.first])
+        {
+          for(const auto &refVar: portAssignment.refVars)
+          {
+            const uint32_t netRootId =
+              netUnionFind.find(index.getNetId(refVar));
+            if(!index.isConstNet(netRootId))
+              addNetSet(netRootId);
+          }
+        }
+      }
+      std::vector<PortType> rootPortTypes;
+      for(const auto &netRootId: coneRoots)
+      {
+        bool isDrivenInside = false;
+        bool isDrivenOutside = false;
+        bool isReadOutside = false;
+        for(uint32_t memberIndex = memberStarts[netRootId];
+            memberIndex < memberStarts[netRootId + 1]; memberIndex++)
+        {
+          const uint32_t netId = members[memberIndex];
+          const uint32_t portDefIndex = index.getRefVar(netId).refVarDefIndex;
+          isDrivenOutside |= portDefIndex < flatMod.totalInputsAndInouts;
+          isReadOutside |= portDefIndex >= flatMod.totalInputs &&
+                           portDefIndex < flatMod.totalPortsExcludingWires;
+          for(const FlatPin *pin = index.driversBegin(netId);
+              pin != index.driversEnd(netId); pin++)
+          {
+            const bool isInside = insConeStamps[pin->insIndex] == requestIndex;
+            isDrivenInside |= isInside;
+            isDrivenOutside |= !isInside;
+          }
+          for(const FlatPin *pin = index.loadsBegin(netId);
+              pin != index.loadsEnd(netId); pin++)
+            isReadOutside |= insConeStamps[pin->insIndex] != requestIndex;
+        }
+        // The start net is always seen from outside.
+        if(netRootId == coneRoots[0] && startNetId != UINT32_MAX)
+        {
+          isDrivenOutside |= !isFanin;
+          isReadOutside |= isFanin;
+        }
+        if(isDrivenInside && isDrivenOutside)
+          rootPortTypes.push_back(PortType::INOUT);
+        else if(isDrivenOutside)
+          rootPortTypes.push_back(PortType::INPUT);
+        else if(isDrivenInside && isReadOutside)
+          rootPortTypes.push_back(PortType::OUTPUT);
+        else
+          rootPortTypes.push_back(PortType::WIRE);
+      }
+
+      // Every net set is one bit named by its root, and ports are ordered as
+      // inputs, inouts, outputs and wires.
+      Module coneMod;
+      coneMod.moduleDefName = flatMod.moduleDefName +
+                              (isFanin ? "_fanin_cone" : "_fanout_cone") +
+                              std::to_string(requestIndex);
+      coneMod.level = flatMod.level;
+      for(const PortType &portType: { PortType::INPUT, PortType::INOUT,
+                                      PortType::OUTPUT, PortType::WIRE })
+      {
+        if(portType == PortType::INOUT)
+          coneMod.totalInputs = coneMod.ports.size();
+        else if(portType == PortType::OUTPUT)
+          coneMod.totalInputsAndInouts = coneMod.ports.size();
+        else if(portType == PortType::WIRE)
+          coneMod.totalPortsExcludingWires = coneMod.ports.size();
+        for(uint32_t rootIndex = 0; rootIndex < coneRoots.size(); rootIndex++)
+        {
+          if(rootPortTypes[rootIndex] != portType)
+            continue;
+          rootNewPorts[coneRoots[rootIndex]] = coneMod.ports.size();
+          PortDefinition port;
+          port.portDefName = index.getNetName(coneRoots[rootIndex]);
+          port.portType = portType;
+          coneMod.ports.push_back(std::move(port));
+        }
+      }
+      for(const auto &coneIns: coneInss)
+      {
+        coneMod.subModuleInstanceNames.push_back(
+          flatMod.subModuleInstanceNames[coneIns.first]);
+        coneMod.subModuleDefIndexs.push_back(
+          flatMod.subModuleDefIndexs[coneIns.first]);
+        auto portAssignments =
+          flatMod.portAssignmentsOfSubModInss[coneIns.first];
+        for(auto &portAssignment: portAssignments)
+        {
+          for(auto &refVar: portAssignment.refVars)
+          {
+            const uint32_t netRootId =
+              netUnionFind.find(index.getNetId(refVar));
+            if(index.isConstNet(netRootId))
+              refVar = index.getRefVar(netRootId);
+            else
+            {
+              refVar.refVarDefIndex = rootNewPorts[netRootId];
+              refVar.bitIndex = 0;
+            }
+          }
+        }
+        coneMod.portAssignmentsOfSubModInss.push_back(
+          std::move(portAssignments));
+      }
+      std::cout << (isFanin ? "Fanin" : "Fanout") << " cone of "
+                << requests[requestIndex].name << " in "
+                << flatMod.moduleDefName << " has " << coneInss.size()
+                << " instances, see module " << coneMod.moduleDefName << " of "
+                << fileName << "." << std::endl;
+      requests[requestIndex].isFound = true;
+      coneNetlist.push_back(std::move(coneMod));
+    }
+  }
+  for(const auto &request: requests)
+  {
+    if(!request.isFound)
+      throw std::runtime_error(
+        "Can't find instance or net " + request.name + " for " +
+        (request.isFanin ? "--netlist-fanin-cone." : "--netlist-fanout-cone."));
+  }
+  printNetlist(coneNetlist, _totalUsedStdCells, _totalUsedBlackBoxes,
+               fileName);
+}
@@ -0,0 +1,81 @@
+/*************************************************************************
+  > File Name: VerilogNetlistDiff.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistBinary.h"
+#include "NetlistDiff.h"
+#include "NetlistReader.h"
+#include "VerilogNetlist.h"
+#include <fstream>
+#include <iostream>
+
+void VerilogNetlist::saveNetlist(const std::string &fileName) const
+{
+  SavedNetlists savedNetlists;
+  savedNetlists.totalUsedStdCells = _totalUsedStdCells;
+  savedNetlists.totalUsedNotEmptyStdCells = _totalUsedNotEmptyStdCells;
+  savedNetlists.totalUsedBlackBoxes = _totalUsedBlackBoxes;
+  savedNetlists.hierNetlist = _hierNetlist;
+  savedNetlists.flatNetlist = _flatNetlist;
+  writeNetlistBinary(fileName, savedNetlists);
+}
+
+// The compared netlists are the old ones, so "+" means added by this run.
+uint64_t VerilogNetlist::diffNetlist(const std::string &savedFileName,
+                                     const std::string &hierFileName,
+                                     const std::string &flatFileName,
+                                     std::string reportName) const
+{
+  // Every old netlist is read before the report is written, so a broken
+  // file stops the run without a report instead of with a partial one. Std
+  // cells aren't written into Verilog netlists, so they are taken from the
+  // netlists of this run.
+  SavedNetlists savedNetlists;
+  if(!savedFileName.empty())
+    savedNetlists = readNetlistBinary(savedFileName);
+  LoadedNetlist hierNetlist;
+  if(!hierFileName.empty())
+    hierNetlist =
+      readNetlistVerilog(hierFileName, _hierNetlist, _totalUsedBlackBoxes);
+  LoadedNetlist flatNetlist;
+  if(!flatFileName.empty())
+    flatNetlist =
+      readNetlistVerilog(flatFileName, _flatNetlist, _totalUsedBlackBoxes);
+
+  std::ofstream ofs(reportName);
+  uint64_t totalDiffs = 0;
+  auto diffOneNetlist = [&](const std::string &netlistName,
+                            const std::string &oldFileName,
+                            const std::vector<Module> &oldNetlist,
+                            const uint32_t &oldTotalUsedBlackBoxes,
+                            const std::vector<Module> &newNetlist)
+  {
+    ofs << "// " << netlistName << " compared with " << oldFileName
+        << std::endl;
+    const uint64_t totalNetlistDiffs =
+      diffNetlists(oldNetlist, oldTotalUsedBlackBoxes, newNetlist,
+                   _totalUsedBlackBoxes, ofs);
+    std::cout << "Compared with " << oldFileName << ", " << netlistName
+              << " has " << totalNetlistDiffs << " differences, see "
+              << reportName << "." << std::endl;
+    totalDiffs += totalNetlistDiffs;
+  };
+  if(!savedFileName.empty())
+  {
+    diffOneNetlist("HierNetlist.v", savedFileName, savedNetlists.hierNetlist,
+                   savedNetlists.totalUsedBlackBoxes, _hierNetlist);
+    diffOneNetlist("FlatNetlist.v", savedFileName, savedNetlists.flatNetlist,
+                   savedNetlists.totalUsedBlackBoxes, _flatNetlist);
+  }
+  if(!hierFileName.empty())
+    diffOneNetlist("HierNetlist.v", hierFileName, hierNetlist.netlist,
+                   hierNetlist.totalUsedBlackBoxes, _hierNetlist);
+  if(!flatFileName.empty())
+    diffOneNetlist("FlatNetlist.v", flatFileName, flatNetlist.netlist,
+                   flatNetlist.totalUsedBlackBoxes, _flatNetlist);
+  ofs.close();
+  return totalDiffs;
+}
@@ -0,0 +1,36 @@
+/*************************************************************************
+  > File Name: VerilogNetlistHypergraph.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistHypergraph.h"
+#include "VerilogNetlist.h"
+
+void VerilogNetlist::writeHypergraph(
+  const std::vector<Module> &flatNetlist,
+  const std::vector<UsedStdCell> &usedStdCells, const std::string &hgrFileName,
+  const std::string &csrFileName)
+{
+  NetlistHypergraph hypergraph;
+  if(flatNetlist.size() > _totalUsedBlackBoxes)
+    hypergraph = buildNetlistHypergraph(flatNetlist, _totalUsedBlackBoxes,
+                                        _totalUsedBlackBoxes, usedStdCells);
+  if(!hgrFileName.empty())
+  {
+    auto os = openNetlistOutput(hgrFileName);
+    if(!*os)
+      throw std::runtime_error("Can't open " + hgrFileName + ".");
+    writeHgr(hypergraph, *os);
+  }
+  if(!csrFileName.empty())
+  {
+    auto os = openNetlistOutput(csrFileName);
+    if(!*os)
+      throw std::runtime_error("Can't open " + csrFileName + ".");
+    writeHypergraphCsr(hypergraph, *os);
+    if(!*os)
+      throw std::runtime_error("Can't write " + csrFileName + ".");
+  }
+}
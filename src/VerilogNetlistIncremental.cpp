@@ -0,0 +1,240 @@
+/*************************************************************************
+  > File Name: VerilogNetlistIncremental.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistBinary.h"
+#include "V3Hash.h"
+#include "VerilogNetlist.h"
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+
+namespace
+{
+
+bool isSameRefVar(const RefVar &lRefVar, const RefVar &rRefVar)
+{
+  if(lRefVar.refVarDefIndex != rRefVar.refVarDefIndex)
+    return false;
+  if(lRefVar.refVarDefIndex == UINT32_MAX)
+    return lRefVar.valueAndValueX == rRefVar.valueAndValueX;
+  return lRefVar.bitIndex == rRefVar.bitIndex;
+}
+
+V3Hash getRefVarHash(const RefVar &refVar)
+{
+  return V3Hash(refVar.refVarDefIndex) +
+         (refVar.refVarDefIndex == UINT32_MAX
+            ? static_cast<uint32_t>(static_cast<uint8_t>(refVar.valueAndValueX))
+            : refVar.bitIndex);
+}
+
+// Everything of a hierarchical module, sub modules are hashed by their names.
+V3Hash getModHash(const std::vector<Module> &hierNetlist, const Module &oneMod)
+{
+  V3Hash hash(oneMod.moduleDefName);
+  for(const auto &port: oneMod.ports)
+    hash += V3Hash(port.portDefName) +
+            static_cast<uint32_t>(port.portType) +
+            static_cast<uint32_t>(port.isVector) + port.bitWidth;
+  for(const auto &oneAssign: oneMod.assigns)
+    hash += getRefVarHash(oneAssign.lValue).value() +
+            getRefVarHash(oneAssign.rValue).value();
+  for(uint32_t insIndex = 0; insIndex < oneMod.subModuleDefIndexs.size();
+      insIndex++)
+  {
+    hash += V3Hash(oneMod.subModuleInstanceNames[insIndex]) +
+            V3Hash(hierNetlist[oneMod.subModuleDefIndexs[insIndex]]
+                     .moduleDefName);
+    for(const auto &portAssignment:
+        oneMod.portAssignmentsOfSubModInss[insIndex])
+    {
+      hash += static_cast<uint32_t>(portAssignment.refVars.size());
+      for(const auto &refVar: portAssignment.refVars)
+        hash += getRefVarHash(refVar).value();
+    }
+  }
+  return hash;
+}
+
+// The same comparison as getModHash, so that a hash collision can't reuse a
+// wrong module.
+bool isSameMod(const std::vector<Module> &lNetlist, const Module &lMod,
+               const std::vector<Module> &rNetlist, const Module &rMod)
+{
+  if(lMod.moduleDefName != rMod.moduleDefName ||
+     lMod.ports.size() != rMod.ports.size() ||
+     lMod.totalInputs != rMod.totalInputs ||
+     lMod.totalInputsAndInouts != rMod.totalInputsAndInouts ||
+     lMod.totalPortsExcludingWires != rMod.totalPortsExcludingWires ||
+     lMod.assigns.size() != rMod.assigns.size() ||
+     lMod.subModuleDefIndexs.size() != rMod.subModuleDefIndexs.size())
+    return false;
+  for(uint32_t portDefIndex = 0; portDefIndex < lMod.ports.size();
+      portDefIndex++)
+  {
+    const auto &lPort = lMod.ports[portDefIndex];
+    const auto &rPort = rMod.ports[portDefIndex];
+    if(lPort.portDefName != rPort.portDefName ||
+       lPort.portType != rPort.portType || lPort.isVector != rPort.isVector ||
+       lPort.bitWidth != rPort.bitWidth)
+      return false;
+  }
+  for(uint32_t assignIndex = 0; assignIndex < lMod.assigns.size();
+      assignIndex++)
+  {
+    if(!isSameRefVar(lMod.assigns[assignIndex].lValue,
+                     rMod.assigns[assignIndex].lValue) ||
+       !isSameRefVar(lMod.assigns[assignIndex].rValue,
+                     rMod.assigns[assignIndex].rValue))
+      return false;
+  }
+  for(uint32_t insIndex = 0; insIndex < lMod.subModuleDefIndexs.size();
+      insIndex++)
+  {
+    const auto &lPortAssignments = lMod.portAssignmentsOfSubModInss[insIndex];
+    const auto &rPortAssignments = rMod.portAssignmentsOfSubModInss[insIndex];
+    if(lMod.subModuleInstanceNames[insIndex] !=
+         rMod.subModuleInstanceNames[insIndex] ||
+       lNetlist[lMod.subModuleDefIndexs[insIndex]].moduleDefName !=
+         rNetlist[rMod.subModuleDefIndexs[insIndex]].moduleDefName ||
+       lPortAssignments.size() != rPortAssignments.size())
+      return false;
+    for(uint32_t portDefIndex = 0; portDefIndex < lPortAssignments.size();
+        portDefIndex++)
+    {
+      const auto &lRefVars = lPortAssignments[portDefIndex].refVars;
+      const auto &rRefVars = rPortAssignments[portDefIndex].refVars;
+      if(lRefVars.size() != rRefVars.size())
+        return false;
+      for(uint32_t bitIndex = 0; bitIndex < lRefVars.size(); bitIndex++)
+      {
+        if(!isSameRefVar(lRefVars[bitIndex], rRefVars[bitIndex]))
+          return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+// A flattened module only depends on its sub tree and on the options of
+// flattening, and on its level if --flatten-depth is used. So the hash of a
+// sub tree is the hash of the module and the hashes of the sub trees of its
+// sub modules. A module of the last run is reused if it has the same name
+// and the same sub tree, which is checked again without hashing.
+void VerilogNetlist::flattenHierNetIncrementally(
+  const std::string &cacheFileName)
+{
+  const int flattenDepth = v3Global.opt.flattenDepth();
+  std::string flattenConfig =
+    "collapseAssigns=" + std::to_string(v3Global.opt.collapseAssigns()) +
+    " flattenDepth=" + std::to_string(flattenDepth) + " flattenKeeps=";
+  for(const auto &keptModDefName: v3Global.opt.flattenKeeps())
+    flattenConfig += keptModDefName + ",";
+  const uint32_t totalMods = _hierNetlist.size();
+  // Black boxes are the first modules but the leaves of sub trees, so they
+  // are hashed and compared first.
+  std::vector<uint32_t> subtreeHashes(totalMods);
+  for(uint32_t modDefIndex = 0; modDefIndex < _totalUsedBlackBoxes;
+      modDefIndex++)
+    subtreeHashes[modDefIndex] =
+      getModHash(_hierNetlist, _hierNetlist[modDefIndex]).value();
+  for(uint32_t modDefIndex = totalMods - 1;
+      modDefIndex >= _totalUsedBlackBoxes && modDefIndex != UINT32_MAX;
+      modDefIndex--)
+  {
+    const auto &oneMod = _hierNetlist[modDefIndex];
+    V3Hash hash = getModHash(_hierNetlist, oneMod);
+    if(flattenDepth >= 0)
+      hash += oneMod.level;
+    for(const auto &subModDefIndex: oneMod.subModuleDefIndexs)
+      hash += subtreeHashes[subModDefIndex];
+    subtreeHashes[modDefIndex] = hash.value();
+  }
+
+  SavedNetlists cache;
+  if(std::ifstream(cacheFileName).good())
+  {
+    try
+    {
+      cache = readNetlistBinary(cacheFileName);
+    }
+    catch(const std::runtime_error &error)
+    {
+      std::cout << "Netlist cache isn't used: " << error.what() << std::endl;
+    }
+  }
+  std::vector<Module> reusedFlatMods(totalMods);
+  uint32_t totalReusedMods = 0;
+  if(cache.flattenConfig == flattenConfig &&
+     cache.subtreeHashes.size() == cache.hierNetlist.size())
+  {
+    std::unordered_map<std::string, uint32_t> oldModIndexs, newModIndexs;
+    for(uint32_t modDefIndex = 0; modDefIndex < cache.hierNetlist.size();
+        modDefIndex++)
+      oldModIndexs.emplace(cache.hierNetlist[modDefIndex].moduleDefName,
+                           modDefIndex);
+    for(uint32_t modDefIndex = 0; modDefIndex < totalMods; modDefIndex++)
+      newModIndexs.emplace(_hierNetlist[modDefIndex].moduleDefName,
+                           modDefIndex);
+    std::vector<bool> isSameSubtree(totalMods, false);
+    auto isSameModAsCache = [&](const uint32_t &modDefIndex)
+    {
+      const auto &oneMod = _hierNetlist[modDefIndex];
+      auto it = oldModIndexs.find(oneMod.moduleDefName);
+      return it != oldModIndexs.end() &&
+             cache.subtreeHashes[it->second] == subtreeHashes[modDefIndex] &&
+             (flattenDepth < 0 ||
+              cache.hierNetlist[it->second].level == oneMod.level) &&
+             isSameMod(cache.hierNetlist, cache.hierNetlist[it->second],
+                       _hierNetlist, oneMod);
+    };
+    for(uint32_t modDefIndex = 0; modDefIndex < _totalUsedBlackBoxes;
+        modDefIndex++)
+      isSameSubtree[modDefIndex] = isSameModAsCache(modDefIndex);
+    for(uint32_t modDefIndex = totalMods - 1;
+        modDefIndex >= _totalUsedBlackBoxes && modDefIndex != UINT32_MAX;
+        modDefIndex--)
+    {
+      const auto &oneMod = _hierNetlist[modDefIndex];
+      if(!isSameModAsCache(modDefIndex))
+        continue;
+      isSameSubtree[modDefIndex] = true;
+      for(const auto &subModDefIndex: oneMod.subModuleDefIndexs)
+        isSameSubtree[modDefIndex] =
+          isSameSubtree[modDefIndex] && isSameSubtree[subModDefIndex];
+      if(!isSameSubtree[modDefIndex])
+        continue;
+      // Instances of the flattened module refer to the old module indexs.
+      auto &reusedFlatMod = reusedFlatMods[modDefIndex];
+      reusedFlatMod =
+        std::move(cache.flatNetlist[oldModIndexs.at(oneMod.moduleDefName)]);
+      for(auto &subModDefIndex: reusedFlatMod.subModuleDefIndexs)
+        subModDefIndex =
+          newModIndexs.at(cache.hierNetlist[subModDefIndex].moduleDefName);
+      totalReusedMods++;
+    }
+  }
+  flattenHierNet(_hierNetlist, _flatNetlist, _totalUsedBlackBoxes,
+                 v3Global.opt.collapseAssigns(), flattenDepth,
+                 v3Global.opt.flattenKeeps(), v3Global.opt.netlistThreads(),
+                 &reusedFlatMods);
+  std::cout << "Reused " << totalReusedMods << " of "
+            << totalMods - _totalUsedBlackBoxes
+            << " flattened modules from " << cacheFileName << "." << std::endl;
+
+  SavedNetlists newCache;
+  newCache.totalUsedStdCells = _totalUsedStdCells;
+  newCache.totalUsedNotEmptyStdCells = _totalUsedNotEmptyStdCells;
+  newCache.totalUsedBlackBoxes = _totalUsedBlackBoxes;
+  newCache.hierNetlist = _hierNetlist;
+  newCache.flatNetlist = _flatNetlist;
+  newCache.flattenConfig = flattenConfig;
+  newCache.subtreeHashes = std::move(subtreeHashes);
+  writeNetlistBinary(cacheFileName, newCache);
+}
@@ -0,0 +1,244 @@
+/*************************************************************************
+  > File Name: VerilogNetlistJson.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include "NetlistWriter.h"
+#include "VerilogNetlist.h"
+
+namespace
+{
+
+// Yosys writes integer attributes as 32 binary digits.
+const char *attributeOne = "\"00000000000000000000000000000001\"";
+// Bits tied to 1'b0, 1'b1, 1'bx and 1'bz
+const char *constBitNames[4] = { "\"0\"", "\"1\"", "\"x\"", "\"z\"" };
+const char *directionNames[3] = { "\"input\"", "\"output\"", "\"inout\"" };
+
+// A streaming writer, numbers and strings are encoded into the buffer
+// directly without temporary strings.
+class JsonWriter final
+{
+  private:
+    std::ostream &_os;
+    std::string _buffer;
+
+  public:
+    explicit JsonWriter(std::ostream &os) : _os(os){};
+    ~JsonWriter() { flush(); };
+    void flush()
+    {
+      _os.write(_buffer.data(), _buffer.size());
+      _buffer.clear();
+    };
+    void flushIfFull()
+    {
+      if(_buffer.size() >= NETLIST_WRITER_BUFFER_BYTES)
+        flush();
+    };
+    void writeRaw(const char *text) { _buffer += text; };
+    void writeChar(const char &c) { _buffer += c; };
+    void writeUint(uint32_t number)
+    {
+      char digits[10];
+      uint32_t totalDigits = 0;
+      do
+      {
+        digits[totalDigits++] = '0' + number % 10;
+        number /= 10;
+      } while(number);
+      while(totalDigits)
+        _buffer += digits[--totalDigits];
+    };
+    // Most names need no escape, so they are appended at once.
+    void writeString(const std::string &str)
+    {
+      _buffer += '"';
+      size_t begin = 0;
+      for(size_t pos = 0; pos < str.size(); pos++)
+      {
+        const unsigned char c = str[pos];
+        if(c >= 0x20 && c != '"' && c != '\\')
+          continue;
+        _buffer.append(str, begin, pos - begin);
+        begin = pos + 1;
+        if(c == '"' || c == '\\')
+        {
+          _buffer += '\\';
+          _buffer += c;
+          continue;
+        }
+        const char *hexDigits = "0123456789abcdef";
+        _buffer += "\\u00";
+        _buffer += hexDigits[c >> 4];
+        _buffer += hexDigits[c & 0xF];
+      }
+      _buffer.append(str, begin, std::string::npos);
+      _buffer += '"';
+    };
+    // Write "key": after a comma if it isn't the first member.
+    void writeKey(const std::string &key, const char *indent,
+                  const bool &isFirst)
+    {
+      _buffer += isFirst ? "\n" : ",\n";
+      _buffer += indent;
+      writeString(key);
+      _buffer += ": ";
+    };
+};
+
+} // namespace
+
+// Every module has its own bit ids from 2, and the nets connected by assign
+// statements have the same bit id, since the format has no assign.
+void VerilogNetlist::writeJson(const std::vector<Module> &netlist,
+                               const std::vector<bool> &isWritten,
+                               std::string fileName)
+{
+  auto os = openNetlistOutput(fileName);
+  if(!*os)
+    throw std::runtime_error("Can't open " + fileName + ".");
+  JsonWriter writer(*os);
+  writer.writeRaw("{\n  \"creator\": ");
+  writer.writeString("Verilator " + V3Options::version());
+  writer.writeRaw(",\n  \"modules\": {");
+  bool isFirstMod = true;
+  for(uint32_t modDefIndex = 0; modDefIndex < netlist.size(); modDefIndex++)
+  {
+    if(modDefIndex >= _totalUsedBlackBoxes && !isWritten.empty() &&
+       !isWritten[modDefIndex])
+      continue;
+    const auto &oneMod = netlist[modDefIndex];
+    FlatNetlistIndex index(netlist, modDefIndex);
+    NetUnionFind netUnionFind(index.getTotalNets());
+    netUnionFind.uniteAssigns(index, oneMod);
+    std::vector<uint32_t> bitIds(index.getTotalNets(), 0);
+    uint32_t totalBitIds = 2;
+    for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts();
+        netId++)
+    {
+      const uint32_t netRootId = netUnionFind.find(netId);
+      if(!index.isConstNet(netRootId) && !bitIds[netRootId])
+        bitIds[netRootId] = totalBitIds++;
+    }
+    auto writeBit = [&](const RefVar &refVar)
+    {
+      const uint32_t netRootId = netUnionFind.find(index.getNetId(refVar));
+      if(index.isConstNet(netRootId))
+        writer.writeRaw(
+          constBitNames[netRootId - index.getTotalNetsExcludingConsts()]);
+      else
+        writer.writeUint(bitIds[netRootId]);
+    };
+    auto writePortBits = [&](const uint32_t &portDefIndex)
+    {
+      RefVar refVar;
+      refVar.refVarDefIndex = portDefIndex;
+      writer.writeRaw("[ ");
+      for(uint32_t bitIndex = 0; bitIndex < oneMod.ports[portDefIndex].bitWidth;
+          bitIndex++)
+      {
+        if(bitIndex)
+          writer.writeRaw(", ");
+        refVar.bitIndex = bitIndex;
+        writeBit(refVar);
+      }
+      writer.writeRaw(" ]");
+    };
+
+    writer.writeKey(oneMod.moduleDefName, "    ", isFirstMod);
+    isFirstMod = false;
+    writer.writeRaw("{\n      \"attributes\": {");
+    if(modDefIndex < _totalUsedBlackBoxes)
+    {
+      writer.writeRaw("\n        \"blackbox\": ");
+      writer.writeRaw(attributeOne);
+    }
+    else if(oneMod.level == netlist[_totalUsedBlackBoxes].level)
+    {
+      writer.writeRaw("\n        \"top\": ");
+      writer.writeRaw(attributeOne);
+    }
+    writer.writeRaw("\n      },\n      \"ports\": {");
+    for(uint32_t portDefIndex = 0;
+        portDefIndex < oneMod.totalPortsExcludingWires; portDefIndex++)
+    {
+      writer.writeKey(oneMod.ports[portDefIndex].portDefName, "        ",
+                      portDefIndex == 0);
+      writer.writeRaw("{\n          \"direction\": ");
+      writer.writeRaw(
+        directionNames[int(oneMod.ports[portDefIndex].portType)]);
+      writer.writeRaw(",\n          \"bits\": ");
+      writePortBits(portDefIndex);
+      writer.writeRaw("\n        }");
+    }
+    writer.writeRaw("\n      },\n      \"cells\": {");
+    // Unconnected pins are left out.
+    for(uint32_t insIndex = 0; insIndex < oneMod.subModuleDefIndexs.size();
+        insIndex++)
+    {
+      const auto &subMod = netlist[oneMod.subModuleDefIndexs[insIndex]];
+      const auto &portAssignments =
+        oneMod.portAssignmentsOfSubModInss[insIndex];
+      writer.writeKey(oneMod.subModuleInstanceNames[insIndex], "        ",
+                      insIndex == 0);
+      writer.writeRaw("{\n          \"hide_name\": 0,\n          \"type\": ");
+      writer.writeString(subMod.moduleDefName);
+      writer.writeRaw(",\n          \"parameters\": {\n          },"
+                      "\n          \"attributes\": {\n          },"
+                      "\n          \"port_directions\": {");
+      bool isFirstPort = true;
+      for(uint32_t portDefIndex = 0; portDefIndex < portAssignments.size();
+          portDefIndex++)
+      {
+        if(portAssignments[portDefIndex].refVars.empty())
+          continue;
+        writer.writeKey(subMod.ports[portDefIndex].portDefName,
+                        "            ", isFirstPort);
+        isFirstPort = false;
+        writer.writeRaw(
+          directionNames[int(subMod.ports[portDefIndex].portType)]);
+      }
+      writer.writeRaw("\n          },\n          \"connections\": {");
+      isFirstPort = true;
+      for(uint32_t portDefIndex = 0; portDefIndex < portAssignments.size();
+          portDefIndex++)
+      {
+        const auto &refVars = portAssignments[portDefIndex].refVars;
+        if(refVars.empty())
+          continue;
+        writer.writeKey(subMod.ports[portDefIndex].portDefName,
+                        "            ", isFirstPort);
+        isFirstPort = false;
+        writer.writeRaw("[ ");
+        for(uint32_t bitIndex = 0; bitIndex < refVars.size(); bitIndex++)
+        {
+          if(bitIndex)
+            writer.writeRaw(", ");
+          writeBit(refVars[bitIndex]);
+        }
+        writer.writeRaw(" ]");
+      }
+      writer.writeRaw("\n          }\n        }");
+      writer.flushIfFull();
+    }
+    writer.writeRaw("\n      },\n      \"netnames\": {");
+    for(uint32_t portDefIndex = 0; portDefIndex < oneMod.ports.size();
+        portDefIndex++)
+    {
+      const auto &portDefName = oneMod.ports[portDefIndex].portDefName;
+      writer.writeKey(portDefName, "        ", portDefIndex == 0);
+      writer.writeRaw("{\n          \"hide_name\": ");
+      writer.writeChar(portDefName[0] == '$' ? '1' : '0');
+      writer.writeRaw(",\n          \"bits\": ");
+      writePortBits(portDefIndex);
+      writer.writeRaw(",\n          \"attributes\": {\n          }\n        }");
+      writer.flushIfFull();
+    }
+    writer.writeRaw("\n      }\n    }");
+  }
+  writer.writeRaw("\n  }\n}\n");
+}
@@ -0,0 +1,331 @@
+/*************************************************************************
+  > File Name: VerilogNetlistOutOfCore.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistParallel.h"
+#include "NetlistSpill.h"
+#include "NetlistWriter.h"
+#include "VerilogNetlist.h"
+#include <fstream>
+#include <memory>
+
+namespace
+{
+
+struct Scope;
+
+// A net of a flattened module, which is a port or a wire of the module of a
+// scope, or a const value if scope is nullptr. It is unconnected if it is
+// connected to an empty port of an instance.
+struct FlatNet
+{
+    const Scope *scope = nullptr;
+    RefVar refVar;
+    bool isUnconnected = false;
+};
+
+// An instance which is inlined into the flattened module, or the flattened
+// module itself, which is the root scope. Only the scopes from the root to
+// the instance being printed are in memory.
+struct Scope
+{
+    uint32_t modDefIndex;
+    // Instance names from the root, e.g. "U1/U2/", empty for the root
+    std::string prefix;
+    // The nets connected to every bit of every port, a port of the root is
+    // a net itself.
+    std::vector<std::vector<FlatNet>> portNets;
+};
+
+// The three parts of a flattened module, which are printed in this order
+enum FlatModPart
+{
+  WIRES,
+  ASSIGNS,
+  INSTANCES,
+  TOTAL_FLAT_MOD_PARTS
+};
+
+class OutOfCoreFlattener final
+{
+  private:
+    const std::vector<Module> &_hierNetlist;
+    const uint32_t _totalUsedBlackBoxes;
+    const int _flattenDepth;
+    const V3StringSet &_keptModDefNames;
+    const std::string &_spillDirName;
+
+    bool isInlined(const uint32_t &modDefIndex,
+                   const uint32_t &subModDefIndex) const
+    {
+      return subModDefIndex >= _totalUsedBlackBoxes &&
+             !VerilogNetlist::isHardMacro(_hierNetlist, _totalUsedBlackBoxes,
+                                          _flattenDepth, _keptModDefNames,
+                                          modDefIndex, subModDefIndex);
+    };
+    FlatNet getFlatNet(const Scope &scope, const RefVar &refVar) const
+    {
+      FlatNet flatNet;
+      flatNet.refVar = refVar;
+      if(refVar.refVarDefIndex == UINT32_MAX)
+        return flatNet;
+      const auto &oneMod = _hierNetlist[scope.modDefIndex];
+      if(scope.prefix.empty() ||
+         refVar.refVarDefIndex >= oneMod.totalPortsExcludingWires)
+      {
+        flatNet.scope = &scope;
+        return flatNet;
+      }
+      const auto &portNets = scope.portNets[refVar.refVarDefIndex];
+      if(portNets.empty())
+      {
+        flatNet.isUnconnected = true;
+        return flatNet;
+      }
+      return portNets[refVar.bitIndex];
+    };
+    // The name is kept in name until the net is printed.
+    PrintedNet getPrintedNet(const FlatNet &flatNet, std::string &name) const
+    {
+      PrintedNet net;
+      if(!flatNet.scope)
+      {
+        net.valueAndValueX = flatNet.refVar.valueAndValueX;
+        return net;
+      }
+      const auto &port = _hierNetlist[flatNet.scope->modDefIndex]
+                           .ports[flatNet.refVar.refVarDefIndex];
+      name.assign(flatNet.scope->prefix).append(port.portDefName);
+      net.name = &name;
+      net.isVector = port.isVector;
+      net.bitWidth = port.bitWidth;
+      net.bitIndex = flatNet.refVar.bitIndex;
+      return net;
+    };
+    std::unique_ptr<Scope> getSubScope(const Scope &scope,
+                                       const uint32_t &subModInsIndex) const
+    {
+      const auto &oneMod = _hierNetlist[scope.modDefIndex];
+      std::unique_ptr<Scope> subScope(new Scope);
+      subScope->modDefIndex = oneMod.subModuleDefIndexs[subModInsIndex];
+      subScope->prefix =
+        scope.prefix + oneMod.subModuleInstanceNames[subModInsIndex] + "/";
+      const auto &portAssignments =
+        oneMod.portAssignmentsOfSubModInss[subModInsIndex];
+      subScope->portNets.resize(portAssignments.size());
+      for(uint32_t portDefIndex = 0; portDefIndex < portAssignments.size();
+          portDefIndex++)
+      {
+        for(const auto &refVar: portAssignments[portDefIndex].refVars)
+          subScope->portNets[portDefIndex].push_back(getFlatNet(scope, refVar));
+      }
+      return subScope;
+    };
+
+  public:
+    // One part of the whole output, which is written by one thread
+    struct Chunk
+    {
+        std::unique_ptr<SpillFile> spillFiles[TOTAL_FLAT_MOD_PARTS];
+        NetlistWriter writers[TOTAL_FLAT_MOD_PARTS];
+        // Names and nets being printed, only to reuse their memory
+        std::string names[2];
+        std::vector<FlatNet> flatNets;
+    };
+    OutOfCoreFlattener(const std::vector<Module> &hierNetlist,
+                       const uint32_t &totalUsedBlackBoxes,
+                       const int &flattenDepth,
+                       const V3StringSet &keptModDefNames,
+                       const std::string &spillDirName)
+      : _hierNetlist(hierNetlist), _totalUsedBlackBoxes(totalUsedBlackBoxes),
+        _flattenDepth(flattenDepth), _keptModDefNames(keptModDefNames),
+        _spillDirName(spillDirName){};
+    void flush(Chunk &chunk, const bool &isForced = false) const
+    {
+      for(uint32_t part = 0; part < TOTAL_FLAT_MOD_PARTS; part++)
+      {
+        auto &buffer = chunk.writers[part].getBuffer();
+        if(buffer.empty() ||
+           (!isForced && buffer.size() < NETLIST_WRITER_BUFFER_BYTES))
+          continue;
+        if(!chunk.spillFiles[part])
+          chunk.spillFiles[part].reset(new SpillFile(_spillDirName));
+        chunk.spillFiles[part]->write(buffer);
+        buffer.clear();
+      }
+    };
+    // Print the instances of the root scope in [insBegin, insEnd), and the
+    // wires and the assign statements of the inlined ones.
+    void flattenInss(const Scope &root, const uint32_t &insBegin,
+                     const uint32_t &insEnd, Chunk &chunk) const
+    {
+      for(uint32_t subModInsIndex = insBegin; subModInsIndex < insEnd;
+          subModInsIndex++)
+        flattenIns(root, subModInsIndex, chunk);
+      flush(chunk, true);
+    };
+    // The same order as flattenHierNet, a flattened module has the wires and
+    // the assign statements of its own first, and then the ones of its sub
+    // modules in the order of instances.
+    void flattenIns(const Scope &scope, const uint32_t &subModInsIndex,
+                    Chunk &chunk) const
+    {
+      const auto &oneMod = _hierNetlist[scope.modDefIndex];
+      const auto &subModDefIndex = oneMod.subModuleDefIndexs[subModInsIndex];
+      if(isInlined(scope.modDefIndex, subModDefIndex))
+      {
+        flattenScope(*getSubScope(scope, subModInsIndex), chunk);
+        return;
+      }
+      // A black box or a hard macro, a pin is unconnected if one of its bits
+      // is unconnected.
+      const auto &subMod = _hierNetlist[subModDefIndex];
+      const auto &portAssignments =
+        oneMod.portAssignmentsOfSubModInss[subModInsIndex];
+      auto &writer = chunk.writers[INSTANCES];
+      auto &insName = chunk.names[0];
+      insName.assign(scope.prefix)
+        .append(oneMod.subModuleInstanceNames[subModInsIndex]);
+      writer.writeInsBegin(subMod.moduleDefName, insName);
+      auto &flatNets = chunk.flatNets;
+      for(uint32_t portDefIndex = 0; portDefIndex < portAssignments.size();
+          portDefIndex++)
+      {
+        const auto &refVars = portAssignments[portDefIndex].refVars;
+        flatNets.clear();
+        for(const auto &refVar: refVars)
+        {
+          flatNets.push_back(getFlatNet(scope, refVar));
+          if(flatNets.back().isUnconnected)
+          {
+            flatNets.clear();
+            break;
+          }
+        }
+        writer.writePinBegin(subMod.ports[portDefIndex].portDefName,
+                             flatNets.size());
+        for(uint32_t bitIndex = flatNets.size(); bitIndex > 0; bitIndex--)
+          writer.writePinNet(
+            getPrintedNet(flatNets[bitIndex - 1], chunk.names[1]));
+        writer.writePinEnd(flatNets.size());
+      }
+      writer.writeInsEnd();
+      flush(chunk);
+    };
+    void flattenScope(const Scope &scope, Chunk &chunk) const
+    {
+      const auto &oneMod = _hierNetlist[scope.modDefIndex];
+      for(uint32_t portDefIndex = oneMod.totalPortsExcludingWires;
+          portDefIndex < oneMod.ports.size(); portDefIndex++)
+      {
+        const auto &port = oneMod.ports[portDefIndex];
+        chunk.writers[WIRES].writePortDef(port,
+                                          scope.prefix + port.portDefName);
+      }
+      // An assign statement connected to an empty port is removed.
+      for(const auto &oneAssign: oneMod.assigns)
+      {
+        const FlatNet lNet = getFlatNet(scope, oneAssign.lValue);
+        const FlatNet rNet = getFlatNet(scope, oneAssign.rValue);
+        if(lNet.isUnconnected || rNet.isUnconnected)
+          continue;
+        chunk.writers[ASSIGNS].writeAssign(
+          getPrintedNet(lNet, chunk.names[0]),
+          getPrintedNet(rNet, chunk.names[1]));
+      }
+      for(uint32_t subModInsIndex = 0;
+          subModInsIndex < oneMod.subModuleDefIndexs.size(); subModInsIndex++)
+        flattenIns(scope, subModInsIndex, chunk);
+    };
+};
+
+} // namespace
+
+// A top module or a hard macro is printed in chunks of its instances. A
+// chunk has three spill files for its wires, assign statements and
+// instances, which are copied to fileName after all chunks are printed.
+void VerilogNetlist::printFlatNetOutOfCore(const std::string &spillDirName,
+                                           const int &flattenDepth,
+                                           const V3StringSet &keptModDefNames,
+                                           const uint32_t &totalThreads,
+                                           std::string fileName)
+{
+  const auto &hierNetlist = _hierNetlist;
+  OutOfCoreFlattener flattener(hierNetlist, _totalUsedBlackBoxes,
+                               flattenDepth, keptModDefNames, spillDirName);
+  // The same modules as markModsInFlatNet
+  std::vector<bool> isPrinted(hierNetlist.size(), false);
+  for(uint32_t modDefIndex = _totalUsedBlackBoxes;
+      modDefIndex < hierNetlist.size(); modDefIndex++)
+  {
+    if(hierNetlist[modDefIndex].level ==
+       hierNetlist[_totalUsedBlackBoxes].level)
+      isPrinted[modDefIndex] = true;
+    for(const auto &subModDefIndex: hierNetlist[modDefIndex].subModuleDefIndexs)
+    {
+      if(subModDefIndex >= _totalUsedBlackBoxes &&
+         isHardMacro(hierNetlist, _totalUsedBlackBoxes, flattenDepth,
+                     keptModDefNames, modDefIndex, subModDefIndex))
+        isPrinted[subModDefIndex] = true;
+    }
+  }
+  const uint32_t totalChunksEveryMod = getTotalNetlistThreads(totalThreads) * 2;
+  auto os = openNetlistOutput(fileName);
+  NetlistWriter writer(os.get());
+  writer.setGroupingBuses(v3Global.opt.netlistGroupBuses());
+  for(uint32_t modDefIndex = _totalUsedStdCells;
+      modDefIndex < hierNetlist.size(); modDefIndex++)
+  {
+    const auto &oneMod = hierNetlist[modDefIndex];
+    if(modDefIndex < _totalUsedBlackBoxes)
+    {
+      writer.writeModule(hierNetlist, oneMod);
+      continue;
+    }
+    if(!isPrinted[modDefIndex])
+      continue;
+    Scope root;
+    root.modDefIndex = modDefIndex;
+    const uint32_t totalInss = oneMod.subModuleDefIndexs.size();
+    std::vector<OutOfCoreFlattener::Chunk> chunks(
+      std::min(totalInss, totalChunksEveryMod));
+    for(auto &chunk: chunks)
+    {
+      for(auto &chunkWriter: chunk.writers)
+        chunkWriter.setGroupingBuses(v3Global.opt.netlistGroupBuses());
+    }
+    parallelFor(0, chunks.size(), totalThreads,
+                [&](const uint32_t &chunkIndex)
+                {
+                  flattener.flattenInss(
+                    root, uint64_t(totalInss) * chunkIndex / chunks.size(),
+                    uint64_t(totalInss) * (chunkIndex + 1) / chunks.size(),
+                    chunks[chunkIndex]);
+                });
+    writer.writeModuleBegin(oneMod);
+    for(const auto &port: oneMod.ports)
+      writer.writePortDef(port);
+    auto copyChunks = [&](const FlatModPart &part)
+    {
+      writer.flush(*os);
+      for(auto &chunk: chunks)
+      {
+        if(chunk.spillFiles[part])
+          chunk.spillFiles[part]->copyTo(*os);
+        chunk.spillFiles[part].reset();
+      }
+    };
+    copyChunks(WIRES);
+    for(const auto &oneAssign: oneMod.assigns)
+      writer.writeAssign(getPrintedNet(oneMod, oneAssign.lValue),
+                         getPrintedNet(oneMod, oneAssign.rValue));
+    copyChunks(ASSIGNS);
+    copyChunks(INSTANCES);
+    writer.writeModuleEnd();
+    writer.flush(*os);
+  }
+  writer.flush(*os);
+}
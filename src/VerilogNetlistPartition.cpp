@@ -0,0 +1,80 @@
+/*************************************************************************
+  > File Name: VerilogNetlistPartition.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "NetlistHypergraph.h"
+#include "NetlistPartition.h"
+#include "VerilogNetlist.h"
+#include <fstream>
+
+namespace
+{
+
+// Every block weighs at most 5% more than its share.
+const double partitionImbalance = 0.05;
+
+} // namespace
+
+void VerilogNetlist::partitionFlatNet(
+  const std::vector<Module> &flatNetlist,
+  const std::vector<UsedStdCell> &usedStdCells, const uint32_t &totalBlocks,
+  const uint32_t &totalThreads, std::string reportName)
+{
+  std::ofstream ofs(reportName);
+  if(flatNetlist.size() <= _totalUsedBlackBoxes)
+    return;
+  const auto &flatMod = flatNetlist[_totalUsedBlackBoxes];
+  const NetlistHypergraph hypergraph = buildNetlistHypergraph(
+    flatNetlist, _totalUsedBlackBoxes, _totalUsedBlackBoxes, usedStdCells);
+  const std::vector<uint32_t> blocks = partitionHypergraph(
+    hypergraph, totalBlocks, partitionImbalance, totalThreads);
+
+  // Connectivity minus 1 of a hyperedge is the number of extra blocks it
+  // spans.
+  uint64_t totalCutEdges = 0;
+  uint64_t totalConnectivity = 0;
+  std::vector<uint32_t> lastEdgeOfBlocks(totalBlocks, UINT32_MAX);
+  for(uint32_t edgeId = 0; edgeId < hypergraph.getTotalEdges(); edgeId++)
+  {
+    uint32_t connectivity = 0;
+    for(uint32_t pinIndex = hypergraph.edgeStarts[edgeId];
+        pinIndex < hypergraph.edgeStarts[edgeId + 1]; pinIndex++)
+    {
+      const uint32_t block = blocks[hypergraph.edgePins[pinIndex]];
+      if(lastEdgeOfBlocks[block] == edgeId)
+        continue;
+      lastEdgeOfBlocks[block] = edgeId;
+      connectivity++;
+    }
+    totalCutEdges += connectivity > 1;
+    totalConnectivity += connectivity - 1;
+  }
+  std::vector<uint32_t> blockInss(totalBlocks, 0);
+  std::vector<uint64_t> blockWeights(totalBlocks, 0);
+  for(uint32_t insIndex = 0; insIndex < blocks.size(); insIndex++)
+  {
+    blockInss[blocks[insIndex]]++;
+    blockWeights[blocks[insIndex]] += hypergraph.vertexWeights.empty()
+                                        ? 1
+                                        : hypergraph.vertexWeights[insIndex];
+  }
+
+  ofs << "// Partition of module " << flatMod.moduleDefName << std::endl;
+  ofs << "// Total instances: " << blocks.size()
+      << ", total nets: " << hypergraph.getTotalEdges()
+      << ", total blocks: " << totalBlocks << std::endl;
+  ofs << "// Cut nets: " << totalCutEdges
+      << ", sum of (connectivity - 1): " << totalConnectivity << std::endl;
+  ofs << "// Block, instances, weight" << std::endl;
+  for(uint32_t block = 0; block < totalBlocks; block++)
+    ofs << block << " " << blockInss[block] << " " << blockWeights[block]
+        << std::endl;
+  ofs << std::endl;
+  ofs << "// Instance, block" << std::endl;
+  for(uint32_t insIndex = 0; insIndex < blocks.size(); insIndex++)
+    ofs << flatMod.subModuleInstanceNames[insIndex] << " " << blocks[insIndex]
+        << std::endl;
+}
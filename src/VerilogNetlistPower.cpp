@@ -0,0 +1,697 @@
+/*************************************************************************
+  > File Name: VerilogNetlistPower.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include "NetlistParallel.h"
+#include "VerilogNetlist.h"
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <unordered_map>
+
+namespace
+{
+
+// Functions with more inputs aren't enumerated, their outputs are sources.
+const uint32_t maxFunctionInputs = 10;
+// Instances of one level are handed to threads in chunks.
+const uint32_t activityChunkInss = 1024;
+// A net set which is driven by more than one pin is a source.
+const uint8_t manyDrivers = 2;
+
+// The signal probability is the probability of a net being 1, and the
+// transition density is the expected number of its transitions in a clock
+// cycle.
+struct Activity
+{
+    double probability;
+    double density;
+};
+
+// Defaults of primary inputs and of outputs of other sources, such as flip
+// flops, latches and macros, which are input and reg in an activity file.
+const Activity defaultInputActivity = { 0.5, 0.2 };
+const Activity defaultRegActivity = { 0.5, 0.1 };
+
+// The truth table of an output pin over the different inputs of its
+// function, inputs[i] is bit i of a minterm. values is empty if the pin has
+// no function or too many inputs.
+struct TruthTable
+{
+    std::vector<uint32_t> inputs;
+    std::vector<uint8_t> values;
+};
+
+struct ActivityFile
+{
+    Activity inputActivity = defaultInputActivity;
+    Activity regActivity = defaultRegActivity;
+    // Nets or instances
+    std::vector<std::pair<std::string, Activity>> namedActivities;
+};
+
+// Lines are "<name> <probability> <density>", name is a net, an instance
+// whose outputs get the activity, or input and reg for the defaults.
+ActivityFile readActivityFile(const std::string &fileName)
+{
+  ActivityFile activityFile;
+  if(fileName.empty())
+    return activityFile;
+  std::ifstream ifs(fileName);
+  if(!ifs)
+    throw std::runtime_error("Can not open activity file " + fileName);
+  std::string line;
+  uint32_t lineNo = 0;
+  while(std::getline(ifs, line))
+  {
+    lineNo++;
+    std::istringstream iss(line.substr(0, line.find('#')));
+    std::string name;
+    if(!(iss >> name))
+      continue;
+    Activity activity;
+    std::string rest;
+    if(!(iss >> activity.probability >> activity.density) || (iss >> rest) ||
+       activity.probability < 0 || activity.probability > 1 ||
+       activity.density < 0)
+      throw std::runtime_error(fileName + ":" + std::to_string(lineNo) +
+                               ": wrong activity of " + name);
+    if(name == "input")
+      activityFile.inputActivity = activity;
+    else if(name == "reg")
+      activityFile.regActivity = activity;
+    else
+      activityFile.namedActivities.emplace_back(name, activity);
+  }
+  return activityFile;
+}
+
+// Build the truth tables of the output pins of every used std cell.
+std::vector<std::vector<TruthTable>>
+buildTruthTables(const std::vector<Module> &netlist,
+                 const std::vector<UsedStdCell> &usedStdCells)
+{
+  std::vector<std::vector<TruthTable>> truthTables(usedStdCells.size());
+  for(uint32_t stdCellIndex = 0; stdCellIndex < usedStdCells.size();
+      stdCellIndex++)
+  {
+    const auto &usedStdCell = usedStdCells[stdCellIndex];
+    const auto &stdCell = netlist[stdCellIndex];
+    auto &tables = truthTables[stdCellIndex];
+    tables.resize(usedStdCell.functions.size());
+    std::vector<char> portValues(stdCell.ports.size(), CHAR_X);
+    for(uint32_t portDefIndex = stdCell.totalInputs;
+        portDefIndex < usedStdCell.functions.size(); portDefIndex++)
+    {
+      const auto &function = usedStdCell.functions[portDefIndex];
+      auto &table = tables[portDefIndex];
+      for(const auto &token: function.getTokens())
+      {
+        if(token.op == CellFunction::Op::INPUT &&
+           std::find(table.inputs.begin(), table.inputs.end(),
+                     token.portDefIndex) == table.inputs.end())
+          table.inputs.push_back(token.portDefIndex);
+      }
+      if(function.empty() || table.inputs.size() > maxFunctionInputs)
+        continue;
+      const uint32_t totalMinterms = 1u << table.inputs.size();
+      table.values.resize(totalMinterms);
+      for(uint32_t minterm = 0; minterm < totalMinterms; minterm++)
+      {
+        for(uint32_t inputIndex = 0; inputIndex < table.inputs.size();
+            inputIndex++)
+          portValues[table.inputs[inputIndex]] =
+            minterm >> inputIndex & 1 ? CHAR_ONE : CHAR_ZERO;
+        table.values[minterm] = function.evalConst(portValues) == CHAR_ONE;
+      }
+    }
+  }
+  return truthTables;
+}
+
+// With independent inputs, the probability of the output is the sum of the
+// probabilities of its minterms which are 1, and its density is the sum of
+// the densities of inputs weighted by the probabilities of their boolean
+// differences (Najm). minterms has 2^maxFunctionInputs items.
+Activity propagateActivity(const TruthTable &table, const Activity *inputs,
+                           double *minterms)
+{
+  const uint32_t totalInputs = table.inputs.size();
+  const uint32_t totalMinterms = 1u << totalInputs;
+  const uint8_t *values = table.values.data();
+  minterms[0] = 1;
+  for(uint32_t inputIndex = 0; inputIndex < totalInputs; inputIndex++)
+  {
+    const uint32_t half = 1u << inputIndex;
+    const double probability = inputs[inputIndex].probability;
+    for(uint32_t minterm = 0; minterm < half; minterm++)
+    {
+      minterms[minterm | half] = minterms[minterm] * probability;
+      minterms[minterm] *= 1 - probability;
+    }
+  }
+  Activity output = { 0, 0 };
+  for(uint32_t minterm = 0; minterm < totalMinterms; minterm++)
+    output.probability += values[minterm] * minterms[minterm];
+  // The boolean difference of input i is 1 in the minterms whose output
+  // changes with bit i, and the pair of minterms weighs the probability of
+  // the other inputs.
+  for(uint32_t inputIndex = 0; inputIndex < totalInputs; inputIndex++)
+  {
+    const uint32_t bit = 1u << inputIndex;
+    double difference = 0;
+    for(uint32_t minterm = 0; minterm < totalMinterms; minterm++)
+    {
+      const uint32_t pair = minterm | bit;
+      difference += (minterm != pair && values[minterm] != values[pair]) *
+                    (minterms[minterm] + minterms[pair]);
+    }
+    output.density += difference * inputs[inputIndex].density;
+  }
+  return output;
+}
+
+// A hierarchical instance which is inlined into a flattened module, like U1
+// and U1/U0 of ripple_adder in case2.
+struct HierIns
+{
+  uint32_t parentHierInsIndex;
+  uint32_t modDefIndex;
+  std::string name;
+};
+
+// Instances are inlined in the same order as a depth first search of the
+// hierarchy, see flattenHierNet, so the search finds the hierarchical
+// instances of a flattened module, parents before their children, and
+// insHierInsIndexs[insIndex], the deepest one of every instance, UINT32_MAX
+// if it is instanced by the module itself. Instances removed by sweep or
+// strash are skipped by name. Return false if an instance isn't found.
+bool findHierInss(const std::vector<Module> &hierNetlist,
+                  const uint32_t &totalUsedBlackBoxes, const int &flattenDepth,
+                  const V3StringSet &keptModDefNames,
+                  const uint32_t &flatModDefIndex, const Module &flatMod,
+                  std::vector<HierIns> &hierInss,
+                  std::vector<uint32_t> &insHierInsIndexs)
+{
+  const auto &insNames = flatMod.subModuleInstanceNames;
+  insHierInsIndexs.assign(insNames.size(), UINT32_MAX);
+  uint32_t insIndex = 0;
+  // U1/U0/ while the instances of U1/U0 are searched
+  std::string path;
+  std::function<void(const uint32_t &, const uint32_t &)> addInss =
+    [&](const uint32_t &modDefIndex, const uint32_t &hierInsIndex)
+  {
+    const auto &oneModH = hierNetlist[modDefIndex];
+    const size_t pathLength = path.size();
+    for(uint32_t subModInsIndex = 0;
+        subModInsIndex < oneModH.subModuleDefIndexs.size(); subModInsIndex++)
+    {
+      const auto &subModDefIndex = oneModH.subModuleDefIndexs[subModInsIndex];
+      path += oneModH.subModuleInstanceNames[subModInsIndex];
+      if(subModDefIndex < totalUsedBlackBoxes ||
+         VerilogNetlist::isHardMacro(hierNetlist, totalUsedBlackBoxes,
+                                     flattenDepth, keptModDefNames,
+                                     modDefIndex, subModDefIndex))
+      {
+        if(insIndex < insNames.size() && insNames[insIndex] == path)
+          insHierInsIndexs[insIndex++] = hierInsIndex;
+      }
+      else
+      {
+        hierInss.push_back({hierInsIndex, subModDefIndex, path});
+        path += "/";
+        addInss(subModDefIndex, hierInss.size() - 1);
+      }
+      path.resize(pathLength);
+    }
+  };
+  addInss(flatModDefIndex, UINT32_MAX);
+  return insIndex == insNames.size();
+}
+
+} // namespace
+
+// Probabilistic switching activity of the flattened modules in one pass.
+// Primary inputs, net sets with several or no drivers, and outputs of
+// instances other than combinational, tristate, power and tie cells are
+// sources with the defaults or the activities given in activityFileName.
+// 1. Levelization: an instance depends on the instances driving its inputs,
+//    and levels are peeled off from instances without dependences. Instances
+//    left are on or after combinational loops, they are computed last in
+//    one level in order, and a net set of them is read as probability 0.5
+//    and density 0 until it is computed.
+// 2. Propagation: every level is computed in parallel, the output of an
+//    instance is found from the truth table of its function, see
+//    propagateActivity, and its density is bounded by the largest density
+//    of sources.
+// 3. Roll-ups: the switched loads of a net set, its density times its
+//    loads, is added to its driver, and then up the hierarchical instances
+//    of the flattened module, see findHierInss, to every hierarchical
+//    instance and module of hierNetlist.
+void VerilogNetlist::estimateActivity(
+  const std::vector<Module> &hierNetlist,
+  const std::vector<Module> &flatNetlist,
+  const std::vector<UsedStdCell> &usedStdCells, const int &flattenDepth,
+  const V3StringSet &keptModDefNames,
+  const std::string &activityFileName, const uint32_t &totalThreads,
+  std::string reportName)
+{
+  std::ofstream ofs(reportName);
+  const ActivityFile activityFile = readActivityFile(activityFileName);
+  const std::vector<std::vector<TruthTable>> truthTables =
+    buildTruthTables(flatNetlist, usedStdCells);
+  std::vector<bool> isNameFound(activityFile.namedActivities.size(), false);
+  // Entries of every name, nets are split into the port and the bit.
+  std::unordered_map<std::string, std::vector<uint32_t>> entriesOfInsNames;
+  std::unordered_map<std::string, std::vector<std::pair<uint32_t, uint32_t>>>
+    entriesOfPortNames;
+  for(uint32_t entryIndex = 0;
+      entryIndex < activityFile.namedActivities.size(); entryIndex++)
+  {
+    const std::string &name = activityFile.namedActivities[entryIndex].first;
+    entriesOfInsNames[name].push_back(entryIndex);
+    std::string portDefName;
+    uint32_t bitIndex;
+    FlatNetlistIndex::splitNetName(name, portDefName, bitIndex);
+    entriesOfPortNames[name].push_back({ entryIndex, UINT32_MAX });
+    if(bitIndex != UINT32_MAX)
+      entriesOfPortNames[portDefName].push_back({ entryIndex, bitIndex });
+  }
+
+  for(uint32_t flatModDefIndex = _totalUsedBlackBoxes;
+      flatModDefIndex < flatNetlist.size(); flatModDefIndex++)
+  {
+    if(!isInFlatNet(flatModDefIndex))
+      continue;
+    const auto &flatMod = flatNetlist[flatModDefIndex];
+    const uint32_t totalInss = flatMod.subModuleDefIndexs.size();
+    FlatNetlistIndex index(flatNetlist, flatModDefIndex);
+    NetUnionFind netUnionFind(index.getTotalNets());
+    netUnionFind.uniteAssigns(index, flatMod);
+    const uint32_t totalNets = index.getTotalNets();
+    // Roots are found once, so tasks only read them.
+    std::vector<uint32_t> netRootIds(totalNets);
+    for(uint32_t netId = 0; netId < totalNets; netId++)
+      netRootIds[netId] = netUnionFind.find(netId);
+    auto getUsedStdCell = [&](const uint32_t &insIndex) -> const UsedStdCell &
+    { return usedStdCells[flatMod.subModuleDefIndexs[insIndex]]; };
+    auto isComputed = [&](const uint32_t &insIndex)
+    {
+      const StdCellKind &kind = getUsedStdCell(insIndex).kind;
+      return kind == StdCellKind::COMBINATIONAL ||
+             kind == StdCellKind::TRISTATE || kind == StdCellKind::POWER ||
+             kind == StdCellKind::TIE;
+    };
+    // Call onePin(portDefIndex, bitIndex, netRootId) for every connected pin
+    // of an instance whose portDefIndex is in [beginPort, endPort).
+    auto forEachPin = [&](const uint32_t &insIndex, const uint32_t &beginPort,
+                          const uint32_t &endPort, auto &&onePin)
+    {
+      const auto &portAssignments =
+        flatMod.portAssignmentsOfSubModInss[insIndex];
+      for(uint32_t portDefIndex = beginPort; portDefIndex < endPort;
+          portDefIndex++)
+      {
+        const auto &refVars = portAssignments[portDefIndex].refVars;
+        for(uint32_t bitIndex = 0; bitIndex < refVars.size(); bitIndex++)
+          onePin(portDefIndex, bitIndex,
+                 netRootIds[index.getNetId(refVars[bitIndex])]);
+      }
+    };
+    auto getStdCell = [&](const uint32_t &insIndex) -> const Module &
+    { return flatNetlist[flatMod.subModuleDefIndexs[insIndex]]; };
+
+    // Drivers and loads of every net set, primary inputs are drivers, too.
+    std::vector<FlatPin> rootDriverPins(totalNets,
+                                        { UINT32_MAX, UINT32_MAX, 0 });
+    std::vector<uint8_t> rootTotalDrivers(totalNets, 0);
+    std::vector<uint32_t> rootTotalLoads(totalNets, 0);
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      const auto &stdCell = getStdCell(insIndex);
+      forEachPin(insIndex, stdCell.totalInputs,
+                 stdCell.totalPortsExcludingWires,
+                 [&](uint32_t portDefIndex, uint32_t bitIndex,
+                     uint32_t netRootId)
+                 {
+                   if(rootTotalDrivers[netRootId]++)
+                     rootTotalDrivers[netRootId] = manyDrivers;
+                   rootDriverPins[netRootId] = { insIndex, portDefIndex,
+                                                 bitIndex };
+                 });
+      forEachPin(insIndex, 0, stdCell.totalInputsAndInouts,
+                 [&](uint32_t, uint32_t, uint32_t netRootId)
+                 { rootTotalLoads[netRootId]++; });
+    }
+    for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts();
+        netId++)
+    {
+      if(index.getRefVar(netId).refVarDefIndex >= flatMod.totalInputsAndInouts)
+        continue;
+      const uint32_t netRootId = netRootIds[netId];
+      if(rootTotalDrivers[netRootId]++)
+        rootTotalDrivers[netRootId] = manyDrivers;
+      rootDriverPins[netRootId].insIndex = UINT32_MAX;
+    }
+
+    // Sources are fixed, other net sets are computed from their drivers.
+    std::vector<Activity> activities(totalNets, { 0.5, 0 });
+    std::vector<uint8_t> isFixed(totalNets, 0);
+    const uint32_t constNetId = index.getTotalNetsExcludingConsts();
+    activities[constNetId] = { 0, 0 };     // 1'b0
+    activities[constNetId + 1] = { 1, 0 }; // 1'b1
+    for(uint32_t netRootId = 0; netRootId < totalNets; netRootId++)
+    {
+      const FlatPin &driverPin = rootDriverPins[netRootId];
+      if(index.isConstNet(netRootId) || rootTotalDrivers[netRootId] == 0)
+        isFixed[netRootId] = true;
+      else if(rootTotalDrivers[netRootId] == manyDrivers ||
+              driverPin.insIndex == UINT32_MAX)
+      {
+        isFixed[netRootId] = true;
+        activities[netRootId] = activityFile.inputActivity;
+      }
+      else if(!isComputed(driverPin.insIndex) ||
+              truthTables[flatMod.subModuleDefIndexs[driverPin.insIndex]]
+                         [driverPin.portDefIndex]
+                           .values.empty())
+      {
+        isFixed[netRootId] = true;
+        activities[netRootId] = activityFile.regActivity;
+      }
+    }
+    // Named activities of nets and outputs of instances
+    auto fixActivity = [&](const uint32_t &netRootId, const uint32_t &entry)
+    {
+      if(index.isConstNet(netRootId))
+        return;
+      isFixed[netRootId] = true;
+      activities[netRootId] = activityFile.namedActivities[entry].second;
+      isNameFound[entry] = true;
+    };
+    if(!entriesOfInsNames.empty())
+    {
+      for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+      {
+        const auto entries =
+          entriesOfInsNames.find(flatMod.subModuleInstanceNames[insIndex]);
+        if(entries == entriesOfInsNames.end())
+          continue;
+        const auto &stdCell = getStdCell(insIndex);
+        for(const auto &entry: entries->second)
+          forEachPin(insIndex, stdCell.totalInputs,
+                     stdCell.totalPortsExcludingWires,
+                     [&](uint32_t, uint32_t, uint32_t netRootId)
+                     { fixActivity(netRootId, entry); });
+      }
+      for(uint32_t portDefIndex = 0; portDefIndex < flatMod.ports.size();
+          portDefIndex++)
+      {
+        const auto &port = flatMod.ports[portDefIndex];
+        const auto entries = entriesOfPortNames.find(port.portDefName);
+        if(entries == entriesOfPortNames.end())
+          continue;
+        RefVar refVar;
+        refVar.refVarDefIndex = portDefIndex;
+        for(const auto &entry: entries->second)
+        {
+          refVar.bitIndex = entry.second == UINT32_MAX ? 0 : entry.second;
+          if(port.isVector != (entry.second != UINT32_MAX) ||
+             refVar.bitIndex >= port.bitWidth)
+            continue;
+          fixActivity(netRootIds[index.getNetId(refVar)], entry.first);
+        }
+      }
+    }
+
+    // An instance depends on the instances driving its inputs, dependences
+    // of an instance are in [dependentStarts[i], dependentStarts[i + 1]) of
+    // dependents.
+    auto forEachDependence = [&](auto &&oneDependence)
+    {
+      for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+      {
+        if(!isComputed(insIndex))
+          continue;
+        forEachPin(insIndex, 0, getStdCell(insIndex).totalInputsAndInouts,
+                   [&](uint32_t, uint32_t, uint32_t netRootId)
+                   {
+                     if(!isFixed[netRootId])
+                       oneDependence(rootDriverPins[netRootId].insIndex,
+                                     insIndex);
+                   });
+      }
+    };
+    std::vector<uint32_t> dependentStarts(totalInss + 1, 0);
+    std::vector<uint32_t> totalDependences(totalInss, 0);
+    forEachDependence(
+      [&](uint32_t driverInsIndex, uint32_t insIndex)
+      {
+        dependentStarts[driverInsIndex + 1]++;
+        totalDependences[insIndex]++;
+      });
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+      dependentStarts[insIndex + 1] += dependentStarts[insIndex];
+    std::vector<uint32_t> dependents(dependentStarts.back());
+    std::vector<uint32_t> dependentEnds(dependentStarts.begin(),
+                                        dependentStarts.end() - 1);
+    forEachDependence(
+      [&](uint32_t driverInsIndex, uint32_t insIndex)
+      { dependents[dependentEnds[driverInsIndex]++] = insIndex; });
+    // Instances of level i are in [levelStarts[i], levelStarts[i + 1]) of
+    // orderedInss.
+    std::vector<uint32_t> orderedInss;
+    std::vector<uint32_t> levelStarts = { 0 };
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      if(isComputed(insIndex) && !totalDependences[insIndex])
+        orderedInss.push_back(insIndex);
+    }
+    while(levelStarts.back() < orderedInss.size())
+    {
+      const uint32_t levelEnd = orderedInss.size();
+      for(uint32_t order = levelStarts.back(); order < levelEnd; order++)
+      {
+        const uint32_t driverInsIndex = orderedInss[order];
+        for(uint32_t dependentIndex = dependentStarts[driverInsIndex];
+            dependentIndex < dependentStarts[driverInsIndex + 1];
+            dependentIndex++)
+        {
+          if(!--totalDependences[dependents[dependentIndex]])
+            orderedInss.push_back(dependents[dependentIndex]);
+        }
+      }
+      levelStarts.push_back(levelEnd);
+    }
+    const uint32_t totalLevels = levelStarts.size() - 1;
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      if(totalDependences[insIndex])
+        orderedInss.push_back(insIndex);
+    }
+    const uint32_t totalLoopInss = orderedInss.size() - levelStarts.back();
+
+    // Densities of reconvergent paths are added up again and again, so a
+    // computed density is bounded by the largest density of sources.
+    double maxDensity = std::max(activityFile.inputActivity.density,
+                                 activityFile.regActivity.density);
+    for(const auto &namedActivity: activityFile.namedActivities)
+      maxDensity = std::max(maxDensity, namedActivity.second.density);
+    auto computeIns = [&](const uint32_t &insIndex, double *minterms)
+    {
+      const auto &tables = truthTables[flatMod.subModuleDefIndexs[insIndex]];
+      const auto &portAssignments =
+        flatMod.portAssignmentsOfSubModInss[insIndex];
+      Activity inputs[maxFunctionInputs];
+      forEachPin(
+        insIndex, getStdCell(insIndex).totalInputs, tables.size(),
+        [&](uint32_t portDefIndex, uint32_t bitIndex, uint32_t netRootId)
+        {
+          const TruthTable &table = tables[portDefIndex];
+          if(isFixed[netRootId])
+            return;
+          for(uint32_t inputIndex = 0; inputIndex < table.inputs.size();
+              inputIndex++)
+          {
+            // A bus of cells drives every bit from the same bit.
+            const auto &refVars =
+              portAssignments[table.inputs[inputIndex]].refVars;
+            inputs[inputIndex] =
+              refVars.empty()
+                ? Activity{ 0.5, 0 }
+                : activities[netRootIds[index.getNetId(
+                    refVars[bitIndex < refVars.size() ? bitIndex : 0])]];
+          }
+          activities[netRootId] = propagateActivity(table, inputs, minterms);
+          activities[netRootId].density =
+            std::min(activities[netRootId].density, maxDensity);
+        });
+    };
+    for(uint32_t level = 0; level < totalLevels; level++)
+    {
+      const uint32_t levelBegin = levelStarts[level];
+      const uint32_t levelEnd = levelStarts[level + 1];
+      parallelFor(0, (levelEnd - levelBegin + activityChunkInss - 1) /
+                       activityChunkInss,
+                  totalThreads,
+                  [&](uint32_t chunkIndex)
+                  {
+                    std::vector<double> minterms(1u << maxFunctionInputs);
+                    const uint32_t chunkBegin =
+                      levelBegin + chunkIndex * activityChunkInss;
+                    const uint32_t chunkEnd =
+                      std::min(levelEnd, chunkBegin + activityChunkInss);
+                    for(uint32_t order = chunkBegin; order < chunkEnd; order++)
+                      computeIns(orderedInss[order], minterms.data());
+                  });
+    }
+    std::vector<double> minterms(1u << maxFunctionInputs);
+    for(uint32_t order = levelStarts.back(); order < orderedInss.size();
+        order++)
+      computeIns(orderedInss[order], minterms.data());
+
+    // Switched loads of net sets are added to their drivers, then up the
+    // hierarchical instances, whose parents are before their children.
+    std::vector<double> insSwitchedLoads(totalInss, 0);
+    double totalDensity = 0;
+    double totalSwitchedLoads = 0;
+    double inputSwitchedLoads = 0;
+    uint32_t totalComputedNets = 0;
+    uint32_t totalBoundedNets = 0;
+    for(uint32_t netRootId = 0; netRootId < constNetId; netRootId++)
+    {
+      if(netRootIds[netRootId] != netRootId)
+        continue;
+      const double switchedLoads =
+        activities[netRootId].density * rootTotalLoads[netRootId];
+      totalDensity += activities[netRootId].density;
+      totalSwitchedLoads += switchedLoads;
+      totalComputedNets += !isFixed[netRootId];
+      totalBoundedNets += !isFixed[netRootId] &&
+                          activities[netRootId].density == maxDensity;
+      if(rootTotalDrivers[netRootId] == 0)
+        continue;
+      const uint32_t driverInsIndex = rootDriverPins[netRootId].insIndex;
+      if(driverInsIndex == UINT32_MAX)
+        inputSwitchedLoads += switchedLoads;
+      else
+        insSwitchedLoads[driverInsIndex] += switchedLoads;
+    }
+
+    ofs << "// Switching activity of module " << flatMod.moduleDefName
+        << std::endl;
+    ofs << "// Primary inputs: probability "
+        << activityFile.inputActivity.probability << ", density "
+        << activityFile.inputActivity.density
+        << "; other sources: probability "
+        << activityFile.regActivity.probability << ", density "
+        << activityFile.regActivity.density << std::endl;
+    ofs << "// Levels: " << totalLevels
+        << ", instances on or after loops: " << totalLoopInss
+        << ", computed net sets: " << totalComputedNets
+        << ", at the density bound " << maxDensity << ": " << totalBoundedNets
+        << ", total density: " << totalDensity
+        << ", switched loads: " << totalSwitchedLoads
+        << ", switched loads of primary inputs: " << inputSwitchedLoads
+        << std::endl;
+    std::vector<HierIns> hierInss;
+    std::vector<uint32_t> insHierInsIndexs;
+    if(flatModDefIndex < hierNetlist.size() &&
+       hierNetlist[flatModDefIndex].moduleDefName == flatMod.moduleDefName &&
+       findHierInss(hierNetlist, _totalUsedBlackBoxes, flattenDepth,
+                    keptModDefNames, flatModDefIndex, flatMod, hierInss,
+                    insHierInsIndexs))
+    {
+      const uint32_t totalHierInss = hierInss.size();
+      std::vector<double> hierInsSwitchedLoads(totalHierInss, 0);
+      std::vector<uint32_t> hierInsTotalInss(totalHierInss, 0);
+      for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+      {
+        const uint32_t hierInsIndex = insHierInsIndexs[insIndex];
+        if(hierInsIndex == UINT32_MAX)
+          continue;
+        hierInsSwitchedLoads[hierInsIndex] += insSwitchedLoads[insIndex];
+        hierInsTotalInss[hierInsIndex]++;
+      }
+      std::vector<uint32_t> modTotalHierInss(hierNetlist.size(), 0);
+      std::vector<uint32_t> modTotalInss(hierNetlist.size(), 0);
+      std::vector<double> modSwitchedLoads(hierNetlist.size(), 0);
+      for(uint32_t hierInsIndex = totalHierInss; hierInsIndex-- > 0;)
+      {
+        const auto &hierIns = hierInss[hierInsIndex];
+        modTotalHierInss[hierIns.modDefIndex]++;
+        modTotalInss[hierIns.modDefIndex] += hierInsTotalInss[hierInsIndex];
+        modSwitchedLoads[hierIns.modDefIndex] +=
+          hierInsSwitchedLoads[hierInsIndex];
+        if(hierIns.parentHierInsIndex == UINT32_MAX)
+          continue;
+        hierInsSwitchedLoads[hierIns.parentHierInsIndex] +=
+          hierInsSwitchedLoads[hierInsIndex];
+        hierInsTotalInss[hierIns.parentHierInsIndex] +=
+          hierInsTotalInss[hierInsIndex];
+      }
+      ofs << "// Hierarchical instance, module, std cell instances, switched "
+             "loads"
+          << std::endl;
+      for(uint32_t hierInsIndex = 0; hierInsIndex < totalHierInss;
+          hierInsIndex++)
+        ofs << hierInss[hierInsIndex].name << " "
+            << hierNetlist[hierInss[hierInsIndex].modDefIndex].moduleDefName
+            << " " << hierInsTotalInss[hierInsIndex] << " "
+            << hierInsSwitchedLoads[hierInsIndex] << std::endl;
+      ofs << "// Module, hierarchical instances, std cell instances, "
+             "switched loads"
+          << std::endl;
+      for(uint32_t modDefIndex = 0; modDefIndex < hierNetlist.size();
+          modDefIndex++)
+      {
+        if(modTotalHierInss[modDefIndex])
+          ofs << hierNetlist[modDefIndex].moduleDefName << " "
+              << modTotalHierInss[modDefIndex] << " "
+              << modTotalInss[modDefIndex] << " "
+              << modSwitchedLoads[modDefIndex] << std::endl;
+      }
+    }
+    ofs << "// Net, driver, probability, density, loads" << std::endl;
+    for(uint32_t netRootId = 0; netRootId < constNetId; netRootId++)
+    {
+      if(netRootIds[netRootId] != netRootId ||
+         (!rootTotalDrivers[netRootId] && !rootTotalLoads[netRootId]))
+        continue;
+      ofs << index.getNetName(netRootId) << " ";
+      const FlatPin &driverPin = rootDriverPins[netRootId];
+      if(rootTotalDrivers[netRootId] == 0)
+        ofs << "undriven";
+      else if(rootTotalDrivers[netRootId] == manyDrivers)
+        ofs << "multiple_drivers";
+      else if(driverPin.insIndex == UINT32_MAX)
+        ofs << "input";
+      else
+      {
+        const auto &port = getStdCell(driverPin.insIndex)
+                             .ports[driverPin.portDefIndex];
+        ofs << flatMod.subModuleInstanceNames[driverPin.insIndex] << "/"
+            << port.portDefName;
+        if(port.isVector)
+          ofs << "[" << driverPin.bitIndex << "]";
+      }
+      ofs << " " << activities[netRootId].probability << " "
+          << activities[netRootId].density << " "
+          << rootTotalLoads[netRootId] << std::endl;
+    }
+    ofs << std::endl;
+  }
+  for(uint32_t entryIndex = 0; entryIndex < isNameFound.size(); entryIndex++)
+  {
+    if(!isNameFound[entryIndex])
+      throw std::runtime_error(
+        "Can't find instance or net " +
+        activityFile.namedActivities[entryIndex].first + " of " +
+        activityFileName + ".");
+  }
+}
@@ -0,0 +1,423 @@
+/*************************************************************************
+  > File Name: VerilogNetlistScanChain.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include "NetlistParallel.h"
+#include "V3Os.h"
+#include "VerilogNetlist.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+
+// A net set which is driven by more than one pin has no scan source.
+const uint8_t manyDrivers = 2;
+// Scan flops whose predecessors are traced by one task
+const uint32_t scanFlopsPerTask = 1024;
+
+// Where a scan net comes from after buffers, inverters and lockup latches.
+struct ScanSource
+{
+    uint32_t netRootId;      // The net set where tracing stops
+    uint32_t flopIndex;      // The scan flop driving it, or UINT32_MAX
+    bool isInverted;         // Odd number of inverters and QN pins
+    uint32_t totalLatches;   // Lockup latches passed
+};
+
+struct ScanChain
+{
+    std::vector<uint32_t> flopIndexs; // From scan in to scan out
+    bool isLoop = false;
+    bool isOk = false;
+};
+
+} // namespace
+
+// Scan flops are flip flops with a connected scan_in pin, see
+// StdCellLibrary.h. The scan in of every flop is traced backward to a
+// predecessor flop in parallel, then every chain is walked from its head by
+// one task. Loops are found first by following predecessors, so a loop
+// which branches to other flops is still a loop. A head is a flop off loops
+// without a predecessor, or whose predecessor feeds more than one flop, so a
+// chain breaks at a branch. Every flop is in one chain, so tracing is
+// linear.
+void VerilogNetlist::traceScanChains(
+  const std::vector<Module> &flatNetlist,
+  const std::vector<UsedStdCell> &usedStdCells, const std::string &dirName,
+  const uint32_t &totalThreads)
+{
+  V3Os::createDir(dirName);
+  const std::string reportName = dirName + "/ScanChains.txt";
+  std::ofstream ofs(reportName);
+  if(!ofs)
+    throw std::runtime_error("Can't open " + reportName + ".");
+  for(uint32_t flatModDefIndex = _totalUsedBlackBoxes;
+      flatModDefIndex < flatNetlist.size(); flatModDefIndex++)
+  {
+    if(!isInFlatNet(flatModDefIndex))
+      continue;
+    const auto &flatMod = flatNetlist[flatModDefIndex];
+    const uint32_t totalInss = flatMod.subModuleDefIndexs.size();
+    FlatNetlistIndex index(flatNetlist, flatModDefIndex);
+    NetUnionFind netUnionFind(index.getTotalNets());
+    netUnionFind.uniteAssigns(index, flatMod);
+    const uint32_t totalNets = index.getTotalNets();
+    // Roots are found once, so tasks only read them.
+    std::vector<uint32_t> netRootIds(totalNets);
+    for(uint32_t netId = 0; netId < totalNets; netId++)
+      netRootIds[netId] = netUnionFind.find(netId);
+    auto getPinRootId = [&](const uint32_t &insIndex,
+                            const uint32_t &portDefIndex,
+                            const uint32_t &bitIndex)
+    {
+      const auto &refVars =
+        flatMod.portAssignmentsOfSubModInss[insIndex][portDefIndex].refVars;
+      if(refVars.empty())
+        return UINT32_MAX;
+      // A bus of buffers or latches passes every bit to the same bit.
+      const RefVar &refVar =
+        refVars[bitIndex < refVars.size() ? bitIndex : 0];
+      return netRootIds[index.getNetId(refVar)];
+    };
+
+    // The only driver of every net set, primary inputs are drivers, too.
+    std::vector<FlatPin> rootDriverPins(totalNets,
+                                        { UINT32_MAX, UINT32_MAX, 0 });
+    std::vector<uint8_t> rootTotalDrivers(totalNets, 0);
+    // scanInPorts[flopIndex] is the scan_in pin of the flop.
+    std::vector<uint32_t> flopInss;
+    std::vector<uint32_t> scanInPorts;
+    std::vector<uint32_t> insFlopIndexs(totalInss, UINT32_MAX);
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      const uint32_t subModDefIndex = flatMod.subModuleDefIndexs[insIndex];
+      const auto &stdCell = flatNetlist[subModDefIndex];
+      const auto &usedStdCell = usedStdCells[subModDefIndex];
+      const auto &portAssignments =
+        flatMod.portAssignmentsOfSubModInss[insIndex];
+      for(uint32_t portDefIndex = stdCell.totalInputs;
+          portDefIndex < stdCell.totalPortsExcludingWires; portDefIndex++)
+      {
+        const auto &refVars = portAssignments[portDefIndex].refVars;
+        for(uint32_t bitIndex = 0; bitIndex < refVars.size(); bitIndex++)
+        {
+          const uint32_t netRootId = netRootIds[index.getNetId(
+            refVars[bitIndex])];
+          if(rootTotalDrivers[netRootId]++)
+            rootTotalDrivers[netRootId] = manyDrivers;
+          rootDriverPins[netRootId] = { insIndex, portDefIndex, bitIndex };
+        }
+      }
+      if(usedStdCell.kind != StdCellKind::FLIP_FLOP)
+        continue;
+      for(uint32_t portDefIndex = 0;
+          portDefIndex < stdCell.totalInputsAndInouts; portDefIndex++)
+      {
+        if(usedStdCell.pinRoles[portDefIndex] != PinRole::SCAN_IN ||
+           portAssignments[portDefIndex].refVars.empty())
+          continue;
+        insFlopIndexs[insIndex] = flopInss.size();
+        flopInss.push_back(insIndex);
+        scanInPorts.push_back(portDefIndex);
+        break;
+      }
+    }
+    for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts();
+        netId++)
+    {
+      if(index.getRefVar(netId).refVarDefIndex >= flatMod.totalInputsAndInouts)
+        continue;
+      const uint32_t netRootId = netRootIds[netId];
+      if(rootTotalDrivers[netRootId]++)
+        rootTotalDrivers[netRootId] = manyDrivers;
+      rootDriverPins[netRootId].insIndex = UINT32_MAX;
+    }
+    const uint32_t totalFlops = flopInss.size();
+
+    // Go backward through buffers, inverters and the data pins of lockup
+    // latches until a net set driven by something else. A loop of these
+    // cells passes at most totalInss cells.
+    auto traceBackward = [&](uint32_t netRootId)
+    {
+      ScanSource source = { netRootId, UINT32_MAX, false, 0 };
+      for(uint32_t totalSteps = 0; totalSteps <= totalInss; totalSteps++)
+      {
+        source.netRootId = netRootId;
+        const FlatPin &driverPin = rootDriverPins[netRootId];
+        if(index.isConstNet(netRootId) || rootTotalDrivers[netRootId] != 1 ||
+           driverPin.insIndex == UINT32_MAX)
+          break;
+        const uint32_t subModDefIndex =
+          flatMod.subModuleDefIndexs[driverPin.insIndex];
+        const auto &usedStdCell = usedStdCells[subModDefIndex];
+        const PinRole &role = usedStdCell.pinRoles[driverPin.portDefIndex];
+        uint32_t inputPortDefIndex = UINT32_MAX;
+        if(usedStdCell.kind == StdCellKind::FLIP_FLOP)
+        {
+          if(role == PinRole::Q || role == PinRole::QN)
+          {
+            source.flopIndex = insFlopIndexs[driverPin.insIndex];
+            source.isInverted = source.isInverted != (role == PinRole::QN);
+          }
+          break;
+        }
+        if(usedStdCell.kind == StdCellKind::COMBINATIONAL ||
+           usedStdCell.kind == StdCellKind::POWER)
+        {
+          // A buffer is Z=A and an inverter is ZN=!A.
+          const auto &tokens =
+            usedStdCell.functions[driverPin.portDefIndex].getTokens();
+          if(tokens.empty() || tokens.size() > 2 ||
+             tokens[0].op != CellFunction::Op::INPUT ||
+             (tokens.size() == 2 && tokens[1].op != CellFunction::Op::NOT))
+            break;
+          inputPortDefIndex = tokens[0].portDefIndex;
+          source.isInverted = source.isInverted != (tokens.size() == 2);
+        }
+        else if(usedStdCell.kind == StdCellKind::LATCH &&
+                (role == PinRole::Q || role == PinRole::QN))
+        {
+          const auto &stdCell = flatNetlist[subModDefIndex];
+          for(uint32_t portDefIndex = 0;
+              portDefIndex < stdCell.totalInputsAndInouts; portDefIndex++)
+          {
+            if(usedStdCell.pinRoles[portDefIndex] == PinRole::DATA)
+              inputPortDefIndex = portDefIndex;
+          }
+          source.isInverted = source.isInverted != (role == PinRole::QN);
+          source.totalLatches++;
+        }
+        if(inputPortDefIndex == UINT32_MAX)
+          break;
+        const uint32_t inputRootId = getPinRootId(
+          driverPin.insIndex, inputPortDefIndex, driverPin.bitIndex);
+        if(inputRootId == UINT32_MAX)
+          break;
+        netRootId = inputRootId;
+      }
+      return source;
+    };
+
+    // The predecessor of every flop, and its successors in compressed sparse
+    // rows: successors of flop i are in [succStarts[i], succStarts[i + 1]).
+    std::vector<ScanSource> scanInSources(totalFlops);
+    parallelFor(
+      0, (totalFlops + scanFlopsPerTask - 1) / scanFlopsPerTask, totalThreads,
+      [&](uint32_t taskIndex)
+      {
+        const uint32_t flopEnd =
+          std::min(totalFlops, (taskIndex + 1) * scanFlopsPerTask);
+        for(uint32_t flopIndex = taskIndex * scanFlopsPerTask;
+            flopIndex < flopEnd; flopIndex++)
+          scanInSources[flopIndex] = traceBackward(
+            getPinRootId(flopInss[flopIndex], scanInPorts[flopIndex], 0));
+      });
+    std::vector<uint32_t> succStarts(totalFlops + 1, 0);
+    for(const auto &source: scanInSources)
+    {
+      if(source.flopIndex != UINT32_MAX)
+        succStarts[source.flopIndex + 1]++;
+    }
+    for(uint32_t flopIndex = 0; flopIndex < totalFlops; flopIndex++)
+      succStarts[flopIndex + 1] += succStarts[flopIndex];
+    std::vector<uint32_t> succs(succStarts[totalFlops]);
+    std::vector<uint32_t> succEnds(succStarts.begin(), succStarts.end() - 1);
+    for(uint32_t flopIndex = 0; flopIndex < totalFlops; flopIndex++)
+    {
+      const uint32_t predIndex = scanInSources[flopIndex].flopIndex;
+      if(predIndex != UINT32_MAX)
+        succs[succEnds[predIndex]++] = flopIndex;
+    }
+    auto getTotalSuccs = [&](const uint32_t &flopIndex)
+    { return succStarts[flopIndex + 1] - succStarts[flopIndex]; };
+
+    // The first output port traced back to every flop is its scan out.
+    std::vector<uint32_t> scanOutNets(totalFlops, UINT32_MAX);
+    for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts();
+        netId++)
+    {
+      const uint32_t portDefIndex = index.getRefVar(netId).refVarDefIndex;
+      if(portDefIndex < flatMod.totalInputs ||
+         portDefIndex >= flatMod.totalPortsExcludingWires)
+        continue;
+      const uint32_t flopIndex = traceBackward(netRootIds[netId]).flopIndex;
+      if(flopIndex != UINT32_MAX && scanOutNets[flopIndex] == UINT32_MAX)
+        scanOutNets[flopIndex] = netId;
+    }
+
+    // Follow predecessors from every flop. Reaching a flop on the current
+    // path closes a loop, whose flops are the end of the path in reverse.
+    // visitStates: 0 for new flops, 1 on the current path, 2 for done.
+    std::vector<uint8_t> visitStates(totalFlops, 0);
+    std::vector<bool> isOnLoop(totalFlops, false);
+    std::vector<ScanChain> loops;
+    std::vector<uint32_t> path;
+    for(uint32_t startIndex = 0; startIndex < totalFlops; startIndex++)
+    {
+      uint32_t flopIndex = startIndex;
+      while(flopIndex != UINT32_MAX && !visitStates[flopIndex])
+      {
+        visitStates[flopIndex] = 1;
+        path.push_back(flopIndex);
+        flopIndex = scanInSources[flopIndex].flopIndex;
+      }
+      if(flopIndex != UINT32_MAX && visitStates[flopIndex] == 1)
+      {
+        ScanChain loop;
+        loop.isLoop = true;
+        loop.flopIndexs.assign(std::find(path.begin(), path.end(), flopIndex),
+                               path.end());
+        std::reverse(loop.flopIndexs.begin(), loop.flopIndexs.end());
+        for(const auto &loopFlopIndex: loop.flopIndexs)
+          isOnLoop[loopFlopIndex] = true;
+        loops.push_back(std::move(loop));
+      }
+      for(const auto &pathFlopIndex: path)
+        visitStates[pathFlopIndex] = 2;
+      path.clear();
+    }
+
+    // Walk every chain from its head in parallel. A chain is ok if it starts
+    // at a primary input and ends at a primary output. A flop on a loop
+    // always feeds the next one, so a branch off a loop starts a chain, and
+    // no chain walks into a loop.
+    std::vector<ScanChain> chains;
+    for(uint32_t flopIndex = 0; flopIndex < totalFlops; flopIndex++)
+    {
+      const uint32_t predIndex = scanInSources[flopIndex].flopIndex;
+      if(!isOnLoop[flopIndex] &&
+         (predIndex == UINT32_MAX || getTotalSuccs(predIndex) > 1))
+        chains.push_back({ { flopIndex } });
+    }
+    parallelFor(
+      0, chains.size(), totalThreads,
+      [&](uint32_t chainIndex)
+      {
+        auto &flopIndexs = chains[chainIndex].flopIndexs;
+        while(getTotalSuccs(flopIndexs.back()) == 1)
+          flopIndexs.push_back(succs[succStarts[flopIndexs.back()]]);
+        const ScanSource &source = scanInSources[flopIndexs[0]];
+        const FlatPin &driverPin = rootDriverPins[source.netRootId];
+        chains[chainIndex].isOk =
+          source.flopIndex == UINT32_MAX &&
+          !index.isConstNet(source.netRootId) &&
+          rootTotalDrivers[source.netRootId] == 1 &&
+          driverPin.insIndex == UINT32_MAX &&
+          getTotalSuccs(flopIndexs.back()) == 0 &&
+          scanOutNets[flopIndexs.back()] != UINT32_MAX;
+      });
+    chains.insert(chains.end(), std::make_move_iterator(loops.begin()),
+                  std::make_move_iterator(loops.end()));
+
+    // A net set is written as its name and its driver, which is an
+    // instance/pin, "input", "undriven", "constant" or "multiple_drivers".
+    auto writeNet = [&](std::ostream &os, const uint32_t &netRootId)
+    {
+      os << index.getNetName(netRootId) << " ";
+      const FlatPin &driverPin = rootDriverPins[netRootId];
+      if(index.isConstNet(netRootId))
+        os << "constant";
+      else if(rootTotalDrivers[netRootId] == 0)
+        os << "undriven";
+      else if(rootTotalDrivers[netRootId] == manyDrivers)
+        os << "multiple_drivers";
+      else if(driverPin.insIndex == UINT32_MAX)
+        os << "input";
+      else
+      {
+        const auto &port = flatNetlist[flatMod.subModuleDefIndexs
+                                         [driverPin.insIndex]]
+                             .ports[driverPin.portDefIndex];
+        os << flatMod.subModuleInstanceNames[driverPin.insIndex] << "/"
+           << port.portDefName;
+        if(port.isVector)
+          os << "[" << driverPin.bitIndex << "]";
+      }
+    };
+    auto writeScanOut = [&](std::ostream &os, const ScanChain &chain)
+    {
+      const uint32_t &scanOutNet = scanOutNets[chain.flopIndexs.back()];
+      os << (chain.isLoop || scanOutNet == UINT32_MAX
+               ? "none"
+               : index.getNetName(scanOutNet));
+    };
+    auto getChainFileName = [&](const uint32_t &chainIndex)
+    {
+      return dirName + "/" + flatMod.moduleDefName + "_chain" +
+             std::to_string(chainIndex) + ".txt";
+    };
+    auto getStatus = [](const ScanChain &chain)
+    { return chain.isLoop ? "loop" : chain.isOk ? "ok" : "broken"; };
+
+    // Every chain file has the flops in shift order with the polarity from
+    // the scan in and the lockup latches before its scan_in pin.
+    parallelFor(
+      0, chains.size(), totalThreads,
+      [&](uint32_t chainIndex)
+      {
+        const auto &chain = chains[chainIndex];
+        const std::string fileName = getChainFileName(chainIndex);
+        std::ofstream chainOfs(fileName);
+        if(!chainOfs)
+          throw std::runtime_error("Can't open " + fileName + ".");
+        chainOfs << "// Scan chain " << chainIndex << " of module "
+                 << flatMod.moduleDefName << ", " << getStatus(chain) << ", "
+                 << chain.flopIndexs.size() << " flops" << std::endl;
+        chainOfs << "// Scan in: ";
+        writeNet(chainOfs, scanInSources[chain.flopIndexs[0]].netRootId);
+        chainOfs << std::endl << "// Scan out: ";
+        writeScanOut(chainOfs, chain);
+        chainOfs << std::endl;
+        chainOfs << "// Flop, std cell, polarity to scan in, lockup latches"
+                 << std::endl;
+        bool isInverted = false;
+        for(uint32_t position = 0; position < chain.flopIndexs.size();
+            position++)
+        {
+          const uint32_t &flopIndex = chain.flopIndexs[position];
+          const ScanSource &source = scanInSources[flopIndex];
+          // The polarity of a loop is seen from its first flop.
+          if(position)
+            isInverted = isInverted != source.isInverted;
+          const uint32_t &insIndex = flopInss[flopIndex];
+          chainOfs << flatMod.subModuleInstanceNames[insIndex] << " "
+                   << flatNetlist[flatMod.subModuleDefIndexs[insIndex]]
+                        .moduleDefName
+                   << " " << (isInverted ? "inverted" : "same") << " "
+                   << source.totalLatches << std::endl;
+        }
+      });
+
+    uint32_t totalOkChains = 0;
+    uint32_t totalLoops = 0;
+    for(const auto &chain: chains)
+    {
+      totalOkChains += chain.isOk;
+      totalLoops += chain.isLoop;
+    }
+    ofs << "// Scan chains of module " << flatMod.moduleDefName << std::endl;
+    ofs << "// Scan flops: " << totalFlops << ", chains: " << chains.size()
+        << ", ok: " << totalOkChains
+        << ", broken: " << chains.size() - totalOkChains - totalLoops
+        << ", loops: " << totalLoops << std::endl;
+    ofs << "// Chain, status, flops, scan in, driver, scan out, file"
+        << std::endl;
+    for(uint32_t chainIndex = 0; chainIndex < chains.size(); chainIndex++)
+    {
+      const auto &chain = chains[chainIndex];
+      ofs << chainIndex << " " << getStatus(chain) << " "
+          << chain.flopIndexs.size() << " ";
+      writeNet(ofs, scanInSources[chain.flopIndexs[0]].netRootId);
+      ofs << " ";
+      writeScanOut(ofs, chain);
+      ofs << " " << getChainFileName(chainIndex) << std::endl;
+    }
+    ofs << std::endl;
+  }
+}
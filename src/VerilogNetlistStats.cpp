@@ -0,0 +1,321 @@
+/*************************************************************************
+  > File Name: VerilogNetlistStats.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "VerilogNetlist.h"
+#include <fstream>
+#include <map>
+
+namespace
+{
+// Pin statistics of the instances in a module. tieOffs[0] ~ tieOffs[3] count
+// pins connected to 1'b0, 1'b1, 1'bx and 1'bz.
+struct PinStats
+{
+    uint64_t unconnectedPins = 0;
+    uint64_t tieOffs[4] = { 0, 0, 0, 0 };
+    void add(const PinStats &other, const uint64_t &times = 1)
+    {
+      unconnectedPins += other.unconnectedPins * times;
+      for(uint32_t i = 0; i < 4; i++) tieOffs[i] += other.tieOffs[i] * times;
+    }
+};
+
+// CellUsage[cellDefIndex] = the number of instances, only used cells are kept
+// so that it stays small in a big design.
+using CellUsage = std::map<uint32_t, uint64_t>;
+
+void addCellUsage(CellUsage &cellUsage, const CellUsage &other,
+                  const uint64_t &times = 1)
+{
+  for(const auto &oneUsage: other)
+    cellUsage[oneUsage.first] += oneUsage.second * times;
+}
+
+uint32_t getTieOffIndex(const char &valueAndValueX)
+{
+  switch(valueAndValueX)
+  {
+  case CHAR_ZERO:
+    return 0;
+  case CHAR_ONE:
+    return 1;
+  case CHAR_Z:
+    return 3;
+  default: // x or error value
+    return 2;
+  }
+}
+
+// An unconnected pin counts every bit of the port, a tie-off counts one bit.
+PinStats getPinStats(const std::vector<Module> &netlist, const Module &oneMod)
+{
+  PinStats pinStats;
+  for(uint32_t insIndex = 0; insIndex < oneMod.subModuleDefIndexs.size();
+      insIndex++)
+  {
+    const auto &subMod = netlist[oneMod.subModuleDefIndexs[insIndex]];
+    const auto &portAssignments = oneMod.portAssignmentsOfSubModInss[insIndex];
+    for(uint32_t portDefIndex = 0; portDefIndex < portAssignments.size();
+        portDefIndex++)
+    {
+      const auto &refVars = portAssignments[portDefIndex].refVars;
+      if(refVars.empty())
+        pinStats.unconnectedPins += subMod.ports[portDefIndex].bitWidth;
+      for(const auto &refVar: refVars)
+      {
+        if(refVar.refVarDefIndex == UINT32_MAX)
+          pinStats.tieOffs[getTieOffIndex(refVar.valueAndValueX)]++;
+      }
+    }
+  }
+  return pinStats;
+}
+
+uint64_t getWireBits(const Module &oneMod)
+{
+  uint64_t wireBits = 0;
+  for(uint32_t portDefIndex = oneMod.totalPortsExcludingWires;
+      portDefIndex < oneMod.ports.size(); portDefIndex++)
+    wireBits += oneMod.ports[portDefIndex].bitWidth;
+  return wireBits;
+}
+
+// Escaped identifiers may have any printable character.
+std::string getJsonString(const std::string &str)
+{
+  std::string jsonStr = "\"";
+  for(const auto &c: str)
+  {
+    if(c == '"' || c == '\\')
+      jsonStr += '\\';
+    jsonStr += c;
+  }
+  return jsonStr + "\"";
+}
+
+std::string getCsvString(const std::string &str)
+{
+  if(str.find_first_of(",\"") == std::string::npos)
+    return str;
+  std::string csvStr = "\"";
+  for(const auto &c: str)
+  {
+    if(c == '"')
+      csvStr += '"';
+    csvStr += c;
+  }
+  return csvStr + "\"";
+}
+
+} // namespace
+
+// All statistics are computed from the netlists in memory, so that we don't
+// need to read HierNetlist.v or FlatNetlist.v again. Modules are sorted by
+// level and a sub module always has a bigger level than its parent, so we
+// roll up statistics of sub trees from the last module to the first one, and
+// count instantiations of modules from the first module to the last one.
+void VerilogNetlist::statNetlist(const std::vector<Module> &hierNetlist,
+                                 const std::vector<Module> &flatNetlist,
+                                 std::string fileName)
+{
+  const uint32_t totalMods = hierNetlist.size();
+  // cellUsages[modDefIndex] of black boxes
+  std::vector<CellUsage> directCellUsages(totalMods);
+  std::vector<CellUsage> subtreeCellUsages(totalMods);
+  std::vector<PinStats> directPinStats(totalMods);
+  std::vector<PinStats> subtreePinStats(totalMods);
+  std::vector<uint64_t> subtreeAssigns(totalMods, 0);
+  std::vector<uint64_t> instantiations(totalMods, 0);
+  std::vector<bool> isInstanced(totalMods, false);
+  for(uint32_t modDefIndex = _totalUsedBlackBoxes; modDefIndex < totalMods;
+      modDefIndex++)
+  {
+    const auto &oneMod = hierNetlist[modDefIndex];
+    for(const auto &subModDefIndex: oneMod.subModuleDefIndexs)
+    {
+      if(subModDefIndex < _totalUsedBlackBoxes)
+        directCellUsages[modDefIndex][subModDefIndex]++;
+      isInstanced[subModDefIndex] = true;
+    }
+    directPinStats[modDefIndex] = getPinStats(hierNetlist, oneMod);
+  }
+  for(uint32_t modDefIndex = totalMods - 1;
+      modDefIndex >= _totalUsedBlackBoxes && modDefIndex != UINT32_MAX;
+      modDefIndex--)
+  {
+    const auto &oneMod = hierNetlist[modDefIndex];
+    auto &cellUsage = subtreeCellUsages[modDefIndex];
+    cellUsage = directCellUsages[modDefIndex];
+    subtreePinStats[modDefIndex] = directPinStats[modDefIndex];
+    subtreeAssigns[modDefIndex] = oneMod.assigns.size();
+    // Every sub module is added once with the number of its instances.
+    std::map<uint32_t, uint64_t> subModInss;
+    for(const auto &subModDefIndex: oneMod.subModuleDefIndexs)
+    {
+      if(subModDefIndex >= _totalUsedBlackBoxes)
+        subModInss[subModDefIndex]++;
+    }
+    for(const auto &subModIns: subModInss)
+    {
+      addCellUsage(cellUsage, subtreeCellUsages[subModIns.first],
+                   subModIns.second);
+      subtreePinStats[modDefIndex].add(subtreePinStats[subModIns.first],
+                                       subModIns.second);
+      subtreeAssigns[modDefIndex] +=
+        subtreeAssigns[subModIns.first] * subModIns.second;
+    }
+  }
+  for(uint32_t modDefIndex = _totalUsedBlackBoxes; modDefIndex < totalMods;
+      modDefIndex++)
+  {
+    if(!isInstanced[modDefIndex])
+      instantiations[modDefIndex] = 1;
+    for(const auto &subModDefIndex:
+        hierNetlist[modDefIndex].subModuleDefIndexs)
+      instantiations[subModDefIndex] += instantiations[modDefIndex];
+  }
+  // Instances of black boxes placed directly in modules of every level
+  std::map<uint32_t, CellUsage> levelCellUsages;
+  std::map<uint32_t, uint32_t> levelTotalMods;
+  for(uint32_t modDefIndex = _totalUsedBlackBoxes; modDefIndex < totalMods;
+      modDefIndex++)
+  {
+    const auto &level = hierNetlist[modDefIndex].level;
+    levelTotalMods[level]++;
+    addCellUsage(levelCellUsages[level], directCellUsages[modDefIndex],
+                 instantiations[modDefIndex]);
+  }
+
+  // Cells are named by netlist, a flattened module may count hard macros.
+  auto printCellUsage = [](std::ofstream &ofs, const CellUsage &cellUsage,
+                           const std::vector<Module> &netlist)
+  {
+    uint64_t totalInss = 0;
+    ofs << "{";
+    for(const auto &oneUsage: cellUsage)
+    {
+      ofs << (totalInss ? ", " : "")
+          << getJsonString(netlist[oneUsage.first].moduleDefName) << ": "
+          << oneUsage.second;
+      totalInss += oneUsage.second;
+    }
+    ofs << "}";
+    return totalInss;
+  };
+  auto printPinStats = [](std::ofstream &ofs, const PinStats &pinStats)
+  {
+    ofs << "\"unconnectedPins\": " << pinStats.unconnectedPins
+        << ", \"tieOffs\": {\"1'b0\": " << pinStats.tieOffs[0]
+        << ", \"1'b1\": " << pinStats.tieOffs[1]
+        << ", \"1'bx\": " << pinStats.tieOffs[2]
+        << ", \"1'bz\": " << pinStats.tieOffs[3] << "}";
+  };
+
+  std::ofstream ofs(fileName + ".json");
+  CellUsage designCellUsage;
+  for(uint32_t modDefIndex = _totalUsedBlackBoxes; modDefIndex < totalMods;
+      modDefIndex++)
+  {
+    if(!isInstanced[modDefIndex])
+      addCellUsage(designCellUsage, subtreeCellUsages[modDefIndex]);
+  }
+  ofs << "{" << std::endl;
+  ofs << "  \"totalUsedStdCells\": " << _totalUsedStdCells << "," << std::endl;
+  ofs << "  \"totalUsedBlackBoxes\": " << _totalUsedBlackBoxes << ","
+      << std::endl;
+  ofs << "  \"totalModules\": " << totalMods - _totalUsedBlackBoxes << ","
+      << std::endl;
+  ofs << "  \"cellUsage\": ";
+  printCellUsage(ofs, designCellUsage, hierNetlist);
+  ofs << "," << std::endl;
+  ofs << "  \"levels\": [";
+  for(const auto &levelCellUsage: levelCellUsages)
+  {
+    ofs << (levelCellUsage.first == levelCellUsages.begin()->first ? "" : ",")
+        << std::endl;
+    ofs << "    {\"level\": " << levelCellUsage.first
+        << ", \"modules\": " << levelTotalMods[levelCellUsage.first]
+        << ", \"cellUsage\": ";
+    const uint64_t totalInss =
+      printCellUsage(ofs, levelCellUsage.second, hierNetlist);
+    ofs << ", \"instances\": " << totalInss << "}";
+  }
+  ofs << std::endl << "  ]," << std::endl;
+  ofs << "  \"modules\": [";
+  for(uint32_t modDefIndex = _totalUsedBlackBoxes; modDefIndex < totalMods;
+      modDefIndex++)
+  {
+    const auto &oneMod = hierNetlist[modDefIndex];
+    ofs << (modDefIndex == _totalUsedBlackBoxes ? "" : ",") << std::endl;
+    ofs << "    {\"name\": " << getJsonString(oneMod.moduleDefName)
+        << ", \"level\": " << oneMod.level
+        << ", \"instantiations\": " << instantiations[modDefIndex]
+        << ", \"subModuleInstances\": " << oneMod.subModuleDefIndexs.size()
+        << ", \"assigns\": " << oneMod.assigns.size()
+        << ", \"wireBits\": " << getWireBits(oneMod) << "," << std::endl;
+    ofs << "     \"direct\": {\"cellUsage\": ";
+    const uint64_t directInss =
+      printCellUsage(ofs, directCellUsages[modDefIndex], hierNetlist);
+    ofs << ", \"instances\": " << directInss << ", ";
+    printPinStats(ofs, directPinStats[modDefIndex]);
+    ofs << "}," << std::endl;
+    ofs << "     \"subtree\": {\"cellUsage\": ";
+    const uint64_t subtreeInss =
+      printCellUsage(ofs, subtreeCellUsages[modDefIndex], hierNetlist);
+    ofs << ", \"instances\": " << subtreeInss
+        << ", \"assigns\": " << subtreeAssigns[modDefIndex] << ", ";
+    printPinStats(ofs, subtreePinStats[modDefIndex]);
+    ofs << "}}";
+  }
+  ofs << std::endl << "  ]," << std::endl;
+  // Flattened netlist may be changed by later optimizations, like strash.
+  ofs << "  \"flattened\": [";
+  bool isFirstFlatTop = true;
+  for(uint32_t modDefIndex = _totalUsedBlackBoxes;
+      modDefIndex < flatNetlist.size(); modDefIndex++)
+  {
+    if(!isInFlatNet(modDefIndex))
+      continue;
+    const auto &flatMod = flatNetlist[modDefIndex];
+    // Hard macros are counted as cells, too.
+    CellUsage cellUsage;
+    for(const auto &subModDefIndex: flatMod.subModuleDefIndexs)
+      cellUsage[subModDefIndex]++;
+    ofs << (isFirstFlatTop ? "" : ",") << std::endl;
+    isFirstFlatTop = false;
+    ofs << "    {\"name\": " << getJsonString(flatMod.moduleDefName)
+        << ", \"assigns\": " << flatMod.assigns.size()
+        << ", \"wireBits\": " << getWireBits(flatMod) << ", \"cellUsage\": ";
+    const uint64_t totalInss = printCellUsage(ofs, cellUsage, flatNetlist);
+    ofs << ", \"instances\": " << totalInss << ", ";
+    printPinStats(ofs, getPinStats(flatNetlist, flatMod));
+    ofs << "}";
+  }
+  ofs << std::endl << "  ]" << std::endl;
+  ofs << "}" << std::endl;
+  ofs.close();
+
+  // One row for every used black box of every module.
+  ofs.open(fileName + ".csv");
+  ofs << "module,level,instantiations,cell,direct,subtree" << std::endl;
+  for(uint32_t modDefIndex = _totalUsedBlackBoxes; modDefIndex < totalMods;
+      modDefIndex++)
+  {
+    const auto &oneMod = hierNetlist[modDefIndex];
+    const auto &directCellUsage = directCellUsages[modDefIndex];
+    for(const auto &oneUsage: subtreeCellUsages[modDefIndex])
+    {
+      const auto direct = directCellUsage.find(oneUsage.first);
+      ofs << getCsvString(oneMod.moduleDefName) << "," << oneMod.level << ","
+          << instantiations[modDefIndex] << ","
+          << getCsvString(hierNetlist[oneUsage.first].moduleDefName) << ","
+          << (direct == directCellUsage.end() ? 0 : direct->second) << ","
+          << oneUsage.second << std::endl;
+    }
+  }
+  ofs.close();
+}
@@ -0,0 +1,288 @@
+/*************************************************************************
+  > File Name: VerilogNetlistStrash.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include "V3Hash.h"
+#include "VerilogNetlist.h"
+#include <deque>
+#include <fstream>
+#include <unordered_map>
+
+// Structural hashing (strash): two instances of the same std cell whose
+// inputs are connected to the same nets are functionally identical, so one
+// of them can replace the other. The key of an instance is its std cell
+// definition index plus the root net ids of all its input pins, where the
+// root is given by NetUnionFind. Merging two instances unites their output
+// nets, which may make the instances they drive identical, too. So we use a
+// worklist and only put back the loads of the nets whose root changed. With
+// small-to-large merging of load lists, it runs in near-linear time.
+// Registers with the same inputs are still different flops of scan chains
+// and other DFT structures, so only combinational and tie cells are merged
+// unless shouldMergeRegs is true.
+void VerilogNetlist::strashFlatNet(std::vector<Module> &flatNetlist,
+                                   const std::vector<UsedStdCell> &usedStdCells,
+                                   const bool &shouldMerge,
+                                   const bool &shouldMergeRegs,
+                                   std::string reportName)
+{
+  std::ofstream ofs(reportName);
+  for(uint32_t flatModDefIndex = _totalUsedBlackBoxes;
+      flatModDefIndex < flatNetlist.size(); flatModDefIndex++)
+  {
+    if(!isInFlatNet(flatModDefIndex))
+      continue;
+    auto &flatMod = flatNetlist[flatModDefIndex];
+    const uint32_t totalInss = flatMod.subModuleDefIndexs.size();
+    FlatNetlistIndex index(flatNetlist, flatModDefIndex);
+    NetUnionFind netUnionFind(index.getTotalNets());
+    netUnionFind.uniteAssigns(index, flatMod);
+
+    // Only std cells which have at least one output, have no inout and have
+    // no floating input can be merged, other black boxes are unknown to us.
+    auto isMergeable = [&](const uint32_t &insIndex)
+    {
+      const auto &stdCell = flatNetlist[flatMod.subModuleDefIndexs[insIndex]];
+      const StdCellKind kind =
+        usedStdCells[flatMod.subModuleDefIndexs[insIndex]].kind;
+      if(flatMod.subModuleDefIndexs[insIndex] >= _totalUsedNotEmptyStdCells ||
+         (kind != StdCellKind::COMBINATIONAL && kind != StdCellKind::TIE &&
+          !(shouldMergeRegs && (kind == StdCellKind::FLIP_FLOP ||
+                                kind == StdCellKind::LATCH ||
+                                kind == StdCellKind::CLOCK_GATE))) ||
+         stdCell.totalInputs != stdCell.totalInputsAndInouts ||
+         stdCell.totalInputsAndInouts == stdCell.totalPortsExcludingWires)
+        return false;
+      for(uint32_t portDefIndex = 0; portDefIndex < stdCell.totalInputs;
+          portDefIndex++)
+      {
+        if(flatMod.portAssignmentsOfSubModInss[insIndex][portDefIndex]
+             .refVars.empty())
+          return false;
+      }
+      return true;
+    };
+    // Call oneNet(netRootId) for every input pin.
+    auto forEachInputNet = [&](const uint32_t &insIndex, auto &&oneNet)
+    {
+      const auto &stdCell = flatNetlist[flatMod.subModuleDefIndexs[insIndex]];
+      const auto &portAssignments =
+        flatMod.portAssignmentsOfSubModInss[insIndex];
+      for(uint32_t portDefIndex = 0; portDefIndex < stdCell.totalInputs;
+          portDefIndex++)
+      {
+        for(const auto &refVar: portAssignments[portDefIndex].refVars)
+          oneNet(netUnionFind.find(index.getNetId(refVar)));
+      }
+    };
+    auto getKey = [&](const uint32_t &insIndex)
+    {
+      V3Hash hash(flatMod.subModuleDefIndexs[insIndex]);
+      forEachInputNet(insIndex, [&hash](uint32_t netRootId)
+                      { hash += netRootId; });
+      return hash.value();
+    };
+    auto haveSameInputs = [&](const uint32_t &insIndexA,
+                              const uint32_t &insIndexB)
+    {
+      if(flatMod.subModuleDefIndexs[insIndexA] !=
+         flatMod.subModuleDefIndexs[insIndexB])
+        return false;
+      std::vector<uint32_t> inputNetsA;
+      forEachInputNet(insIndexA, [&inputNetsA](uint32_t netRootId)
+                      { inputNetsA.push_back(netRootId); });
+      uint32_t position = 0;
+      bool isSame = true;
+      forEachInputNet(insIndexB,
+                      [&](uint32_t netRootId)
+                      {
+                        isSame = isSame && inputNetsA[position] == netRootId;
+                        position++;
+                      });
+      return isSame;
+    };
+    // A duplicate instance can replace its output nets with the output nets
+    // of the kept instance only if the kept one drives all of them.
+    auto haveCompatibleOutputs = [&](const uint32_t &keptInsIndex,
+                                     const uint32_t &dupInsIndex)
+    {
+      const auto &stdCell =
+        flatNetlist[flatMod.subModuleDefIndexs[keptInsIndex]];
+      for(uint32_t portDefIndex = stdCell.totalInputsAndInouts;
+          portDefIndex < stdCell.totalPortsExcludingWires; portDefIndex++)
+      {
+        const auto &keptRefVars =
+          flatMod.portAssignmentsOfSubModInss[keptInsIndex][portDefIndex]
+            .refVars;
+        const auto &dupRefVars =
+          flatMod.portAssignmentsOfSubModInss[dupInsIndex][portDefIndex]
+            .refVars;
+        if(dupRefVars.empty())
+          continue;
+        if(keptRefVars.empty())
+          return false;
+        for(uint32_t bitIndex = 0; bitIndex < dupRefVars.size(); bitIndex++)
+        {
+          if(keptRefVars[bitIndex].refVarDefIndex == UINT32_MAX &&
+             dupRefVars[bitIndex].refVarDefIndex != UINT32_MAX)
+            return false;
+        }
+      }
+      return true;
+    };
+
+    // Loads of every root net, they are merged when two roots are united.
+    std::vector<std::vector<uint32_t>> rootLoads(index.getTotalNets());
+    std::vector<bool> isRemoved(totalInss, false);
+    std::vector<bool> isInWorklist(totalInss, false);
+    std::deque<uint32_t> worklist;
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      if(!isMergeable(insIndex))
+        continue;
+      forEachInputNet(insIndex, [&](uint32_t netRootId)
+                      { rootLoads[netRootId].push_back(insIndex); });
+      worklist.push_back(insIndex);
+      isInWorklist[insIndex] = true;
+    }
+    std::unordered_multimap<uint32_t, uint32_t> keyMapInsIndexs;
+    keyMapInsIndexs.reserve(worklist.size());
+    // replacedNetIds[dupNetId] = keptNetId
+    std::vector<uint32_t> replacedNetIds(index.getTotalNets(), UINT32_MAX);
+    // Pairs of kept instance and duplicate instance for report.
+    std::vector<std::pair<uint32_t, uint32_t>> mergedInss;
+    while(!worklist.empty())
+    {
+      const uint32_t insIndex = worklist.front();
+      worklist.pop_front();
+      isInWorklist[insIndex] = false;
+      if(isRemoved[insIndex])
+        continue;
+      const uint32_t key = getKey(insIndex);
+      uint32_t keptInsIndex = UINT32_MAX;
+      auto range = keyMapInsIndexs.equal_range(key);
+      for(auto it = range.first; it != range.second; it++)
+      {
+        // Entries may be stale because roots changed, check it again.
+        if(it->second != insIndex && !isRemoved[it->second] &&
+           haveSameInputs(it->second, insIndex) &&
+           haveCompatibleOutputs(it->second, insIndex))
+        {
+          keptInsIndex = it->second;
+          break;
+        }
+      }
+      if(keptInsIndex == UINT32_MAX)
+      {
+        keyMapInsIndexs.emplace(key, insIndex);
+        continue;
+      }
+      // Merge insIndex into keptInsIndex.
+      isRemoved[insIndex] = true;
+      mergedInss.emplace_back(keptInsIndex, insIndex);
+      const auto &stdCell = flatNetlist[flatMod.subModuleDefIndexs[insIndex]];
+      for(uint32_t portDefIndex = stdCell.totalInputsAndInouts;
+          portDefIndex < stdCell.totalPortsExcludingWires; portDefIndex++)
+      {
+        const auto &dupRefVars =
+          flatMod.portAssignmentsOfSubModInss[insIndex][portDefIndex].refVars;
+        const auto &keptRefVars =
+          flatMod.portAssignmentsOfSubModInss[keptInsIndex][portDefIndex]
+            .refVars;
+        for(uint32_t bitIndex = 0; bitIndex < dupRefVars.size(); bitIndex++)
+        {
+          const uint32_t dupNetId = index.getNetId(dupRefVars[bitIndex]);
+          const uint32_t keptNetId = index.getNetId(keptRefVars[bitIndex]);
+          if(dupNetId == keptNetId || index.isConstNet(dupNetId))
+            continue;
+          replacedNetIds[dupNetId] = keptNetId;
+          uint32_t keptRoot = netUnionFind.find(keptNetId);
+          uint32_t dupRoot = netUnionFind.find(dupNetId);
+          if(keptRoot == dupRoot)
+            continue;
+          // The root with fewer loads changes, its loads get new keys.
+          // A constant stays the root of its set, see NetUnionFind.
+          if((rootLoads[keptRoot].size() < rootLoads[dupRoot].size() &&
+              !index.isConstNet(keptRoot)) ||
+             index.isConstNet(dupRoot))
+            std::swap(keptRoot, dupRoot);
+          netUnionFind.unite(keptRoot, dupRoot);
+          for(const auto &loadInsIndex: rootLoads[dupRoot])
+          {
+            if(!isInWorklist[loadInsIndex] && !isRemoved[loadInsIndex])
+            {
+              worklist.push_back(loadInsIndex);
+              isInWorklist[loadInsIndex] = true;
+            }
+          }
+          rootLoads[keptRoot].insert(rootLoads[keptRoot].end(),
+                                     rootLoads[dupRoot].begin(),
+                                     rootLoads[dupRoot].end());
+          std::vector<uint32_t>().swap(rootLoads[dupRoot]);
+        }
+      }
+    }
+
+    ofs << "// Structural hashing of module " << flatMod.moduleDefName
+        << std::endl;
+    ofs << "// Total instances: " << totalInss
+        << ", duplicate instances: " << mergedInss.size() << std::endl;
+    ofs << "// Std cell, kept instance, duplicate instance" << std::endl;
+    for(const auto &mergedIns: mergedInss)
+      ofs << flatNetlist[flatMod.subModuleDefIndexs[mergedIns.first]]
+               .moduleDefName
+          << " " << flatMod.subModuleInstanceNames[mergedIns.first] << " "
+          << flatMod.subModuleInstanceNames[mergedIns.second] << std::endl;
+    ofs << std::endl;
+    if(!shouldMerge || mergedInss.empty())
+      continue;
+
+    // A kept instance may be merged later, so follow the chain to the end.
+    auto getFinalNetId = [&replacedNetIds](uint32_t netId)
+    {
+      while(replacedNetIds[netId] != UINT32_MAX)
+        netId = replacedNetIds[netId];
+      return netId;
+    };
+    // Loads of a duplicate wire read the kept net directly, but a duplicate
+    // port of flatMod must be still driven, so use an assign statement.
+    std::vector<bool> isReplacedWire(flatMod.ports.size(), false);
+    for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts();
+        netId++)
+    {
+      if(replacedNetIds[netId] == UINT32_MAX)
+        continue;
+      if(index.isPortNet(netId))
+      {
+        BitSlicedAssignStatement oneAssign;
+        oneAssign.lValue = index.getRefVar(netId);
+        oneAssign.rValue = index.getRefVar(getFinalNetId(netId));
+        flatMod.assigns.push_back(oneAssign);
+      }
+      else
+        isReplacedWire[index.getRefVar(netId).refVarDefIndex] = true;
+    }
+    auto replaceRefVar = [&](RefVar &refVar)
+    {
+      const uint32_t netId = index.getNetId(refVar);
+      if(!index.isPortNet(netId) && replacedNetIds[netId] != UINT32_MAX)
+        refVar = index.getRefVar(getFinalNetId(netId));
+    };
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      if(isRemoved[insIndex])
+        continue;
+      for(auto &portAssignment: flatMod.portAssignmentsOfSubModInss[insIndex])
+        for(auto &refVar: portAssignment.refVars)
+          replaceRefVar(refVar);
+    }
+    for(auto &oneAssign: flatMod.assigns)
+      replaceRefVar(oneAssign.rValue);
+    removeInstances(flatMod, isRemoved);
+    removeUnusedWires(flatMod, isReplacedWire);
+  }
+  ofs.close();
+}
@@ -0,0 +1,351 @@
+/*************************************************************************
+  > File Name: VerilogNetlistSweep.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include "VerilogNetlist.h"
+#include <deque>
+#include <fstream>
+
+// Sweep dead logic of a flattened netlist in two steps, both are linear in
+// the number of pins:
+// 1. Constant propagation: a net set, i.e. nets connected by assign
+//    statements, is constant if it is tied to 1'b0 or 1'b1, or driven by a
+//    combinational std cell whose function is constant under the known
+//    inputs. Loads of a constant net set are tied to the constant directly.
+// 2. Reverse reachability: sequential cells, black boxes and other cells
+//    which must be kept, and primary outputs are live. A combinational cell
+//    is live if it drives a live net set, and then its inputs are live, too.
+//    Instances, assign statements and wires which are not live are removed.
+void VerilogNetlist::sweepFlatNet(std::vector<Module> &flatNetlist,
+                                  const std::vector<UsedStdCell> &usedStdCells,
+                                  std::string reportName)
+{
+  std::ofstream ofs(reportName);
+  for(uint32_t flatModDefIndex = _totalUsedBlackBoxes;
+      flatModDefIndex < flatNetlist.size(); flatModDefIndex++)
+  {
+    if(!isInFlatNet(flatModDefIndex))
+      continue;
+    auto &flatMod = flatNetlist[flatModDefIndex];
+    const uint32_t totalInss = flatMod.subModuleDefIndexs.size();
+    FlatNetlistIndex index(flatNetlist, flatModDefIndex);
+    NetUnionFind netUnionFind(index.getTotalNets());
+    netUnionFind.uniteAssigns(index, flatMod);
+    const uint32_t totalNets = index.getTotalNets();
+
+    auto getUsedStdCell = [&](const uint32_t &insIndex) -> const UsedStdCell &
+    { return usedStdCells[flatMod.subModuleDefIndexs[insIndex]]; };
+    auto isRemovable = [&](const uint32_t &insIndex)
+    {
+      const auto &kind = getUsedStdCell(insIndex).kind;
+      return kind == StdCellKind::COMBINATIONAL ||
+             kind == StdCellKind::TIE || kind == StdCellKind::TRISTATE;
+    };
+    // Call onePin(portDefIndex, bitIndex, netRootId) for every connected pin
+    // of an instance whose portDefIndex is in [beginPort, endPort).
+    auto forEachPin = [&](const uint32_t &insIndex, const uint32_t &beginPort,
+                          const uint32_t &endPort, auto &&onePin)
+    {
+      const auto &portAssignments =
+        flatMod.portAssignmentsOfSubModInss[insIndex];
+      for(uint32_t portDefIndex = beginPort; portDefIndex < endPort;
+          portDefIndex++)
+      {
+        const auto &refVars = portAssignments[portDefIndex].refVars;
+        for(uint32_t bitIndex = 0; bitIndex < refVars.size(); bitIndex++)
+          onePin(portDefIndex, bitIndex,
+                 netUnionFind.find(index.getNetId(refVars[bitIndex])));
+      }
+    };
+
+    // Drivers and loads of net sets, a net set is named by its root.
+    std::vector<std::vector<uint32_t>> rootDriverInss(totalNets);
+    std::vector<std::vector<uint32_t>> rootLoadInss(totalNets);
+    std::vector<uint32_t> rootTotalDrivers(totalNets, 0);
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      const auto &stdCell = flatNetlist[flatMod.subModuleDefIndexs[insIndex]];
+      forEachPin(insIndex, stdCell.totalInputs,
+                 stdCell.totalPortsExcludingWires,
+                 [&](uint32_t, uint32_t, uint32_t netRootId)
+                 {
+                   rootDriverInss[netRootId].push_back(insIndex);
+                   rootTotalDrivers[netRootId]++;
+                 });
+      forEachPin(insIndex, 0, stdCell.totalInputsAndInouts,
+                 [&](uint32_t, uint32_t, uint32_t netRootId)
+                 { rootLoadInss[netRootId].push_back(insIndex); });
+    }
+    // Inputs and inouts of flatMod are driven from outside.
+    std::vector<bool> isDrivenOutside(totalNets, false);
+    std::vector<uint32_t> outputNetIds;
+    for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts();
+        netId++)
+    {
+      if(!index.isPortNet(netId))
+        break;
+      const auto &portType =
+        flatMod.ports[index.getRefVar(netId).refVarDefIndex].portType;
+      if(portType != PortType::OUTPUT)
+        isDrivenOutside[netUnionFind.find(netId)] = true;
+      if(portType != PortType::INPUT)
+        outputNetIds.push_back(netId);
+    }
+
+    // Step 1, constant propagation.
+    // rootValues[netRootId] is CHAR_ZERO, CHAR_ONE or CHAR_X(unknown).
+    std::vector<char> rootValues(totalNets, CHAR_X);
+    std::vector<char> rootLiterals(totalNets, CHAR_X);
+    std::vector<bool> hasLiteral(totalNets, false);
+    for(const char &value: { CHAR_ZERO, CHAR_ONE })
+    {
+      const uint32_t netRootId =
+        netUnionFind.find(index.getConstNetId(value));
+      rootLiterals[netRootId] = hasLiteral[netRootId] ? CHAR_X : value;
+      hasLiteral[netRootId] = true;
+    }
+    for(uint32_t netRootId = 0; netRootId < totalNets; netRootId++)
+    {
+      if(hasLiteral[netRootId] && rootTotalDrivers[netRootId] == 0 &&
+         !isDrivenOutside[netRootId])
+        rootValues[netRootId] = rootLiterals[netRootId];
+    }
+    // Net sets whose loads are tied to a constant. The output of a tie cell
+    // is known but kept, a physical netlist may need it.
+    std::vector<bool> isTied(totalNets, false);
+    for(uint32_t netRootId = 0; netRootId < totalNets; netRootId++)
+      isTied[netRootId] = rootValues[netRootId] != CHAR_X;
+    struct ConstOutput
+    {
+        uint32_t insIndex;
+        uint32_t portDefIndex;
+        char value;
+    };
+    std::vector<ConstOutput> constOutputs;
+    std::deque<uint32_t> worklist;
+    std::vector<bool> isInWorklist(totalInss, false);
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      const auto &kind = getUsedStdCell(insIndex).kind;
+      if(kind == StdCellKind::COMBINATIONAL || kind == StdCellKind::TIE)
+      {
+        worklist.push_back(insIndex);
+        isInWorklist[insIndex] = true;
+      }
+    }
+    std::vector<char> portValues;
+    while(!worklist.empty())
+    {
+      const uint32_t insIndex = worklist.front();
+      worklist.pop_front();
+      isInWorklist[insIndex] = false;
+      const auto &usedStdCell = getUsedStdCell(insIndex);
+      const auto &stdCell = flatNetlist[flatMod.subModuleDefIndexs[insIndex]];
+      portValues.assign(stdCell.totalPortsExcludingWires, CHAR_X);
+      forEachPin(insIndex, 0, stdCell.totalInputs,
+                 [&](uint32_t portDefIndex, uint32_t bitIndex,
+                     uint32_t netRootId)
+                 {
+                   if(bitIndex == 0)
+                     portValues[portDefIndex] = rootValues[netRootId];
+                 });
+      forEachPin(
+        insIndex, stdCell.totalInputsAndInouts,
+        stdCell.totalPortsExcludingWires,
+        [&](uint32_t portDefIndex, uint32_t, uint32_t netRootId)
+        {
+          const auto &function = usedStdCell.functions[portDefIndex];
+          if(function.empty() || rootValues[netRootId] != CHAR_X ||
+             rootTotalDrivers[netRootId] != 1 || isDrivenOutside[netRootId] ||
+             hasLiteral[netRootId])
+            return;
+          const char value = function.evalConst(portValues);
+          if(value == CHAR_X)
+            return;
+          rootValues[netRootId] = value;
+          isTied[netRootId] = usedStdCell.kind != StdCellKind::TIE;
+          if(isTied[netRootId])
+            constOutputs.push_back({ insIndex, portDefIndex, value });
+          for(const auto &loadInsIndex: rootLoadInss[netRootId])
+          {
+            if(!isInWorklist[loadInsIndex])
+            {
+              worklist.push_back(loadInsIndex);
+              isInWorklist[loadInsIndex] = true;
+            }
+          }
+        });
+    }
+    // Tie loads to the constant, and disconnect the outputs driving a tied
+    // net set, outputs of flatMod get an assign statement instead.
+    uint32_t totalTiedPins = 0;
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      const auto &stdCell = flatNetlist[flatMod.subModuleDefIndexs[insIndex]];
+      auto &portAssignments = flatMod.portAssignmentsOfSubModInss[insIndex];
+      for(uint32_t portDefIndex = 0;
+          portDefIndex < stdCell.totalPortsExcludingWires; portDefIndex++)
+      {
+        auto &refVars = portAssignments[portDefIndex].refVars;
+        for(auto &refVar: refVars)
+        {
+          const uint32_t netId = index.getNetId(refVar);
+          const uint32_t netRootId = netUnionFind.find(netId);
+          if(!isTied[netRootId] || index.isConstNet(netId))
+            continue;
+          if(portDefIndex < stdCell.totalInputs)
+          {
+            refVar =
+              index.getRefVar(index.getConstNetId(rootValues[netRootId]));
+            totalTiedPins++;
+          }
+          else if(portDefIndex >= stdCell.totalInputsAndInouts)
+          {
+            refVars.clear();
+            break;
+          }
+        }
+      }
+    }
+
+    // Step 2, reverse reachability from outputs and kept instances.
+    std::vector<bool> isLiveRoot(totalNets, false);
+    std::vector<bool> isLiveIns(totalInss, false);
+    std::vector<uint32_t> liveRoots;
+    auto markLiveRoot = [&](const uint32_t &netRootId)
+    {
+      if(isLiveRoot[netRootId] || isTied[netRootId])
+        return;
+      isLiveRoot[netRootId] = true;
+      liveRoots.push_back(netRootId);
+    };
+    auto markLiveIns = [&](const uint32_t &insIndex)
+    {
+      if(isLiveIns[insIndex])
+        return;
+      isLiveIns[insIndex] = true;
+      const auto &stdCell = flatNetlist[flatMod.subModuleDefIndexs[insIndex]];
+      forEachPin(insIndex, 0, stdCell.totalInputsAndInouts,
+                 [&](uint32_t, uint32_t, uint32_t netRootId)
+                 { markLiveRoot(netRootId); });
+    };
+    for(const auto &netId: outputNetIds)
+      markLiveRoot(netUnionFind.find(netId));
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      if(!isRemovable(insIndex))
+        markLiveIns(insIndex);
+    }
+    while(!liveRoots.empty())
+    {
+      const uint32_t netRootId = liveRoots.back();
+      liveRoots.pop_back();
+      for(const auto &driverInsIndex: rootDriverInss[netRootId])
+        markLiveIns(driverInsIndex);
+    }
+
+    // Report before removing, instance indexs are still valid.
+    std::vector<bool> isRemoved(totalInss, false);
+    uint32_t totalRemovedInss = 0;
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      isRemoved[insIndex] = !isLiveIns[insIndex];
+      totalRemovedInss += isRemoved[insIndex];
+    }
+    // Loaded by live instances, but driven by nobody.
+    std::vector<uint32_t> floatingNetIds;
+    for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts();
+        netId++)
+    {
+      const uint32_t netRootId = netUnionFind.find(netId);
+      if(netRootId != netId || !isLiveRoot[netRootId] ||
+         rootTotalDrivers[netRootId] != 0 || isDrivenOutside[netRootId] ||
+         hasLiteral[netRootId])
+        continue;
+      for(const auto &loadInsIndex: rootLoadInss[netRootId])
+      {
+        if(isLiveIns[loadInsIndex])
+        {
+          floatingNetIds.push_back(netId);
+          break;
+        }
+      }
+    }
+
+    // Keep assign statements of live net sets and constant outputs.
+    std::vector<BitSlicedAssignStatement> keptAssigns;
+    std::vector<bool> hasConstAssign(totalNets, false);
+    for(const auto &oneAssign: flatMod.assigns)
+    {
+      const uint32_t lNetId = index.getNetId(oneAssign.lValue);
+      const uint32_t netRootId = netUnionFind.find(lNetId);
+      if(isLiveRoot[netRootId])
+        keptAssigns.push_back(oneAssign);
+      else if(isTied[netRootId] && index.isPortNet(lNetId) &&
+              index.getNetId(oneAssign.rValue) ==
+                index.getConstNetId(rootValues[netRootId]))
+      {
+        keptAssigns.push_back(oneAssign);
+        hasConstAssign[lNetId] = true;
+      }
+    }
+    uint32_t totalAddedAssigns = 0;
+    for(const auto &netId: outputNetIds)
+    {
+      const uint32_t netRootId = netUnionFind.find(netId);
+      if(!isTied[netRootId] || hasConstAssign[netId])
+        continue;
+      BitSlicedAssignStatement oneAssign;
+      oneAssign.lValue = index.getRefVar(netId);
+      oneAssign.rValue =
+        index.getRefVar(index.getConstNetId(rootValues[netRootId]));
+      keptAssigns.push_back(oneAssign);
+      totalAddedAssigns++;
+    }
+    const uint32_t totalRemovedAssigns =
+      flatMod.assigns.size() + totalAddedAssigns - keptAssigns.size();
+
+    ofs << "// Sweep of module " << flatMod.moduleDefName << std::endl;
+    ofs << "// Total instances: " << totalInss
+        << ", removed instances: " << totalRemovedInss
+        << ", constant outputs: " << constOutputs.size()
+        << ", tied pins: " << totalTiedPins
+        << ", floating nets: " << floatingNetIds.size() << std::endl;
+    ofs << "// Constant instance, output, value" << std::endl;
+    for(const auto &constOutput: constOutputs)
+    {
+      const auto &stdCell =
+        flatNetlist[flatMod.subModuleDefIndexs[constOutput.insIndex]];
+      ofs << stdCell.moduleDefName << " "
+          << flatMod.subModuleInstanceNames[constOutput.insIndex] << " "
+          << stdCell.ports[constOutput.portDefIndex].portDefName << " "
+          << index.getNetName(index.getConstNetId(constOutput.value))
+          << std::endl;
+    }
+    ofs << "// Removed instance" << std::endl;
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      if(isRemoved[insIndex])
+        ofs << flatNetlist[flatMod.subModuleDefIndexs[insIndex]].moduleDefName
+            << " " << flatMod.subModuleInstanceNames[insIndex] << std::endl;
+    }
+    ofs << "// Floating net" << std::endl;
+    for(const auto &netId: floatingNetIds)
+      ofs << index.getNetName(netId) << std::endl;
+
+    const uint32_t totalPorts = flatMod.ports.size();
+    flatMod.assigns = std::move(keptAssigns);
+    removeInstances(flatMod, isRemoved);
+    removeUnusedWires(flatMod, std::vector<bool>(totalPorts, true));
+    ofs << "// Removed assigns: " << totalRemovedAssigns
+        << ", added assigns: " << totalAddedAssigns
+        << ", removed wires: " << totalPorts - flatMod.ports.size()
+        << std::endl
+        << std::endl;
+  }
+  ofs.close();
+}
@@ -0,0 +1,461 @@
+/*************************************************************************
+  > File Name: VerilogNetlistTiming.cpp
+  > Author: 16hxliang3
+  > Mail: 16hxliang3@stu.edu.cn
+  > Created Time: Sun 18 Oct 2026 10:12:31 AM CST
+ ************************************************************************/
+
+#include "FlatNetlistIndex.h"
+#include "NetlistParallel.h"
+#include "VerilogNetlist.h"
+#include <algorithm>
+#include <fstream>
+
+namespace
+{
+
+// Arrival of a net set which is constant or only driven by constants
+const double untimedArrival = -1;
+// Instances of one level are handed to threads in chunks.
+const uint32_t timingChunkInss = 1024;
+
+// A pin of an instance, or a bit of a port if insIndex is UINT32_MAX
+struct TimingPin
+{
+    uint32_t insIndex = UINT32_MAX;
+    uint32_t portDefIndex = 0;
+    uint32_t bitIndex = 0;
+};
+
+struct TimingEndpoint
+{
+    TimingPin pin;
+    double arrival;
+    // The instance driving the latest arrival, UINT32_MAX if the net set is
+    // a startpoint.
+    uint32_t driverInsIndex;
+    uint32_t netRootId;
+};
+
+} // namespace
+
+// Static timing with one delay per std cell, which is 1 unless the library
+// gives another delay, so an arrival without delays is the number of cells.
+// Combinational and tristate cells are timed, other instances cut paths:
+// their outputs, primary inputs and undriven net sets are startpoints at 0,
+// their inputs except clocks and primary outputs are endpoints.
+// 1. Levelization: a depth first search over the drivers of inputs orders
+//    timed instances, a driver found on the stack closes a combinational
+//    loop and this edge is cut. The level of an instance is 1 more than the
+//    highest level of its drivers before it in the order.
+// 2. Arrival: instances of one level only read arrivals of lower levels, so
+//    every level is computed in parallel. Every instance keeps the driver of
+//    its latest input to trace paths back.
+// Both steps are linear in the number of pins.
+void VerilogNetlist::analyzeTiming(const std::vector<Module> &flatNetlist,
+                                   const std::vector<UsedStdCell> &usedStdCells,
+                                   const uint32_t &totalPaths,
+                                   const uint32_t &totalThreads,
+                                   std::string reportName)
+{
+  std::ofstream ofs(reportName);
+  for(uint32_t flatModDefIndex = _totalUsedBlackBoxes;
+      flatModDefIndex < flatNetlist.size(); flatModDefIndex++)
+  {
+    if(!isInFlatNet(flatModDefIndex))
+      continue;
+    const auto &flatMod = flatNetlist[flatModDefIndex];
+    const uint32_t totalInss = flatMod.subModuleDefIndexs.size();
+    FlatNetlistIndex index(flatNetlist, flatModDefIndex);
+    NetUnionFind netUnionFind(index.getTotalNets());
+    netUnionFind.uniteAssigns(index, flatMod);
+    const uint32_t totalNets = index.getTotalNets();
+
+    auto getUsedStdCell = [&](const uint32_t &insIndex) -> const UsedStdCell &
+    { return usedStdCells[flatMod.subModuleDefIndexs[insIndex]]; };
+    auto getStdCell = [&](const uint32_t &insIndex) -> const Module &
+    { return flatNetlist[flatMod.subModuleDefIndexs[insIndex]]; };
+    auto isTimed = [&](const uint32_t &insIndex)
+    {
+      const auto &kind = getUsedStdCell(insIndex).kind;
+      return kind == StdCellKind::COMBINATIONAL ||
+             kind == StdCellKind::TRISTATE;
+    };
+    // Call onePin(portDefIndex, bitIndex, netRootId) for every connected pin
+    // of an instance whose portDefIndex is in [beginPort, endPort).
+    auto forEachPin = [&](const uint32_t &insIndex, const uint32_t &beginPort,
+                          const uint32_t &endPort, auto &&onePin)
+    {
+      const auto &portAssignments =
+        flatMod.portAssignmentsOfSubModInss[insIndex];
+      for(uint32_t portDefIndex = beginPort; portDefIndex < endPort;
+          portDefIndex++)
+      {
+        const auto &refVars = portAssignments[portDefIndex].refVars;
+        for(uint32_t bitIndex = 0; bitIndex < refVars.size(); bitIndex++)
+          onePin(portDefIndex, bitIndex,
+                 netUnionFind.find(index.getNetId(refVars[bitIndex])));
+      }
+    };
+    auto forEachInput = [&](const uint32_t &insIndex, auto &&onePin)
+    {
+      forEachPin(insIndex, 0, getStdCell(insIndex).totalInputsAndInouts,
+                 onePin);
+    };
+    auto forEachOutput = [&](const uint32_t &insIndex, auto &&onePin)
+    {
+      const auto &stdCell = getStdCell(insIndex);
+      forEachPin(insIndex, stdCell.totalInputs,
+                 stdCell.totalPortsExcludingWires, onePin);
+    };
+
+    // Timed drivers of net sets in compressed sparse rows, and startpoints.
+    // A net set driven by nothing but a tie cell or a constant is untimed.
+    std::vector<uint32_t> rootDriverStarts(totalNets + 1, 0);
+    std::vector<bool> isStartRoot(totalNets, false);
+    std::vector<TimingPin> rootStartPins(totalNets);
+    std::vector<bool> isDrivenRoot(totalNets, false);
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      const bool isTimedIns = isTimed(insIndex);
+      const bool isTie = getUsedStdCell(insIndex).kind == StdCellKind::TIE;
+      forEachOutput(insIndex,
+                    [&](uint32_t portDefIndex, uint32_t bitIndex,
+                        uint32_t netRootId)
+                    {
+                      isDrivenRoot[netRootId] = true;
+                      if(isTimedIns)
+                        rootDriverStarts[netRootId + 1]++;
+                      else if(!isTie && !isStartRoot[netRootId])
+                      {
+                        isStartRoot[netRootId] = true;
+                        rootStartPins[netRootId] = { insIndex, portDefIndex,
+                                                     bitIndex };
+                      }
+                    });
+    }
+    // Primary inputs, then undriven net sets, which are named by their roots.
+    std::vector<bool> isUndrivenRoot(totalNets, false);
+    auto addStartNet = [&](const uint32_t &netId, const uint32_t &netRootId)
+    {
+      const RefVar refVar = index.getRefVar(netId);
+      isStartRoot[netRootId] = true;
+      rootStartPins[netRootId] = { UINT32_MAX, refVar.refVarDefIndex,
+                                   refVar.bitIndex };
+    };
+    for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts();
+        netId++)
+    {
+      const uint32_t netRootId = netUnionFind.find(netId);
+      if(!index.isConstNet(netRootId) && !isStartRoot[netRootId] &&
+         index.getRefVar(netId).refVarDefIndex < flatMod.totalInputsAndInouts)
+        addStartNet(netId, netRootId);
+    }
+    for(uint32_t netId = 0; netId < index.getTotalNetsExcludingConsts();
+        netId++)
+    {
+      if(netUnionFind.find(netId) != netId || isStartRoot[netId] ||
+         isDrivenRoot[netId])
+        continue;
+      addStartNet(netId, netId);
+      isUndrivenRoot[netId] = true;
+    }
+    for(uint32_t netId = 0; netId < totalNets; netId++)
+      rootDriverStarts[netId + 1] += rootDriverStarts[netId];
+    std::vector<uint32_t> rootDriverInss(rootDriverStarts.back());
+    {
+      std::vector<uint32_t> rootDriverEnds(rootDriverStarts.begin(),
+                                           rootDriverStarts.end() - 1);
+      for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+      {
+        if(!isTimed(insIndex))
+          continue;
+        forEachOutput(insIndex,
+                      [&](uint32_t, uint32_t, uint32_t netRootId) {
+                        rootDriverInss[rootDriverEnds[netRootId]++] = insIndex;
+                      });
+      }
+    }
+
+    // 1. Order timed instances by an iterative depth first search, a driver
+    // is before its loads unless the edge closes a loop.
+    const uint32_t unordered = UINT32_MAX;
+    std::vector<uint32_t> insOrders(totalInss, unordered);
+    std::vector<uint32_t> orderedInss;
+    std::vector<bool> isOnStack(totalInss, false);
+    uint64_t totalCutEdges = 0;
+    // Drivers of the inputs of an instance
+    std::vector<uint32_t> faninStarts(totalInss + 1, 0);
+    std::vector<uint32_t> faninInss;
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      if(isTimed(insIndex))
+        forEachInput(insIndex,
+                     [&](uint32_t, uint32_t, uint32_t netRootId)
+                     {
+                       faninInss.insert(
+                         faninInss.end(),
+                         rootDriverInss.begin() + rootDriverStarts[netRootId],
+                         rootDriverInss.begin() +
+                           rootDriverStarts[netRootId + 1]);
+                     });
+      faninStarts[insIndex + 1] = faninInss.size();
+    }
+    std::vector<std::pair<uint32_t, uint32_t>> stack;
+    for(uint32_t rootInsIndex = 0; rootInsIndex < totalInss; rootInsIndex++)
+    {
+      if(!isTimed(rootInsIndex) || insOrders[rootInsIndex] != unordered ||
+         isOnStack[rootInsIndex])
+        continue;
+      stack.emplace_back(rootInsIndex, faninStarts[rootInsIndex]);
+      isOnStack[rootInsIndex] = true;
+      while(!stack.empty())
+      {
+        const uint32_t insIndex = stack.back().first;
+        uint32_t &fanin = stack.back().second;
+        if(fanin == faninStarts[insIndex + 1])
+        {
+          insOrders[insIndex] = orderedInss.size();
+          orderedInss.push_back(insIndex);
+          isOnStack[insIndex] = false;
+          stack.pop_back();
+          continue;
+        }
+        const uint32_t driverInsIndex = faninInss[fanin++];
+        if(isOnStack[driverInsIndex])
+          totalCutEdges++;
+        else if(insOrders[driverInsIndex] == unordered)
+        {
+          isOnStack[driverInsIndex] = true;
+          stack.emplace_back(driverInsIndex, faninStarts[driverInsIndex]);
+        }
+      }
+    }
+    std::vector<uint32_t> insLevels(totalInss, 0);
+    uint32_t totalLevels = 0;
+    for(const auto &insIndex: orderedInss)
+    {
+      for(uint32_t fanin = faninStarts[insIndex];
+          fanin < faninStarts[insIndex + 1]; fanin++)
+      {
+        const uint32_t driverInsIndex = faninInss[fanin];
+        if(insOrders[driverInsIndex] < insOrders[insIndex])
+          insLevels[insIndex] =
+            std::max(insLevels[insIndex], insLevels[driverInsIndex] + 1);
+      }
+      totalLevels = std::max(totalLevels, insLevels[insIndex] + 1);
+    }
+    std::vector<uint32_t> levelStarts(totalLevels + 1, 0);
+    for(const auto &insIndex: orderedInss)
+      levelStarts[insLevels[insIndex] + 1]++;
+    for(uint32_t level = 0; level < totalLevels; level++)
+      levelStarts[level + 1] += levelStarts[level];
+    std::vector<uint32_t> levelInss(orderedInss.size());
+    {
+      std::vector<uint32_t> levelEnds(levelStarts.begin(),
+                                      levelStarts.end() - 1);
+      for(const auto &insIndex: orderedInss)
+        levelInss[levelEnds[insLevels[insIndex]]++] = insIndex;
+    }
+
+    // 2. Arrivals. The latest arrival of a net set seen by loadInsIndex only
+    // counts drivers before it, a driver after it closes a loop and starts
+    // a path at 0. loadInsIndex is UINT32_MAX for endpoints.
+    std::vector<double> insArrivals(totalInss, untimedArrival);
+    std::vector<uint32_t> insDriverInss(totalInss, UINT32_MAX);
+    std::vector<TimingPin> insLatestInputs(totalInss);
+    auto getRootArrival = [&](const uint32_t &netRootId,
+                              const uint32_t &loadInsIndex,
+                              uint32_t &driverInsIndex)
+    {
+      double arrival = isStartRoot[netRootId] ? 0 : untimedArrival;
+      driverInsIndex = UINT32_MAX;
+      for(uint32_t driver = rootDriverStarts[netRootId];
+          driver < rootDriverStarts[netRootId + 1]; driver++)
+      {
+        const uint32_t oneDriverInsIndex = rootDriverInss[driver];
+        if(loadInsIndex != UINT32_MAX &&
+           insOrders[oneDriverInsIndex] >= insOrders[loadInsIndex])
+        {
+          arrival = std::max(arrival, 0.0);
+          continue;
+        }
+        if(insArrivals[oneDriverInsIndex] > arrival)
+        {
+          arrival = insArrivals[oneDriverInsIndex];
+          driverInsIndex = oneDriverInsIndex;
+        }
+      }
+      return arrival;
+    };
+    // The latest input of an instance decides its arrival.
+    auto computeArrival = [&](const uint32_t &insIndex)
+    {
+      double latestArrival = untimedArrival;
+      forEachInput(insIndex,
+                   [&](uint32_t portDefIndex, uint32_t bitIndex,
+                       uint32_t netRootId)
+                   {
+                     uint32_t driverInsIndex;
+                     const double arrival =
+                       getRootArrival(netRootId, insIndex, driverInsIndex);
+                     if(arrival <= latestArrival)
+                       return;
+                     latestArrival = arrival;
+                     insDriverInss[insIndex] = driverInsIndex;
+                     insLatestInputs[insIndex] = { insIndex, portDefIndex,
+                                                   bitIndex };
+                   });
+      if(latestArrival != untimedArrival)
+        insArrivals[insIndex] = latestArrival + getUsedStdCell(insIndex).delay;
+    };
+    for(uint32_t level = 0; level < totalLevels; level++)
+    {
+      const uint32_t totalChunks =
+        (levelStarts[level + 1] - levelStarts[level] + timingChunkInss - 1) /
+        timingChunkInss;
+      parallelFor(0, totalChunks, totalThreads,
+                  [&](const uint32_t &chunk)
+                  {
+                    const uint32_t begin =
+                      levelStarts[level] + chunk * timingChunkInss;
+                    const uint32_t end =
+                      std::min(levelStarts[level + 1], begin + timingChunkInss);
+                    for(uint32_t levelIndex = begin; levelIndex < end;
+                        levelIndex++)
+                      computeArrival(levelInss[levelIndex]);
+                  });
+    }
+
+    // Endpoints, and the latest totalPaths of them
+    std::vector<TimingEndpoint> endpoints;
+    auto addEndpoint = [&](const TimingPin &pin, const uint32_t &netRootId)
+    {
+      TimingEndpoint endpoint;
+      endpoint.pin = pin;
+      endpoint.netRootId = netRootId;
+      endpoint.arrival =
+        getRootArrival(netRootId, UINT32_MAX, endpoint.driverInsIndex);
+      if(endpoint.arrival != untimedArrival)
+        endpoints.push_back(endpoint);
+    };
+    for(uint32_t insIndex = 0; insIndex < totalInss; insIndex++)
+    {
+      if(isTimed(insIndex))
+        continue;
+      const auto &pinRoles = getUsedStdCell(insIndex).pinRoles;
+      forEachInput(insIndex,
+                   [&](uint32_t portDefIndex, uint32_t bitIndex,
+                       uint32_t netRootId)
+                   {
+                     if(pinRoles[portDefIndex] != PinRole::CLOCK &&
+                        pinRoles[portDefIndex] != PinRole::CLOCK_N)
+                       addEndpoint({ insIndex, portDefIndex, bitIndex },
+                                   netRootId);
+                   });
+    }
+    for(uint32_t portDefIndex = flatMod.totalInputs;
+        portDefIndex < flatMod.totalPortsExcludingWires; portDefIndex++)
+    {
+      RefVar refVar;
+      refVar.refVarDefIndex = portDefIndex;
+      for(uint32_t bitIndex = 0;
+          bitIndex < flatMod.ports[portDefIndex].bitWidth; bitIndex++)
+      {
+        refVar.bitIndex = bitIndex;
+        addEndpoint({ UINT32_MAX, portDefIndex, bitIndex },
+                    netUnionFind.find(index.getNetId(refVar)));
+      }
+    }
+    const uint32_t totalReportedPaths =
+      std::min<size_t>(totalPaths, endpoints.size());
+    std::partial_sort(endpoints.begin(), endpoints.begin() + totalReportedPaths,
+                      endpoints.end(),
+                      [](const TimingEndpoint &a, const TimingEndpoint &b)
+                      { return a.arrival > b.arrival; });
+
+    // A pin is written as instance/pin and std cell, a net as its name and
+    // the direction of the port, "undriven" or "loop".
+    const char *directionNames[3] = { "input", "output", "inout" };
+    auto writePin = [&](const double &arrival, const TimingPin &pin,
+                        const char *netNote = nullptr)
+    {
+      ofs << arrival << " ";
+      if(pin.insIndex == UINT32_MAX)
+      {
+        RefVar refVar;
+        refVar.refVarDefIndex = pin.portDefIndex;
+        refVar.bitIndex = pin.bitIndex;
+        ofs << index.getNetName(index.getNetId(refVar)) << " "
+            << (netNote ? netNote
+                        : directionNames[int(
+                            flatMod.ports[pin.portDefIndex].portType)])
+            << std::endl;
+        return;
+      }
+      const auto &stdCell = getStdCell(pin.insIndex);
+      const auto &port = stdCell.ports[pin.portDefIndex];
+      ofs << flatMod.subModuleInstanceNames[pin.insIndex] << "/"
+          << port.portDefName;
+      if(port.isVector)
+        ofs << "[" << pin.bitIndex << "]";
+      ofs << " " << stdCell.moduleDefName << std::endl;
+    };
+    // The output pin of a timed instance driving netRootId
+    auto getOutputPin = [&](const uint32_t &insIndex, const uint32_t &netRootId)
+    {
+      TimingPin outputPin;
+      forEachOutput(insIndex,
+                    [&](uint32_t portDefIndex, uint32_t bitIndex,
+                        uint32_t oneNetRootId)
+                    {
+                      if(oneNetRootId == netRootId &&
+                         outputPin.insIndex == UINT32_MAX)
+                        outputPin = { insIndex, portDefIndex, bitIndex };
+                    });
+      return outputPin;
+    };
+
+    ofs << "// Timing of module " << flatMod.moduleDefName << std::endl;
+    ofs << "// Total instances: " << totalInss
+        << ", timed instances: " << orderedInss.size()
+        << ", levels: " << totalLevels
+        << ", loop edges cut: " << totalCutEdges
+        << ", endpoints: " << endpoints.size() << std::endl;
+    for(uint32_t path = 0; path < totalReportedPaths; path++)
+    {
+      const auto &endpoint = endpoints[path];
+      // Trace back from the endpoint to its startpoint.
+      std::vector<std::pair<uint32_t, uint32_t>> cells;
+      uint32_t netRootId = endpoint.netRootId;
+      for(uint32_t insIndex = endpoint.driverInsIndex; insIndex != UINT32_MAX;
+          insIndex = insDriverInss[insIndex])
+      {
+        cells.emplace_back(insIndex, netRootId);
+        const auto &latestInput = insLatestInputs[insIndex];
+        netRootId = netUnionFind.find(index.getNetId(
+          flatMod.portAssignmentsOfSubModInss[insIndex]
+                                             [latestInput.portDefIndex]
+                                               .refVars[latestInput.bitIndex]));
+      }
+      ofs << "// Path " << path + 1 << ", arrival " << endpoint.arrival
+          << ", cells " << cells.size() << std::endl;
+      ofs << "// Arrival, pin, std cell or direction" << std::endl;
+      // A path which starts at a cut loop starts at a timed instance.
+      if(!isStartRoot[netRootId])
+      {
+        const RefVar refVar = index.getRefVar(netRootId);
+        writePin(0, { UINT32_MAX, refVar.refVarDefIndex, refVar.bitIndex },
+                 "loop");
+      }
+      else
+        writePin(0, rootStartPins[netRootId],
+                 isUndrivenRoot[netRootId] ? "undriven" : nullptr);
+      for(auto cell = cells.rbegin(); cell != cells.rend(); cell++)
+        writePin(insArrivals[cell->first],
+                 getOutputPin(cell->first, cell->second));
+      writePin(endpoint.arrival, endpoint.pin);
+    }
+    ofs << std::endl;
+  }
+}
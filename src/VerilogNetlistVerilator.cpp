@@ -197,12 +197,14 @@ static void verilate(const string &argString)
 
   // Read first filename
   v3Global.readFiles();
+  NetlistProfiler::endStage("parse");
 
   // Link, etc, if needed
   // had been modified by haorui, and we need to know about it.
   if(!v3Global.opt.preprocOnly())
   { //
     process();
+    NetlistProfiler::endStage("process");
   }
 
   // Final steps
@@ -245,6 +247,7 @@ void VerilogNetlist::parseHierNet(int argc, char **argv, char **env)
   verilate(argString);
   // 1,Obtain a hierarchical netlist from AST.
   genHierNet();
+  NetlistProfiler::endStage("genHierNet", _hierNetlist);
 
   // Explicitly release resources
   v3Global.shutdown();